@@ -56,6 +56,9 @@
 #include "SimpleShader.hpp"         // default shader programs for 2D and 3D applications
 #include "TextureUtils.hpp"         // helper functions for registering textures
 #include "UniformBufferObject.hpp"  // helper class to use UBOs
+#include "GeometryArena.hpp"        // to share vertex and index buffers between many models
 #include "ModelLoader.hpp"          // to load OBJ, OFF, PLY, STL files
+#include "ModelInstanceBatcher.hpp" // to cull and draw many instances of a model at once
+#include "ModelBVH.hpp"             // to ray cast and collide against the triangles of a model
 
 #endif // CSCI441_CSCI441_HPP
@@ -0,0 +1,409 @@
+/** @file GeometryArena.hpp
+ * @brief Shares a few large vertex and index buffers between many models
+ * @author Dr. Jeffrey Paone
+ *
+ * @copyright MIT License Copyright (c) 2026 Dr. Jeffrey Paone
+ *
+ *	These functions, classes, and constants help minimize common
+ *	code that needs to be written.
+ *
+ *	@warning NOTE: This header file will only work with OpenGL 3.2+
+ *	@warning NOTE: This header file depends upon GLAD (or alternatively GLEW)
+ *	@warning NOTE: This header file depends upon glm
+ */
+
+#ifndef CSCI441_GEOMETRY_ARENA_HPP
+#define CSCI441_GEOMETRY_ARENA_HPP
+
+#ifdef CSCI441_USE_GLEW
+    #include <GL/glew.h>
+#else
+    #include <glad/gl.h>
+#endif
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+//******************************************************************************
+
+namespace CSCI441 {
+
+    /**
+     * @class GeometryArena
+     * @brief Packs the vertices and indices of many models into a few large pages, each page one vertex array with
+     * one vertex buffer and one index buffer
+     * @note Every page holds vertices in the same interleaved GeometryArena::Vertex format and 32-bit indices.  Each
+     * model is given a range of vertices and a range of indices within a single page, and draws its indices with
+     * glDrawElementsBaseVertex() so the indices stay relative to the model's own first vertex.
+     * @note Ranges are handed out first fit from a free list per page, and released ranges are merged with their free
+     * neighbors so they can be reused by models of any size.  A new page is only created when no existing page has
+     * room, sized to fit the request if it is larger than a page.
+     * @note Models sharing a page share its vertex array, so attribute locations are set once for the whole arena
+     */
+    class [[maybe_unused]] GeometryArena final {
+    public:
+        /**
+         * @brief vertex format stored in every page
+         */
+        struct Vertex {
+            /**
+             * @brief vertex position
+             */
+            glm::vec3 position;
+            /**
+             * @brief vertex normal
+             */
+            glm::vec3 normal;
+            /**
+             * @brief vertex texture coordinate
+             */
+            glm::vec2 texCoord;
+            /**
+             * @brief vertex tangent with the handedness of the bitangent in w
+             */
+            glm::vec4 tangent;
+            /**
+             * @brief vertex color
+             */
+            glm::vec4 color;
+        };
+
+        /**
+         * @brief range of vertices and indices given to a single model
+         */
+        struct Allocation {
+            /**
+             * @brief page holding the vertices and indices
+             */
+            GLuint page = 0;
+            /**
+             * @brief first vertex of the range, added to every index when drawn
+             */
+            GLuint baseVertex = 0;
+            /**
+             * @brief number of vertices in the range
+             */
+            GLuint numVertices = 0;
+            /**
+             * @brief first index of the range
+             */
+            GLuint firstIndex = 0;
+            /**
+             * @brief number of indices in the range
+             */
+            GLuint numIndices = 0;
+        };
+
+        /**
+         * @brief Creates an empty arena, pages are created as models are added
+         * @param verticesPerPage number of vertices each page can hold
+         * @param indicesPerPage number of indices each page can hold
+         */
+        [[maybe_unused]] explicit GeometryArena(GLuint verticesPerPage = 1 << 20, GLuint indicesPerPage = 1 << 22);
+        /**
+         * @brief Deletes every page from the GPU
+         */
+        ~GeometryArena();
+
+        /**
+         * @brief do not allow arenas to be copied
+         */
+        GeometryArena(const GeometryArena&) = delete;
+        /**
+         * @brief do not allow arenas to be copied
+         */
+        GeometryArena& operator=(const GeometryArena&) = delete;
+
+        /**
+         * @brief do not allow arenas to be moved, models keep the address of the arena they were uploaded into
+         */
+        GeometryArena(GeometryArena&&) = delete;
+        /**
+         * @brief do not allow arenas to be moved, models keep the address of the arena they were uploaded into
+         */
+        GeometryArena& operator=(GeometryArena&&) = delete;
+
+        /**
+         * @brief Reserves a range of vertices and a range of indices within the same page
+         * @param numVertices number of vertices to reserve
+         * @param numIndices number of indices to reserve
+         * @return the ranges reserved
+         */
+        [[maybe_unused]] Allocation allocate(GLuint numVertices, GLuint numIndices);
+        /**
+         * @brief Returns the ranges of an allocation to its page so they can be reused
+         * @param allocation ranges returned by allocate()
+         */
+        [[maybe_unused]] void release(const Allocation& allocation);
+        /**
+         * @brief Copies vertices and indices into the ranges of an allocation
+         * @param allocation ranges returned by allocate()
+         * @param vertices allocation.numVertices vertices to copy
+         * @param indices allocation.numIndices indices to copy, relative to the first vertex of the allocation
+         */
+        [[maybe_unused]] void upload(const Allocation& allocation, const Vertex* vertices, const GLuint* indices) const;
+
+        /**
+         * @brief Enables the vertex attributes of every page, including pages created later
+         * @param positionLocation attribute location of vertex position
+         * @param normalLocation attribute location of vertex normal
+         * @param texCoordLocation attribute location of vertex texture coordinate
+         * @param tangentLocation attribute location of vertex tangent
+         * @param colorLocation attribute location of vertex color
+         */
+        [[maybe_unused]] void setAttributeLocations(GLint positionLocation, GLint normalLocation = -1, GLint texCoordLocation = -1, GLint tangentLocation = -1, GLint colorLocation = -1);
+        /**
+         * @brief Binds the vertex array of a page, which has the page's index buffer bound
+         * @param page page to bind
+         */
+        [[maybe_unused]] void bindPage(GLuint page) const;
+
+        /**
+         * @brief Return the number of pages created
+         * @return number of pages
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getNumPages() const;
+        /**
+         * @brief Return the vertex array of a page
+         * @param page page to query
+         * @return handle of the page's vertex array
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getVertexArray(GLuint page) const;
+        /**
+         * @brief Return the number of vertices currently given out across every page
+         * @return number of vertices allocated
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getNumAllocatedVertices() const;
+        /**
+         * @brief Return the number of indices currently given out across every page
+         * @return number of indices allocated
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getNumAllocatedIndices() const;
+
+    private:
+        struct FreeRange {
+            GLuint offset;
+            GLuint size;
+        };
+
+        struct Page {
+            GLuint vaod;
+            GLuint vbod;
+            GLuint ibod;
+            std::vector<FreeRange> freeVertices;
+            std::vector<FreeRange> freeIndices;
+        };
+
+        GLuint _verticesPerPage;
+        GLuint _indicesPerPage;
+        GLuint _numAllocatedVertices;
+        GLuint _numAllocatedIndices;
+        GLint _attributeLocations[5];
+        std::vector<Page> _pages;
+
+        void _addPage(GLuint numVertices, GLuint numIndices);
+        void _setPageAttributes(const Page& page) const;
+        static bool _allocateRange(std::vector<FreeRange>& freeList, GLuint size, GLuint& offset);
+        static void _releaseRange(std::vector<FreeRange>& freeList, GLuint offset, GLuint size);
+
+        void _cleanupSelf();
+    };
+}
+
+//**********************************************************************************
+//**********************************************************************************
+// Outward facing function implementations
+
+[[maybe_unused]]
+inline CSCI441::GeometryArena::GeometryArena( const GLuint verticesPerPage, const GLuint indicesPerPage ) :
+    _verticesPerPage( std::max( verticesPerPage, 1u ) ),
+    _indicesPerPage( std::max( indicesPerPage, 1u ) ),
+    _numAllocatedVertices(0),
+    _numAllocatedIndices(0),
+    _attributeLocations{ -1, -1, -1, -1, -1 }
+{
+
+}
+
+inline CSCI441::GeometryArena::~GeometryArena() {
+    _cleanupSelf();
+}
+
+[[maybe_unused]]
+inline CSCI441::GeometryArena::Allocation CSCI441::GeometryArena::allocate( const GLuint numVertices, const GLuint numIndices ) {
+    Allocation allocation;
+    allocation.numVertices = numVertices;
+    allocation.numIndices = numIndices;
+
+    // both ranges must come from the same page, give back the vertices if the page has no room for the indices
+    for( GLuint p = 0; p < _pages.size(); p++ ) {
+        if( !_allocateRange( _pages[p].freeVertices, numVertices, allocation.baseVertex ) ) continue;
+        if( !_allocateRange( _pages[p].freeIndices, numIndices, allocation.firstIndex ) ) {
+            _releaseRange( _pages[p].freeVertices, allocation.baseVertex, numVertices );
+            continue;
+        }
+        allocation.page = p;
+        _numAllocatedVertices += numVertices;
+        _numAllocatedIndices += numIndices;
+        return allocation;
+    }
+
+    _addPage( std::max( numVertices, _verticesPerPage ), std::max( numIndices, _indicesPerPage ) );
+    allocation.page = static_cast<GLuint>(_pages.size() - 1);
+    _allocateRange( _pages.back().freeVertices, numVertices, allocation.baseVertex );
+    _allocateRange( _pages.back().freeIndices, numIndices, allocation.firstIndex );
+    _numAllocatedVertices += numVertices;
+    _numAllocatedIndices += numIndices;
+    return allocation;
+}
+
+[[maybe_unused]]
+inline void CSCI441::GeometryArena::release( const Allocation& allocation ) {
+    if( allocation.page >= _pages.size() ) return;
+    _releaseRange( _pages[allocation.page].freeVertices, allocation.baseVertex, allocation.numVertices );
+    _releaseRange( _pages[allocation.page].freeIndices, allocation.firstIndex, allocation.numIndices );
+    _numAllocatedVertices -= allocation.numVertices;
+    _numAllocatedIndices -= allocation.numIndices;
+}
+
+[[maybe_unused]]
+inline void CSCI441::GeometryArena::upload( const Allocation& allocation, const Vertex* vertices, const GLuint* indices ) const {
+    if( allocation.page >= _pages.size() ) return;
+    const Page& page = _pages[allocation.page];
+
+    // copy through the copy write target so the element buffer binding of whichever vertex array is bound is left alone
+    if( allocation.numVertices > 0 ) {
+        glBindBuffer( GL_COPY_WRITE_BUFFER, page.vbod );
+        glBufferSubData( GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(sizeof(Vertex) * allocation.baseVertex), static_cast<GLsizeiptr>(sizeof(Vertex) * allocation.numVertices), vertices );
+    }
+    if( allocation.numIndices > 0 ) {
+        glBindBuffer( GL_COPY_WRITE_BUFFER, page.ibod );
+        glBufferSubData( GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(sizeof(GLuint) * allocation.firstIndex), static_cast<GLsizeiptr>(sizeof(GLuint) * allocation.numIndices), indices );
+    }
+    glBindBuffer( GL_COPY_WRITE_BUFFER, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::GeometryArena::setAttributeLocations( const GLint positionLocation, const GLint normalLocation, const GLint texCoordLocation, const GLint tangentLocation, const GLint colorLocation ) {
+    _attributeLocations[0] = positionLocation;
+    _attributeLocations[1] = normalLocation;
+    _attributeLocations[2] = texCoordLocation;
+    _attributeLocations[3] = tangentLocation;
+    _attributeLocations[4] = colorLocation;
+    for( const auto& page : _pages ) {
+        _setPageAttributes( page );
+    }
+}
+
+[[maybe_unused]]
+inline void CSCI441::GeometryArena::bindPage( const GLuint page ) const {
+    if( page < _pages.size() ) glBindVertexArray( _pages[page].vaod );
+}
+
+[[maybe_unused]] inline GLuint CSCI441::GeometryArena::getNumPages() const { return static_cast<GLuint>(_pages.size()); }
+[[maybe_unused]] inline GLuint CSCI441::GeometryArena::getVertexArray( const GLuint page ) const { return page < _pages.size() ? _pages[page].vaod : 0; }
+[[maybe_unused]] inline GLuint CSCI441::GeometryArena::getNumAllocatedVertices() const { return _numAllocatedVertices; }
+[[maybe_unused]] inline GLuint CSCI441::GeometryArena::getNumAllocatedIndices() const { return _numAllocatedIndices; }
+
+//**********************************************************************************
+//**********************************************************************************
+// Private helper implementations
+
+inline void CSCI441::GeometryArena::_addPage( const GLuint numVertices, const GLuint numIndices ) {
+    Page page;
+    glGenVertexArrays( 1, &page.vaod );
+    glGenBuffers( 1, &page.vbod );
+    glGenBuffers( 1, &page.ibod );
+
+    glBindVertexArray( page.vaod );
+    glBindBuffer( GL_ARRAY_BUFFER, page.vbod );
+    glBufferData( GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(Vertex) * numVertices), nullptr, GL_STATIC_DRAW );
+    glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, page.ibod );
+    glBufferData( GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(GLuint) * numIndices), nullptr, GL_STATIC_DRAW );
+
+    page.freeVertices.push_back( { 0, numVertices } );
+    page.freeIndices.push_back( { 0, numIndices } );
+    _setPageAttributes( page );
+    _pages.push_back( std::move(page) );
+}
+
+inline void CSCI441::GeometryArena::_setPageAttributes( const Page& page ) const {
+    struct AttributeFormat { GLint numComponents; size_t offset; };
+    const AttributeFormat formats[5] = {
+        { 3, offsetof(Vertex, position) },
+        { 3, offsetof(Vertex, normal) },
+        { 2, offsetof(Vertex, texCoord) },
+        { 4, offsetof(Vertex, tangent) },
+        { 4, offsetof(Vertex, color) }
+    };
+
+    glBindVertexArray( page.vaod );
+    glBindBuffer( GL_ARRAY_BUFFER, page.vbod );
+    for( int i = 0; i < 5; i++ ) {
+        if( _attributeLocations[i] < 0 ) continue;
+        glEnableVertexAttribArray( _attributeLocations[i] );
+        glVertexAttribPointer( _attributeLocations[i], formats[i].numComponents, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)formats[i].offset );
+    }
+}
+
+//
+//  bool _allocateRange(std::vector<FreeRange>& freeList, GLuint size, GLuint& offset)
+//
+//      Takes size elements from the front of the first free range large enough to hold them
+//
+inline bool CSCI441::GeometryArena::_allocateRange( std::vector<FreeRange>& freeList, const GLuint size, GLuint& offset ) {
+    if( size == 0 ) {
+        offset = 0;
+        return true;
+    }
+    for( auto range = freeList.begin(); range != freeList.end(); ++range ) {
+        if( range->size < size ) continue;
+        offset = range->offset;
+        range->offset += size;
+        range->size -= size;
+        if( range->size == 0 ) freeList.erase( range );
+        return true;
+    }
+    return false;
+}
+
+//
+//  void _releaseRange(std::vector<FreeRange>& freeList, GLuint offset, GLuint size)
+//
+//      Inserts the range into the free list, which is kept sorted by offset, and merges it
+//  with the free ranges directly before and after it
+//
+inline void CSCI441::GeometryArena::_releaseRange( std::vector<FreeRange>& freeList, const GLuint offset, const GLuint size ) {
+    if( size == 0 ) return;
+    auto next = std::lower_bound( freeList.begin(), freeList.end(), offset, [](const FreeRange& range, const GLuint value) { return range.offset < value; } );
+    auto range = freeList.insert( next, { offset, size } );
+
+    const auto following = range + 1;
+    if( following != freeList.end() && range->offset + range->size == following->offset ) {
+        range->size += following->size;
+        range = freeList.erase( following ) - 1;
+    }
+    if( range != freeList.begin() ) {
+        const auto preceding = range - 1;
+        if( preceding->offset + preceding->size == range->offset ) {
+            preceding->size += range->size;
+            freeList.erase( range );
+        }
+    }
+}
+
+inline void CSCI441::GeometryArena::_cleanupSelf() {
+    for( auto& page : _pages ) {
+        glDeleteVertexArrays( 1, &page.vaod );
+        glDeleteBuffers( 1, &page.vbod );
+        glDeleteBuffers( 1, &page.ibod );
+    }
+    _pages.clear();
+    _numAllocatedVertices = 0;
+    _numAllocatedIndices = 0;
+}
+
+#endif // CSCI441_GEOMETRY_ARENA_HPP
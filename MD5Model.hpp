@@ -61,12 +61,15 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace CSCI441 {
 
@@ -153,6 +156,32 @@ namespace CSCI441 {
          */
         [[maybe_unused]] void allocVertexArrays(GLuint vPosAttribLoc, GLuint vColorAttribLoc, GLuint vTexCoordAttribLoc, GLuint vNormalAttribLoc = 0, GLuint vTangentAttribLoc = 0);
 
+        /**
+         * @brief largest number of joints a model skinned on the GPU can have
+         * @note the joint palette is sized to fill the 16KB every OpenGL implementation allows a uniform block
+         */
+        static constexpr GLint MAX_SKINNED_JOINTS = 256;
+        /**
+         * @brief uploads the bind pose of every mesh once so the meshes are skinned in the vertex shader instead of on the CPU every frame
+         * @param vPosAttribLoc location of vertex position attribute
+         * @param vColorAttribLoc location of vertex color attribute
+         * @param vTexCoordAttribLoc location of vertex texture coordinate attribute
+         * @param vJointIndicesAttribLoc location of the uvec4 vertex joint indices attribute
+         * @param vJointWeightsAttribLoc location of the vec4 vertex joint weights attribute
+         * @param vNormalAttribLoc location of vertex normal attribute (defaults to 0 to disable usage)
+         * @param vTangentAttribLoc location of vertex tangent attribute (defaults to 0 to disable usage)
+         * @param jointPaletteBinding uniform buffer binding point the joint palette is bound to when drawing
+         * @returns true if the model has few enough joints to be skinned on the GPU
+         * @note use instead of allocVertexArrays()
+         * @note each vertex keeps the four weights with the largest bias, rescaled to sum to one.  Each frame draw()
+         * only writes one matrix per joint, taking a vertex from its bind pose to the current pose, into a uniform
+         * buffer declared in the vertex shader as <tt>layout(std140) uniform JointPalette { mat4 jointPalette[256]; };</tt>
+         * @note the vertex shader blends the matrices of its joints and transforms the position, normal, and tangent by them
+         * <tt>mat4 skin = vJointWeights.x * jointPalette[vJointIndices.x] + vJointWeights.y * jointPalette[vJointIndices.y]
+         * + vJointWeights.z * jointPalette[vJointIndices.z] + vJointWeights.w * jointPalette[vJointIndices.w];</tt>
+         */
+        [[maybe_unused]] bool allocSkinnedVertexArrays(GLuint vPosAttribLoc, GLuint vColorAttribLoc, GLuint vTexCoordAttribLoc, GLuint vJointIndicesAttribLoc, GLuint vJointWeightsAttribLoc, GLuint vNormalAttribLoc = 0, GLuint vTangentAttribLoc = 0, GLuint jointPaletteBinding = 0);
+
         /**
          * @brief specify which texture targets each texture map should be bound to when rendering
          * @param diffuseMapActiveTexture active texture to bind the diffuse map to (default GL_TEXTURE0)
@@ -306,6 +335,35 @@ namespace CSCI441 {
          */
         CSCI441_INTERNAL::MD5Joint* _skeleton = nullptr;
 
+        // GPU skinning related stuff
+        /**
+         * @brief flag stating if the meshes are skinned in the vertex shader instead of on the CPU
+         */
+        bool _isSkinnedOnGPU = false;
+        /**
+         * @brief inverse of each joint's bind pose transformation
+         * @note allocated size is tracked in _numJoints
+         */
+        glm::mat4* _inverseBindPose = nullptr;
+        /**
+         * @brief first vertex of each mesh within the skinned VBO
+         * @note allocated size is tracked in _numMeshes
+         */
+        GLint* _meshBaseVertex = nullptr;
+        /**
+         * @brief first index of each mesh within the skinned IBO
+         * @note allocated size is tracked in _numMeshes
+         */
+        GLuint* _meshFirstIndex = nullptr;
+        /**
+         * @brief UBO the joint palette is written to each frame
+         */
+        GLuint _jointPaletteUBO = 0;
+        /**
+         * @brief uniform buffer binding point the joint palette is bound to when drawing
+         */
+        GLuint _jointPaletteBinding = 0;
+
         // animation related stuff
         /**
          * @brief the MD5 animation frame sequences
@@ -356,6 +414,24 @@ namespace CSCI441 {
          * @param pMESH mesh to load into vertex arrays
          */
         void _prepareMesh(const CSCI441_INTERNAL::MD5Mesh* pMESH) const;
+        /**
+         * @brief Compute mesh's vertex positions, normals, and tangents for a
+         * given skeleton and put them in the CPU vertex arrays
+         * @param pMESH mesh to skin
+         * @param pSKELETON joints to position the mesh with
+         */
+        void _skinMesh(const CSCI441_INTERNAL::MD5Mesh* pMESH, const CSCI441_INTERNAL::MD5Joint* pSKELETON) const;
+        /**
+         * @brief write the transformation of each joint from its bind pose to
+         * its current pose into the joint palette and bind it
+         */
+        void _updateJointPalette() const;
+        /**
+         * @brief create the VAO/VBO used to draw the skeleton
+         * @param vPosAttribLoc location of vertex position attribute
+         * @param vColorAttribLoc location of vertex color attribute
+         */
+        void _allocSkeletonArrays(GLuint vPosAttribLoc, GLuint vColorAttribLoc);
         /**
          * @brief bind mesh's texture and vao, then call glDraw
          * @param pMESH mesh to draw
@@ -655,10 +731,13 @@ CSCI441::MD5Model::_freeModel()
 inline void
 CSCI441::MD5Model::draw() const
 {
+    // meshes skinned on the GPU only need the current pose of each joint
+    if (_isSkinnedOnGPU) _updateJointPalette();
+
     // Draw each mesh of the model
     for(GLint i = 0; i < _numMeshes; ++i) {
         CSCI441_INTERNAL::MD5Mesh& mesh = _meshes[i];    // get the mesh
-        _prepareMesh(&mesh);                             // do some preprocessing on it
+        if (!_isSkinnedOnGPU) _prepareMesh(&mesh);       // do some preprocessing on it
         _drawMesh(&mesh);                                // draw it
     }
 }
@@ -666,6 +745,25 @@ CSCI441::MD5Model::draw() const
 inline void
 CSCI441::MD5Model::_prepareMesh(
     const CSCI441_INTERNAL::MD5Mesh *pMESH
+) const {
+    _skinMesh(pMESH, _skeleton);
+
+    glBindVertexArray(_vao );
+
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo[0] );
+    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(sizeof(glm::vec3)) * pMESH->numVertices, &_vertexArray[0] );
+    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(glm::vec3)) * _maxVertices * 1, static_cast<GLsizeiptr>(sizeof(glm::vec3)) * pMESH->numVertices, &_normalArray[0] );
+    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(glm::vec3)) * _maxVertices * 2, static_cast<GLsizeiptr>(sizeof(glm::vec4)) * pMESH->numVertices, &_tangentArray[0] );
+    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(glm::vec3)) * _maxVertices * 2 + static_cast<GLsizeiptr>(sizeof(glm::vec4)) * _maxVertices, static_cast<GLsizeiptr>(sizeof(glm::vec2)) * pMESH->numVertices, &_texelArray[0] );
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _vbo[1] );
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(sizeof(GLuint)) * pMESH->numTriangles * 3, _vertexIndicesArray );
+}
+
+inline void
+CSCI441::MD5Model::_skinMesh(
+    const CSCI441_INTERNAL::MD5Mesh *pMESH,
+    const CSCI441_INTERNAL::MD5Joint *pSKELETON
 ) const {
     GLint i, j, k;
 
@@ -690,7 +788,7 @@ CSCI441::MD5Model::_prepareMesh(
         // Calculate final vertex to draw with weights
         for(j = 0; j < pMESH->vertices[i].count; ++j) {
             const CSCI441_INTERNAL::MD5Weight *weight = &pMESH->weights[pMESH->vertices[i].start + j];
-            const CSCI441_INTERNAL::MD5Joint  *joint  = &_skeleton[weight->joint];
+            const CSCI441_INTERNAL::MD5Joint  *joint  = &pSKELETON[weight->joint];
 
             // Calculate transformed vertex for this weight
             const glm::vec3 weightedVertex = glm::rotate(joint->orientation, glm::vec4(weight->position, 0.0f));
@@ -758,17 +856,23 @@ CSCI441::MD5Model::_prepareMesh(
     delete[] normalAccum;
     delete[] tangentAccum;
     delete[] bitangentAccum;
+}
 
-    glBindVertexArray(_vao );
-
-    glBindBuffer(GL_ARRAY_BUFFER, _vbo[0] );
-    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(sizeof(glm::vec3)) * pMESH->numVertices, &_vertexArray[0] );
-    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(glm::vec3)) * _maxVertices * 1, static_cast<GLsizeiptr>(sizeof(glm::vec3)) * pMESH->numVertices, &_normalArray[0] );
-    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(glm::vec3)) * _maxVertices * 2, static_cast<GLsizeiptr>(sizeof(glm::vec4)) * pMESH->numVertices, &_tangentArray[0] );
-    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(glm::vec3)) * _maxVertices * 2 + static_cast<GLsizeiptr>(sizeof(glm::vec4)) * _maxVertices, static_cast<GLsizeiptr>(sizeof(glm::vec2)) * pMESH->numVertices, &_texelArray[0] );
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _vbo[1] );
-    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(sizeof(GLuint)) * pMESH->numTriangles * 3, _vertexIndicesArray );
+inline void
+CSCI441::MD5Model::_updateJointPalette() const
+{
+    glBindBuffer(GL_UNIFORM_BUFFER, _jointPaletteUBO );
+    // written straight into the buffer, the previous frame's palette is discarded rather than waited on
+    auto palette = static_cast<glm::mat4*>( glMapBufferRange(GL_UNIFORM_BUFFER, 0, static_cast<GLsizeiptr>(sizeof(glm::mat4)) * _numJoints, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT) );
+    if (palette != nullptr) {
+        for(GLint i = 0; i < _numJoints; ++i) {
+            glm::mat4 currentPose = glm::mat4_cast(_skeleton[i].orientation);
+            currentPose[3] = glm::vec4(_skeleton[i].position, 1.0f);
+            palette[i] = currentPose * _inverseBindPose[i];
+        }
+        glUnmapBuffer(GL_UNIFORM_BUFFER);
+    }
+    glBindBufferBase(GL_UNIFORM_BUFFER, _jointPaletteBinding, _jointPaletteUBO );
 }
 
 inline void
@@ -807,7 +911,13 @@ CSCI441::MD5Model::_drawMesh(
     }
 
     glBindVertexArray(_vao );
-    glDrawElements(GL_TRIANGLES, pMESH->numTriangles * 3, GL_UNSIGNED_INT, (void*)nullptr );
+    if (_isSkinnedOnGPU) {
+        // every mesh lives in the same buffers, one after another
+        const auto meshIndex = pMESH - _meshes;
+        glDrawElementsBaseVertex(GL_TRIANGLES, pMESH->numTriangles * 3, GL_UNSIGNED_INT, reinterpret_cast<void*>(sizeof(GLuint) * _meshFirstIndex[meshIndex]), _meshBaseVertex[meshIndex] );
+    } else {
+        glDrawElements(GL_TRIANGLES, pMESH->numTriangles * 3, GL_UNSIGNED_INT, (void*)nullptr );
+    }
 }
 
 [[maybe_unused]]
@@ -858,6 +968,169 @@ CSCI441::MD5Model::allocVertexArrays(
 
     CSCI441::LogUtils::log("[.md5mesh]: Model VAO/VBO/IBO registered at %u/%u/%u\n", _vao, _vbo[0], _vbo[1] );
 
+    _allocSkeletonArrays(vPosAttribLoc, vColorAttribLoc);
+}
+
+[[maybe_unused]]
+inline bool
+CSCI441::MD5Model::allocSkinnedVertexArrays(
+    const GLuint vPosAttribLoc,
+    const GLuint vColorAttribLoc,
+    const GLuint vTexCoordAttribLoc,
+    const GLuint vJointIndicesAttribLoc,
+    const GLuint vJointWeightsAttribLoc,
+    const GLuint vNormalAttribLoc,
+    const GLuint vTangentAttribLoc,
+    const GLuint jointPaletteBinding
+) {
+    if (_numJoints > MAX_SKINNED_JOINTS) {
+        CSCI441::LogUtils::logError("[.md5mesh | ERROR]: model has %d joints, at most %d joints can be skinned on the GPU\n", _numJoints, MAX_SKINNED_JOINTS);
+        return false;
+    }
+
+    // layout
+    // position normal tangent texCoord jointIndices jointWeights, every mesh one after another in each block
+
+    GLint numVertices = 0;
+    GLint numIndices = 0;
+    _meshBaseVertex = new GLint[_numMeshes];
+    _meshFirstIndex = new GLuint[_numMeshes];
+    for(GLint i = 0; i < _numMeshes; ++i) {
+        _meshBaseVertex[i] = numVertices;
+        _meshFirstIndex[i] = static_cast<GLuint>(numIndices);
+        numVertices += _meshes[i].numVertices;
+        numIndices += _meshes[i].numTriangles * 3;
+    }
+
+    std::vector<glm::vec3> positions(numVertices), normals(numVertices);
+    std::vector<glm::vec4> tangents(numVertices), jointWeights(numVertices);
+    std::vector<glm::vec2> texCoords(numVertices);
+    std::vector<glm::uvec4> jointIndices(numVertices);
+    std::vector<GLuint> indices(numIndices);
+
+    // the bind pose is skinned once on the CPU, reusing the per mesh scratch arrays
+    _vertexArray    = new glm::vec3[_maxVertices];
+    _normalArray    = new glm::vec3[_maxVertices];
+    _tangentArray   = new glm::vec4[_maxVertices];
+    _texelArray     = new glm::vec2[_maxVertices];
+    _vertexIndicesArray = new GLuint[_maxTriangles * 3];
+
+    std::vector< std::pair<GLfloat, GLint> > vertexWeights;
+    for(GLint i = 0; i < _numMeshes; ++i) {
+        const CSCI441_INTERNAL::MD5Mesh& mesh = _meshes[i];
+        _skinMesh(&mesh, _baseSkeleton);
+
+        const GLint baseVertex = _meshBaseVertex[i];
+        std::copy(_vertexArray, _vertexArray + mesh.numVertices, positions.begin() + baseVertex);
+        std::copy(_normalArray, _normalArray + mesh.numVertices, normals.begin() + baseVertex);
+        std::copy(_tangentArray, _tangentArray + mesh.numVertices, tangents.begin() + baseVertex);
+        std::copy(_texelArray, _texelArray + mesh.numVertices, texCoords.begin() + baseVertex);
+        std::copy(_vertexIndicesArray, _vertexIndicesArray + mesh.numTriangles * 3, indices.begin() + _meshFirstIndex[i]);
+
+        // keep the four most influential weights of each vertex and rescale them to sum to one
+        for(GLint j = 0; j < mesh.numVertices; ++j) {
+            vertexWeights.clear();
+            for(GLint k = 0; k < mesh.vertices[j].count; ++k) {
+                const CSCI441_INTERNAL::MD5Weight& weight = mesh.weights[mesh.vertices[j].start + k];
+                vertexWeights.emplace_back(weight.bias, weight.joint);
+            }
+            const size_t numInfluences = std::min<size_t>(vertexWeights.size(), 4);
+            std::partial_sort(vertexWeights.begin(), vertexWeights.begin() + static_cast<std::ptrdiff_t>(numInfluences), vertexWeights.end(),
+                              [](const std::pair<GLfloat, GLint>& a, const std::pair<GLfloat, GLint>& b) { return a.first > b.first; });
+
+            GLfloat totalBias = 0.0f;
+            for(size_t k = 0; k < numInfluences; ++k) totalBias += vertexWeights[k].first;
+            for(size_t k = 0; k < numInfluences; ++k) {
+                jointIndices[baseVertex + j][static_cast<glm::length_t>(k)] = static_cast<GLuint>(vertexWeights[k].second);
+                jointWeights[baseVertex + j][static_cast<glm::length_t>(k)] = totalBias > 0.0f ? vertexWeights[k].first / totalBias : 0.0f;
+            }
+        }
+    }
+
+    delete[] _vertexArray;
+    _vertexArray = nullptr;
+    delete[] _normalArray;
+    _normalArray = nullptr;
+    delete[] _tangentArray;
+    _tangentArray = nullptr;
+    delete[] _texelArray;
+    _texelArray = nullptr;
+    delete[] _vertexIndicesArray;
+    _vertexIndicesArray = nullptr;
+
+    // the palette takes a vertex from the bind pose back into each joint's space and then to the joint's current pose
+    _inverseBindPose = new glm::mat4[_numJoints];
+    for(GLint i = 0; i < _numJoints; ++i) {
+        glm::mat4 bindPose = glm::mat4_cast(_baseSkeleton[i].orientation);
+        bindPose[3] = glm::vec4(_baseSkeleton[i].position, 1.0f);
+        _inverseBindPose[i] = glm::inverse(bindPose);
+    }
+
+    const auto blockSize = static_cast<GLsizeiptr>(numVertices);
+    const GLsizeiptr normalOffset       = static_cast<GLsizeiptr>(sizeof(glm::vec3)) * blockSize;
+    const GLsizeiptr tangentOffset      = normalOffset + static_cast<GLsizeiptr>(sizeof(glm::vec3)) * blockSize;
+    const GLsizeiptr texCoordOffset     = tangentOffset + static_cast<GLsizeiptr>(sizeof(glm::vec4)) * blockSize;
+    const GLsizeiptr jointIndicesOffset = texCoordOffset + static_cast<GLsizeiptr>(sizeof(glm::vec2)) * blockSize;
+    const GLsizeiptr jointWeightsOffset = jointIndicesOffset + static_cast<GLsizeiptr>(sizeof(glm::uvec4)) * blockSize;
+
+    glGenVertexArrays( 1, &_vao );
+    glBindVertexArray(_vao );
+
+    glGenBuffers(2, _vbo );
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo[0] );
+    glBufferData(GL_ARRAY_BUFFER, jointWeightsOffset + static_cast<GLsizeiptr>(sizeof(glm::vec4)) * blockSize, nullptr, GL_STATIC_DRAW );
+    glBufferSubData(GL_ARRAY_BUFFER, 0, normalOffset, positions.data() );
+    glBufferSubData(GL_ARRAY_BUFFER, normalOffset, tangentOffset - normalOffset, normals.data() );
+    glBufferSubData(GL_ARRAY_BUFFER, tangentOffset, texCoordOffset - tangentOffset, tangents.data() );
+    glBufferSubData(GL_ARRAY_BUFFER, texCoordOffset, jointIndicesOffset - texCoordOffset, texCoords.data() );
+    glBufferSubData(GL_ARRAY_BUFFER, jointIndicesOffset, jointWeightsOffset - jointIndicesOffset, jointIndices.data() );
+    glBufferSubData(GL_ARRAY_BUFFER, jointWeightsOffset, static_cast<GLsizeiptr>(sizeof(glm::vec4)) * blockSize, jointWeights.data() );
+
+    glEnableVertexAttribArray( vPosAttribLoc );
+    glVertexAttribPointer( vPosAttribLoc, 3, GL_FLOAT, GL_FALSE, 0, static_cast<void *>(nullptr) );
+
+    if (vNormalAttribLoc != 0) {
+        glEnableVertexAttribArray( vNormalAttribLoc );
+        glVertexAttribPointer( vNormalAttribLoc, 3, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(normalOffset) );
+    }
+
+    if (vTangentAttribLoc != 0) {
+        glEnableVertexAttribArray( vTangentAttribLoc );
+        glVertexAttribPointer( vTangentAttribLoc, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(tangentOffset) );
+    }
+
+    if (vTexCoordAttribLoc != 0) {
+        glEnableVertexAttribArray( vTexCoordAttribLoc );
+        glVertexAttribPointer( vTexCoordAttribLoc, 2, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(texCoordOffset) );
+    }
+
+    glEnableVertexAttribArray( vJointIndicesAttribLoc );
+    glVertexAttribIPointer( vJointIndicesAttribLoc, 4, GL_UNSIGNED_INT, 0, reinterpret_cast<void *>(jointIndicesOffset) );
+
+    glEnableVertexAttribArray( vJointWeightsAttribLoc );
+    glVertexAttribPointer( vJointWeightsAttribLoc, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(jointWeightsOffset) );
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _vbo[1] );
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(GLuint)) * numIndices, indices.data(), GL_STATIC_DRAW );
+
+    glGenBuffers( 1, &_jointPaletteUBO );
+    glBindBuffer(GL_UNIFORM_BUFFER, _jointPaletteUBO );
+    glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(sizeof(glm::mat4)) * MAX_SKINNED_JOINTS, nullptr, GL_DYNAMIC_DRAW );
+    _jointPaletteBinding = jointPaletteBinding;
+
+    CSCI441::LogUtils::log("[.md5mesh]: Skinned model VAO/VBO/IBO registered at %u/%u/%u, joint palette UBO at %u\n", _vao, _vbo[0], _vbo[1], _jointPaletteUBO );
+
+    _allocSkeletonArrays(vPosAttribLoc, vColorAttribLoc);
+
+    _isSkinnedOnGPU = true;
+    return true;
+}
+
+inline void
+CSCI441::MD5Model::_allocSkeletonArrays(
+    const GLuint vPosAttribLoc,
+    const GLuint vColorAttribLoc
+) {
     glGenVertexArrays( 1, &_skeletonVAO );
     glBindVertexArray(_skeletonVAO );
 
@@ -919,6 +1192,20 @@ CSCI441::MD5Model::_freeVertexArrays()
 
     glDeleteBuffers( 1, &_skeletonVBO );
     _skeletonVBO = 0;
+
+    delete[] _inverseBindPose;
+    _inverseBindPose = nullptr;
+
+    delete[] _meshBaseVertex;
+    _meshBaseVertex = nullptr;
+
+    delete[] _meshFirstIndex;
+    _meshFirstIndex = nullptr;
+
+    glDeleteBuffers( 1, &_jointPaletteUBO );
+    _jointPaletteUBO = 0;
+
+    _isSkinnedOnGPU = false;
 }
 
 [[maybe_unused]]
@@ -1392,6 +1679,23 @@ inline void CSCI441::MD5Model::_moveFromSrc(MD5Model &src) {
     this->_skeleton = src._skeleton;
     src._skeleton = nullptr;
 
+    this->_isSkinnedOnGPU = src._isSkinnedOnGPU;
+    src._isSkinnedOnGPU = false;
+
+    this->_inverseBindPose = src._inverseBindPose;
+    src._inverseBindPose = nullptr;
+
+    this->_meshBaseVertex = src._meshBaseVertex;
+    src._meshBaseVertex = nullptr;
+
+    this->_meshFirstIndex = src._meshFirstIndex;
+    src._meshFirstIndex = nullptr;
+
+    this->_jointPaletteUBO = src._jointPaletteUBO;
+    src._jointPaletteUBO = 0;
+
+    this->_jointPaletteBinding = src._jointPaletteBinding;
+
     this->_animations = src._animations;
     src._animations = nullptr;
 
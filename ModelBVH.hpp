@@ -0,0 +1,743 @@
+/** @file ModelBVH.hpp
+ * @brief Bounding volume hierarchy over the triangles of a model for ray picking and collision queries
+ * @author Dr. Jeffrey Paone
+ *
+ * @copyright MIT License Copyright (c) 2026 Dr. Jeffrey Paone
+ *
+ *	These functions, classes, and constants help minimize common
+ *	code that needs to be written.
+ *
+ *	@warning NOTE: This header file depends upon GLAD (or alternatively GLEW)
+ *	@warning NOTE: This header file depends upon glm
+ */
+
+#ifndef CSCI441_MODEL_BVH_HPP
+#define CSCI441_MODEL_BVH_HPP
+
+#include "ModelLoader.hpp"
+
+#ifdef CSCI441_USE_GLEW
+    #include <GL/glew.h>
+#else
+    #include <glad/gl.h>
+#endif
+
+#include <glm/glm.hpp>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #include <xmmintrin.h>
+    #define CSCI441_INTERNAL_BVH_SSE
+#endif
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+//******************************************************************************
+
+namespace CSCI441 {
+
+    /**
+     * @class ModelBVH
+     * @brief Bounding volume hierarchy over the triangles of a loaded model, answering ray casts, closest point and
+     * box overlap queries on the CPU without testing every triangle
+     * @note The hierarchy is built top down, splitting each node where the surface area heuristic estimates the
+     * cheapest traversal.  Candidate splits are found by sorting triangle centroids into a fixed number of bins per axis.
+     * @note Nodes are stored flattened in a single array of 32 byte records with sibling nodes next to each other, and
+     * the triangle corners are copied in leaf order so a leaf reads one contiguous run of memory.
+     * @note Large meshes split their top levels with the binning spread across threads and then build the remaining
+     * subtrees on separate threads.
+     * @note All queries are answered in the model's object space and report triangles by their index in the model's
+     * index list, so triangle t is made of indices 3t, 3t+1, and 3t+2.
+     */
+    class [[maybe_unused]] ModelBVH final {
+    public:
+        /**
+         * @brief Result of a ray cast
+         */
+        struct RayHit {
+            /**
+             * @brief index of the triangle hit
+             */
+            GLuint triangle = 0;
+            /**
+             * @brief distance from the ray origin to the hit point
+             */
+            GLfloat distance = 0.0f;
+            /**
+             * @brief position of the hit point
+             */
+            glm::vec3 point = glm::vec3(0.0f);
+            /**
+             * @brief barycentric weights of the triangle's second and third corner at the hit point
+             */
+            glm::vec2 barycentric = glm::vec2(0.0f);
+        };
+
+        /**
+         * @brief Result of a closest point query
+         */
+        struct ClosestPoint {
+            /**
+             * @brief index of the triangle containing the closest point
+             */
+            GLuint triangle = 0;
+            /**
+             * @brief distance from the query point to the closest point
+             */
+            GLfloat distance = 0.0f;
+            /**
+             * @brief position of the closest point
+             */
+            glm::vec3 point = glm::vec3(0.0f);
+        };
+
+        /**
+         * @brief Creates an empty hierarchy that no query will hit
+         */
+        ModelBVH() = default;
+        /**
+         * @brief Creates the hierarchy over the triangles of a model
+         * @param model loaded model to build the hierarchy over, is not referenced after construction
+         */
+        [[maybe_unused]] explicit ModelBVH(const ModelLoader& model);
+        /**
+         * @brief Creates the hierarchy over an indexed triangle list
+         * @param vertices array of (x, y, z) vertex positions
+         * @param indices array of vertex indices, three per triangle
+         * @param numIndices number of indices
+         */
+        [[maybe_unused]] ModelBVH(const GLfloat* vertices, const GLuint* indices, GLuint numIndices);
+
+        /**
+         * @brief Rebuilds the hierarchy over the triangles of a model
+         * @param model loaded model to build the hierarchy over, is not referenced after the call
+         * @note a model loaded without its vertices kept on the CPU results in an empty hierarchy
+         */
+        [[maybe_unused]] void build(const ModelLoader& model);
+        /**
+         * @brief Rebuilds the hierarchy over an indexed triangle list
+         * @param vertices array of (x, y, z) vertex positions
+         * @param indices array of vertex indices, three per triangle
+         * @param numIndices number of indices
+         */
+        [[maybe_unused]] void build(const GLfloat* vertices, const GLuint* indices, GLuint numIndices);
+        /**
+         * @brief Removes every node and triangle from the hierarchy
+         */
+        [[maybe_unused]] void clear();
+
+        /**
+         * @brief Finds the first triangle along a ray
+         * @param origin start of the ray
+         * @param direction direction of the ray, does not need to be normalized
+         * @param hit set to the closest hit when one is found
+         * @param maxDistance hits further than this distance from the origin are ignored
+         * @return true if the ray hit a triangle, false otherwise
+         * @note triangles are hit from either side
+         */
+        [[maybe_unused]] bool raycast(const glm::vec3& origin, const glm::vec3& direction, RayHit& hit, GLfloat maxDistance = FLT_MAX) const;
+        /**
+         * @brief Finds the point on the surface of the model closest to a point
+         * @param point position to query
+         * @param result set to the closest point when one is found
+         * @param maxDistance surface points further than this distance from the query point are ignored
+         * @return true if a surface point was found within maxDistance, false otherwise
+         */
+        [[maybe_unused]] bool closestPoint(const glm::vec3& point, ClosestPoint& result, GLfloat maxDistance = FLT_MAX) const;
+        /**
+         * @brief Finds every triangle that intersects an axis aligned box
+         * @param boxMin minimum corner of the box
+         * @param boxMax maximum corner of the box
+         * @param triangles the index of each triangle touching the box is appended to this list
+         * @return number of triangles appended
+         */
+        [[maybe_unused]] GLuint overlap(const glm::vec3& boxMin, const glm::vec3& boxMax, std::vector<GLuint>& triangles) const;
+
+        /**
+         * @brief Return the number of triangles in the hierarchy
+         * @return number of triangles
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getNumberOfTriangles() const;
+        /**
+         * @brief Return the number of nodes in the hierarchy
+         * @return number of nodes
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getNumberOfNodes() const;
+        /**
+         * @brief Return the minimum corner of the box bounding every triangle
+         * @return minimum corner of the root node
+         */
+        [[maybe_unused]] [[nodiscard]] glm::vec3 getBoundingBoxMin() const;
+        /**
+         * @brief Return the maximum corner of the box bounding every triangle
+         * @return maximum corner of the root node
+         */
+        [[maybe_unused]] [[nodiscard]] glm::vec3 getBoundingBoxMax() const;
+
+    private:
+        // interior nodes have no triangles and store the index of their first child, the second child follows it
+        // leaves store the index of their first triangle in leaf order
+        struct Node {
+            glm::vec3 boundsMin;
+            GLuint leftFirst;
+            glm::vec3 boundsMax;
+            GLuint count;
+        };
+        static_assert( sizeof(Node) == 32, "ModelBVH nodes must pack into 32 bytes" );
+
+        // bounds and centroid of each triangle, only needed while building
+        struct BuildPrimitives {
+            std::vector<glm::vec3> boundsMin;
+            std::vector<glm::vec3> boundsMax;
+            std::vector<glm::vec3> centroids;
+        };
+
+        struct Bin {
+            glm::vec3 boundsMin = glm::vec3( FLT_MAX );
+            glm::vec3 boundsMax = glm::vec3( -FLT_MAX );
+            GLuint count = 0;
+        };
+
+        struct Ray {
+            glm::vec3 origin;
+            glm::vec3 invDirection;
+#ifdef CSCI441_INTERNAL_BVH_SSE
+            __m128 origin4;
+            __m128 invDirection4;
+#endif
+        };
+
+        static constexpr GLuint NUM_BINS = 16;
+        static constexpr GLuint MAX_LEAF_SIZE = 8;
+        static constexpr GLuint MAX_DEPTH = 60;
+        static constexpr GLuint STACK_SIZE = 64;
+        static constexpr GLuint PARALLEL_MIN_TRIANGLES = 16384;
+
+        std::vector<Node> _nodes;
+        // three corners per triangle, in leaf order
+        std::vector<glm::vec3> _triangleVertices;
+        // index of each triangle in the model, in leaf order
+        std::vector<GLuint> _triangleIds;
+
+        bool _subdivide(std::vector<Node>& nodes, GLuint nodeIndex, GLuint depth, const BuildPrimitives& primitives, bool parallel);
+        void _buildSubtree(std::vector<Node>& nodes, GLuint depth, const BuildPrimitives& primitives);
+        [[nodiscard]] GLfloat _intersectBox(const Node& node, const Ray& ray, GLfloat maxDistance) const;
+
+        static void _forRange(GLuint first, GLuint count, bool parallel, const std::function<void(size_t, size_t)>& body);
+        static void _grow(Bin& bin, const glm::vec3& boundsMin, const glm::vec3& boundsMax, GLuint count);
+        static GLfloat _surfaceArea(const Bin& bin);
+        static bool _intersectTriangle(const glm::vec3* corners, const glm::vec3& origin, const glm::vec3& direction, GLfloat& distance, glm::vec2& barycentric);
+        static glm::vec3 _closestPointOnTriangle(const glm::vec3* corners, const glm::vec3& point);
+        static bool _triangleOverlapsBox(const glm::vec3* corners, const glm::vec3& boxCenter, const glm::vec3& boxHalfExtent);
+    };
+}
+
+//**********************************************************************************
+//**********************************************************************************
+// Outward facing function implementations
+
+[[maybe_unused]]
+inline CSCI441::ModelBVH::ModelBVH( const ModelLoader& model ) {
+    build( model );
+}
+
+[[maybe_unused]]
+inline CSCI441::ModelBVH::ModelBVH( const GLfloat* vertices, const GLuint* indices, const GLuint numIndices ) {
+    build( vertices, indices, numIndices );
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelBVH::build( const ModelLoader& model ) {
+    build( model.getVertices(), model.getIndices(), model.getNumberOfIndices() );
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelBVH::build( const GLfloat* vertices, const GLuint* indices, const GLuint numIndices ) {
+    clear();
+    const GLuint numTriangles = numIndices / 3;
+    if( vertices == nullptr || indices == nullptr || numTriangles == 0 ) return;
+
+    const auto* positions = reinterpret_cast<const glm::vec3*>( vertices );
+    BuildPrimitives primitives;
+    primitives.boundsMin.resize( numTriangles );
+    primitives.boundsMax.resize( numTriangles );
+    primitives.centroids.resize( numTriangles );
+    _forRange( 0, numTriangles, numTriangles >= PARALLEL_MIN_TRIANGLES, [&](const size_t begin, const size_t end) {
+        for( size_t t = begin; t < end; t++ ) {
+            const glm::vec3& a = positions[ indices[t*3] ];
+            const glm::vec3& b = positions[ indices[t*3 + 1] ];
+            const glm::vec3& c = positions[ indices[t*3 + 2] ];
+            primitives.boundsMin[t] = glm::min( a, glm::min( b, c ) );
+            primitives.boundsMax[t] = glm::max( a, glm::max( b, c ) );
+            primitives.centroids[t] = (a + b + c) / 3.0f;
+        }
+    });
+
+    _triangleIds.resize( numTriangles );
+    std::iota( _triangleIds.begin(), _triangleIds.end(), 0 );
+
+    // a binary tree with one triangle per leaf is the largest possible
+    _nodes.reserve( static_cast<size_t>(numTriangles) * 2 - 1 );
+    _nodes.push_back( { glm::vec3(0.0f), 0, glm::vec3(0.0f), numTriangles } );
+
+    // split the top levels here, spreading each node's binning across threads, until the remaining nodes are small
+    // enough to hand whole subtrees to separate threads
+    std::vector<std::pair<GLuint, GLuint>> pending = { { 0, 0 } };
+    std::vector<std::pair<GLuint, GLuint>> subtrees;
+    while( !pending.empty() ) {
+        const auto [nodeIndex, depth] = pending.back();
+        pending.pop_back();
+        if( _nodes[nodeIndex].count < PARALLEL_MIN_TRIANGLES ) {
+            subtrees.emplace_back( nodeIndex, depth );
+        } else if( _subdivide( _nodes, nodeIndex, depth, primitives, true ) ) {
+            pending.emplace_back( _nodes[nodeIndex].leftFirst, depth + 1 );
+            pending.emplace_back( _nodes[nodeIndex].leftFirst + 1, depth + 1 );
+        }
+    }
+
+    std::vector<std::vector<Node>> subtreeNodes( subtrees.size() );
+    CSCI441_INTERNAL::parallelFor( subtrees.size(), 1, [&](const size_t begin, const size_t end) {
+        for( size_t s = begin; s < end; s++ ) {
+            subtreeNodes[s].push_back( _nodes[ subtrees[s].first ] );
+            _buildSubtree( subtreeNodes[s], subtrees[s].second, primitives );
+        }
+    });
+
+    // the subtree root replaces its placeholder and the rest of the subtree is appended, offsetting its child indices
+    for( size_t s = 0; s < subtrees.size(); s++ ) {
+        const auto base = static_cast<GLuint>( _nodes.size() );
+        for( size_t n = 0; n < subtreeNodes[s].size(); n++ ) {
+            Node node = subtreeNodes[s][n];
+            if( node.count == 0 ) node.leftFirst = base + node.leftFirst - 1;
+            if( n == 0 ) _nodes[ subtrees[s].first ] = node;
+            else         _nodes.push_back( node );
+        }
+    }
+    _nodes.shrink_to_fit();
+
+    _triangleVertices.resize( static_cast<size_t>(numTriangles) * 3 );
+    for( GLuint t = 0; t < numTriangles; t++ ) {
+        for( GLuint corner = 0; corner < 3; corner++ ) {
+            _triangleVertices[t*3 + corner] = positions[ indices[ _triangleIds[t]*3 + corner ] ];
+        }
+    }
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelBVH::clear() {
+    _nodes.clear();
+    _triangleVertices.clear();
+    _triangleIds.clear();
+}
+
+[[maybe_unused]]
+inline bool CSCI441::ModelBVH::raycast( const glm::vec3& origin, const glm::vec3& direction, RayHit& hit, const GLfloat maxDistance ) const {
+    if( _nodes.empty() || glm::dot( direction, direction ) == 0.0f ) return false;
+
+    // a zero direction component would turn the slab test into 0 * infinity, a tiny one still gives the right answer
+    const glm::vec3 unitDirection = glm::normalize( direction );
+    Ray ray;
+    ray.origin = origin;
+    for( int axis = 0; axis < 3; axis++ ) {
+        const GLfloat component = unitDirection[axis] != 0.0f ? unitDirection[axis] : std::copysign( FLT_MIN, unitDirection[axis] );
+        ray.invDirection[axis] = 1.0f / component;
+    }
+#ifdef CSCI441_INTERNAL_BVH_SSE
+    ray.origin4 = _mm_setr_ps( origin.x, origin.y, origin.z, 0.0f );
+    ray.invDirection4 = _mm_setr_ps( ray.invDirection.x, ray.invDirection.y, ray.invDirection.z, 0.0f );
+#endif
+
+    GLfloat closest = maxDistance;
+    bool found = false;
+
+    std::pair<GLuint, GLfloat> stack[STACK_SIZE];
+    GLuint stackSize = 0;
+    if( _intersectBox( _nodes[0], ray, closest ) != FLT_MAX ) stack[stackSize++] = { 0, 0.0f };
+    while( stackSize > 0 ) {
+        const auto [nodeIndex, entry] = stack[--stackSize];
+        if( entry > closest ) continue;
+        const Node& node = _nodes[nodeIndex];
+
+        if( node.count > 0 ) {
+            for( GLuint t = node.leftFirst; t < node.leftFirst + node.count; t++ ) {
+                GLfloat distance;
+                glm::vec2 barycentric;
+                if( _intersectTriangle( &_triangleVertices[t*3], origin, unitDirection, distance, barycentric ) && distance <= closest ) {
+                    closest = distance;
+                    found = true;
+                    hit.triangle = _triangleIds[t];
+                    hit.distance = distance;
+                    hit.barycentric = barycentric;
+                }
+            }
+            continue;
+        }
+
+        // visit the nearer child first so the further one is more likely to be skipped
+        GLuint nearChild = node.leftFirst, farChild = node.leftFirst + 1;
+        GLfloat nearEntry = _intersectBox( _nodes[nearChild], ray, closest );
+        GLfloat farEntry = _intersectBox( _nodes[farChild], ray, closest );
+        if( farEntry < nearEntry ) {
+            std::swap( nearChild, farChild );
+            std::swap( nearEntry, farEntry );
+        }
+        if( farEntry != FLT_MAX ) stack[stackSize++] = { farChild, farEntry };
+        if( nearEntry != FLT_MAX ) stack[stackSize++] = { nearChild, nearEntry };
+    }
+
+    if( found ) hit.point = origin + unitDirection * hit.distance;
+    return found;
+}
+
+[[maybe_unused]]
+inline bool CSCI441::ModelBVH::closestPoint( const glm::vec3& point, ClosestPoint& result, const GLfloat maxDistance ) const {
+    if( _nodes.empty() ) return false;
+
+    const auto boxDistanceSquared = [&point](const Node& node) {
+        const glm::vec3 offset = glm::max( glm::max( node.boundsMin - point, point - node.boundsMax ), glm::vec3(0.0f) );
+        return glm::dot( offset, offset );
+    };
+
+    GLfloat closestSquared = maxDistance < FLT_MAX ? maxDistance * maxDistance : FLT_MAX;
+    bool found = false;
+
+    std::pair<GLuint, GLfloat> stack[STACK_SIZE];
+    GLuint stackSize = 0;
+    stack[stackSize++] = { 0, boxDistanceSquared( _nodes[0] ) };
+    while( stackSize > 0 ) {
+        const auto [nodeIndex, nodeDistanceSquared] = stack[--stackSize];
+        if( nodeDistanceSquared > closestSquared ) continue;
+        const Node& node = _nodes[nodeIndex];
+
+        if( node.count > 0 ) {
+            for( GLuint t = node.leftFirst; t < node.leftFirst + node.count; t++ ) {
+                const glm::vec3 candidate = _closestPointOnTriangle( &_triangleVertices[t*3], point );
+                const glm::vec3 offset = candidate - point;
+                const GLfloat distanceSquared = glm::dot( offset, offset );
+                if( distanceSquared <= closestSquared ) {
+                    closestSquared = distanceSquared;
+                    found = true;
+                    result.triangle = _triangleIds[t];
+                    result.point = candidate;
+                }
+            }
+            continue;
+        }
+
+        GLuint nearChild = node.leftFirst, farChild = node.leftFirst + 1;
+        GLfloat nearDistance = boxDistanceSquared( _nodes[nearChild] );
+        GLfloat farDistance = boxDistanceSquared( _nodes[farChild] );
+        if( farDistance < nearDistance ) {
+            std::swap( nearChild, farChild );
+            std::swap( nearDistance, farDistance );
+        }
+        if( farDistance <= closestSquared ) stack[stackSize++] = { farChild, farDistance };
+        if( nearDistance <= closestSquared ) stack[stackSize++] = { nearChild, nearDistance };
+    }
+
+    if( found ) result.distance = std::sqrt( closestSquared );
+    return found;
+}
+
+[[maybe_unused]]
+inline GLuint CSCI441::ModelBVH::overlap( const glm::vec3& boxMin, const glm::vec3& boxMax, std::vector<GLuint>& triangles ) const {
+    if( _nodes.empty() ) return 0;
+
+    const auto boxesOverlap = [&boxMin, &boxMax](const glm::vec3& otherMin, const glm::vec3& otherMax) {
+        return glm::all( glm::lessThanEqual( otherMin, boxMax ) ) && glm::all( glm::lessThanEqual( boxMin, otherMax ) );
+    };
+    const glm::vec3 boxCenter = (boxMin + boxMax) * 0.5f;
+    const glm::vec3 boxHalfExtent = (boxMax - boxMin) * 0.5f;
+    const size_t numBefore = triangles.size();
+
+    GLuint stack[STACK_SIZE];
+    GLuint stackSize = 0;
+    stack[stackSize++] = 0;
+    while( stackSize > 0 ) {
+        const Node& node = _nodes[ stack[--stackSize] ];
+        if( !boxesOverlap( node.boundsMin, node.boundsMax ) ) continue;
+
+        if( node.count > 0 ) {
+            for( GLuint t = node.leftFirst; t < node.leftFirst + node.count; t++ ) {
+                const glm::vec3* corners = &_triangleVertices[t*3];
+                const glm::vec3 triangleMin = glm::min( corners[0], glm::min( corners[1], corners[2] ) );
+                const glm::vec3 triangleMax = glm::max( corners[0], glm::max( corners[1], corners[2] ) );
+                if( boxesOverlap( triangleMin, triangleMax ) && _triangleOverlapsBox( corners, boxCenter, boxHalfExtent ) ) {
+                    triangles.push_back( _triangleIds[t] );
+                }
+            }
+            continue;
+        }
+
+        stack[stackSize++] = node.leftFirst + 1;
+        stack[stackSize++] = node.leftFirst;
+    }
+
+    return static_cast<GLuint>( triangles.size() - numBefore );
+}
+
+[[maybe_unused]] inline GLuint CSCI441::ModelBVH::getNumberOfTriangles() const { return static_cast<GLuint>(_triangleIds.size()); }
+[[maybe_unused]] inline GLuint CSCI441::ModelBVH::getNumberOfNodes() const { return static_cast<GLuint>(_nodes.size()); }
+[[maybe_unused]] inline glm::vec3 CSCI441::ModelBVH::getBoundingBoxMin() const { return _nodes.empty() ? glm::vec3(0.0f) : _nodes[0].boundsMin; }
+[[maybe_unused]] inline glm::vec3 CSCI441::ModelBVH::getBoundingBoxMax() const { return _nodes.empty() ? glm::vec3(0.0f) : _nodes[0].boundsMax; }
+
+//**********************************************************************************
+//**********************************************************************************
+// Private helper implementations
+
+inline bool CSCI441::ModelBVH::_subdivide( std::vector<Node>& nodes, const GLuint nodeIndex, const GLuint depth, const BuildPrimitives& primitives, const bool parallel ) {
+    const GLuint first = nodes[nodeIndex].leftFirst;
+    const GLuint count = nodes[nodeIndex].count;
+    std::mutex mergeMutex;
+
+    // bound the triangles for the node and their centroids for the bins
+    Bin bounds, centroidBounds;
+    _forRange( first, count, parallel, [&](const size_t begin, const size_t end) {
+        Bin localBounds, localCentroidBounds;
+        for( size_t i = begin; i < end; i++ ) {
+            const GLuint triangle = _triangleIds[i];
+            _grow( localBounds, primitives.boundsMin[triangle], primitives.boundsMax[triangle], 1 );
+            _grow( localCentroidBounds, primitives.centroids[triangle], primitives.centroids[triangle], 1 );
+        }
+        std::lock_guard<std::mutex> lock( mergeMutex );
+        _grow( bounds, localBounds.boundsMin, localBounds.boundsMax, localBounds.count );
+        _grow( centroidBounds, localCentroidBounds.boundsMin, localCentroidBounds.boundsMax, localCentroidBounds.count );
+    });
+    nodes[nodeIndex].boundsMin = bounds.boundsMin;
+    nodes[nodeIndex].boundsMax = bounds.boundsMax;
+
+    if( count <= 1 || depth >= MAX_DEPTH ) return false;
+
+    const glm::vec3 centroidExtent = centroidBounds.boundsMax - centroidBounds.boundsMin;
+    glm::vec3 binScale( 0.0f );
+    for( int axis = 0; axis < 3; axis++ ) {
+        if( centroidExtent[axis] > 0.0f ) binScale[axis] = static_cast<GLfloat>(NUM_BINS) / centroidExtent[axis];
+    }
+    const auto binOf = [&](const GLuint triangle, const int axis) {
+        const auto bin = static_cast<GLuint>( (primitives.centroids[triangle][axis] - centroidBounds.boundsMin[axis]) * binScale[axis] );
+        return std::min( bin, NUM_BINS - 1 );
+    };
+
+    Bin bins[3][NUM_BINS];
+    _forRange( first, count, parallel, [&](const size_t begin, const size_t end) {
+        Bin localBins[3][NUM_BINS];
+        for( size_t i = begin; i < end; i++ ) {
+            const GLuint triangle = _triangleIds[i];
+            for( int axis = 0; axis < 3; axis++ ) {
+                _grow( localBins[axis][ binOf(triangle, axis) ], primitives.boundsMin[triangle], primitives.boundsMax[triangle], 1 );
+            }
+        }
+        std::lock_guard<std::mutex> lock( mergeMutex );
+        for( int axis = 0; axis < 3; axis++ ) {
+            for( GLuint b = 0; b < NUM_BINS; b++ ) {
+                _grow( bins[axis][b], localBins[axis][b].boundsMin, localBins[axis][b].boundsMax, localBins[axis][b].count );
+            }
+        }
+    });
+
+    // sweep each axis from both ends so every split between two bins is costed in one pass
+    GLfloat bestCost = FLT_MAX;
+    int bestAxis = -1;
+    GLuint bestBin = 0;
+    for( int axis = 0; axis < 3; axis++ ) {
+        if( centroidExtent[axis] <= 0.0f ) continue;
+        GLfloat leftArea[NUM_BINS - 1];
+        GLuint leftCount[NUM_BINS - 1];
+        Bin left, right;
+        for( GLuint b = 0; b < NUM_BINS - 1; b++ ) {
+            _grow( left, bins[axis][b].boundsMin, bins[axis][b].boundsMax, bins[axis][b].count );
+            leftArea[b] = _surfaceArea( left );
+            leftCount[b] = left.count;
+        }
+        for( GLuint b = NUM_BINS - 1; b > 0; b-- ) {
+            _grow( right, bins[axis][b].boundsMin, bins[axis][b].boundsMax, bins[axis][b].count );
+            if( leftCount[b - 1] == 0 || right.count == 0 ) continue;
+            const GLfloat cost = static_cast<GLfloat>(leftCount[b - 1]) * leftArea[b - 1] + static_cast<GLfloat>(right.count) * _surfaceArea( right );
+            if( cost < bestCost ) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = b;
+            }
+        }
+    }
+    if( bestAxis < 0 ) return false;
+
+    // visiting two children costs about as much as testing one more triangle, small nodes stay leaves unless that is beaten
+    const GLfloat nodeArea = _surfaceArea( bounds );
+    if( count <= MAX_LEAF_SIZE && nodeArea + bestCost >= static_cast<GLfloat>(count) * nodeArea ) return false;
+
+    const auto begin = _triangleIds.begin() + first;
+    const auto middle = std::partition( begin, begin + count, [&](const GLuint triangle) { return binOf(triangle, bestAxis) < bestBin; } );
+    const auto leftCount = static_cast<GLuint>( middle - begin );
+    if( leftCount == 0 || leftCount == count ) return false;
+
+    const auto leftChild = static_cast<GLuint>( nodes.size() );
+    nodes.push_back( { glm::vec3(0.0f), first, glm::vec3(0.0f), leftCount } );
+    nodes.push_back( { glm::vec3(0.0f), first + leftCount, glm::vec3(0.0f), count - leftCount } );
+    nodes[nodeIndex].leftFirst = leftChild;
+    nodes[nodeIndex].count = 0;
+    return true;
+}
+
+//
+//  void _buildSubtree(std::vector<Node>& nodes, GLuint depth, const BuildPrimitives& primitives)
+//
+//      Subdivides the node at the front of the list, and all of its descendents, on the calling thread
+//      Each pair of children is appended to the list, so the list is self contained and the caller offsets it
+//
+inline void CSCI441::ModelBVH::_buildSubtree( std::vector<Node>& nodes, const GLuint depth, const BuildPrimitives& primitives ) {
+    std::vector<std::pair<GLuint, GLuint>> pending = { { 0, depth } };
+    while( !pending.empty() ) {
+        const auto [nodeIndex, nodeDepth] = pending.back();
+        pending.pop_back();
+        if( _subdivide( nodes, nodeIndex, nodeDepth, primitives, false ) ) {
+            pending.emplace_back( nodes[nodeIndex].leftFirst, nodeDepth + 1 );
+            pending.emplace_back( nodes[nodeIndex].leftFirst + 1, nodeDepth + 1 );
+        }
+    }
+}
+
+//
+//  GLfloat _intersectBox(const Node& node, const Ray& ray, GLfloat maxDistance)
+//
+//      Slab test of the ray against the bounds of a node, testing all three axes at once with SSE when available
+//      Returns the distance the ray enters the box, or FLT_MAX if it misses the box or enters it past maxDistance
+//
+inline GLfloat CSCI441::ModelBVH::_intersectBox( const Node& node, const Ray& ray, const GLfloat maxDistance ) const {
+    GLfloat entry, exit;
+#ifdef CSCI441_INTERNAL_BVH_SSE
+    // the fourth lane holds the child or triangle index and is left out of the reduction
+    const __m128 t1 = _mm_mul_ps( _mm_sub_ps( _mm_loadu_ps( &node.boundsMin.x ), ray.origin4 ), ray.invDirection4 );
+    const __m128 t2 = _mm_mul_ps( _mm_sub_ps( _mm_loadu_ps( &node.boundsMax.x ), ray.origin4 ), ray.invDirection4 );
+    const __m128 tNear = _mm_min_ps( t1, t2 );
+    const __m128 tFar = _mm_max_ps( t1, t2 );
+    entry = _mm_cvtss_f32( _mm_max_ss( _mm_max_ss( tNear, _mm_shuffle_ps( tNear, tNear, _MM_SHUFFLE(1, 1, 1, 1) ) ), _mm_movehl_ps( tNear, tNear ) ) );
+    exit = _mm_cvtss_f32( _mm_min_ss( _mm_min_ss( tFar, _mm_shuffle_ps( tFar, tFar, _MM_SHUFFLE(1, 1, 1, 1) ) ), _mm_movehl_ps( tFar, tFar ) ) );
+#else
+    const glm::vec3 t1 = (node.boundsMin - ray.origin) * ray.invDirection;
+    const glm::vec3 t2 = (node.boundsMax - ray.origin) * ray.invDirection;
+    const glm::vec3 tNear = glm::min( t1, t2 );
+    const glm::vec3 tFar = glm::max( t1, t2 );
+    entry = std::max( tNear.x, std::max( tNear.y, tNear.z ) );
+    exit = std::min( tFar.x, std::min( tFar.y, tFar.z ) );
+#endif
+    entry = std::max( entry, 0.0f );
+    return (entry <= exit && entry <= maxDistance) ? entry : FLT_MAX;
+}
+
+inline void CSCI441::ModelBVH::_forRange( const GLuint first, const GLuint count, const bool parallel, const std::function<void(size_t, size_t)>& body ) {
+    if( parallel ) {
+        CSCI441_INTERNAL::parallelFor( count, PARALLEL_MIN_TRIANGLES / 4, [&](const size_t begin, const size_t end) {
+            if( begin < end ) body( first + begin, first + end );
+        });
+    } else {
+        body( first, first + count );
+    }
+}
+
+inline void CSCI441::ModelBVH::_grow( Bin& bin, const glm::vec3& boundsMin, const glm::vec3& boundsMax, const GLuint count ) {
+    if( count == 0 ) return;
+    bin.boundsMin = glm::min( bin.boundsMin, boundsMin );
+    bin.boundsMax = glm::max( bin.boundsMax, boundsMax );
+    bin.count += count;
+}
+
+inline GLfloat CSCI441::ModelBVH::_surfaceArea( const Bin& bin ) {
+    if( bin.count == 0 ) return 0.0f;
+    const glm::vec3 extent = bin.boundsMax - bin.boundsMin;
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+//
+//  bool _intersectTriangle(const glm::vec3* corners, const glm::vec3& origin, const glm::vec3& direction, GLfloat& distance, glm::vec2& barycentric)
+//
+//      Moller-Trumbore ray triangle intersection, hitting the triangle from either side
+//
+inline bool CSCI441::ModelBVH::_intersectTriangle( const glm::vec3* corners, const glm::vec3& origin, const glm::vec3& direction, GLfloat& distance, glm::vec2& barycentric ) {
+    const glm::vec3 edge1 = corners[1] - corners[0];
+    const glm::vec3 edge2 = corners[2] - corners[0];
+    const glm::vec3 p = glm::cross( direction, edge2 );
+    const GLfloat determinant = glm::dot( edge1, p );
+    if( determinant == 0.0f ) return false;
+
+    const GLfloat invDeterminant = 1.0f / determinant;
+    const glm::vec3 s = origin - corners[0];
+    const GLfloat u = glm::dot( s, p ) * invDeterminant;
+    if( u < 0.0f || u > 1.0f ) return false;
+    const glm::vec3 q = glm::cross( s, edge1 );
+    const GLfloat v = glm::dot( direction, q ) * invDeterminant;
+    if( v < 0.0f || u + v > 1.0f ) return false;
+
+    distance = glm::dot( edge2, q ) * invDeterminant;
+    barycentric = glm::vec2( u, v );
+    return distance >= 0.0f;
+}
+
+//
+//  glm::vec3 _closestPointOnTriangle(const glm::vec3* corners, const glm::vec3& point)
+//
+//      Finds which corner, edge, or the face of the triangle is closest to the point from its barycentric coordinates
+//      and projects the point onto it
+//
+inline glm::vec3 CSCI441::ModelBVH::_closestPointOnTriangle( const glm::vec3* corners, const glm::vec3& point ) {
+    const glm::vec3& a = corners[0];
+    const glm::vec3& b = corners[1];
+    const glm::vec3& c = corners[2];
+    const glm::vec3 ab = b - a, ac = c - a, ap = point - a;
+
+    const GLfloat d1 = glm::dot( ab, ap ), d2 = glm::dot( ac, ap );
+    if( d1 <= 0.0f && d2 <= 0.0f ) return a;
+
+    const glm::vec3 bp = point - b;
+    const GLfloat d3 = glm::dot( ab, bp ), d4 = glm::dot( ac, bp );
+    if( d3 >= 0.0f && d4 <= d3 ) return b;
+
+    const GLfloat vc = d1 * d4 - d3 * d2;
+    if( vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f ) return a + ab * (d1 / (d1 - d3));
+
+    const glm::vec3 cp = point - c;
+    const GLfloat d5 = glm::dot( ab, cp ), d6 = glm::dot( ac, cp );
+    if( d6 >= 0.0f && d5 <= d6 ) return c;
+
+    const GLfloat vb = d5 * d2 - d1 * d6;
+    if( vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f ) return a + ac * (d2 / (d2 - d6));
+
+    const GLfloat va = d3 * d6 - d5 * d4;
+    if( va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f ) return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+    const GLfloat denominator = va + vb + vc;
+    if( denominator == 0.0f ) return a;
+    return a + ab * (vb / denominator) + ac * (vc / denominator);
+}
+
+//
+//  bool _triangleOverlapsBox(const glm::vec3* corners, const glm::vec3& boxCenter, const glm::vec3& boxHalfExtent)
+//
+//      Separating axis test of a triangle against a box, the caller has already tested the box's own axes
+//      Tests the triangle's normal and the cross product of each triangle edge with each box axis
+//
+inline bool CSCI441::ModelBVH::_triangleOverlapsBox( const glm::vec3* corners, const glm::vec3& boxCenter, const glm::vec3& boxHalfExtent ) {
+    const glm::vec3 v[3] = { corners[0] - boxCenter, corners[1] - boxCenter, corners[2] - boxCenter };
+    const glm::vec3 edges[3] = { v[1] - v[0], v[2] - v[1], v[0] - v[2] };
+
+    for( const auto& edge : edges ) {
+        for( int axis = 0; axis < 3; axis++ ) {
+            glm::vec3 boxAxis( 0.0f );
+            boxAxis[axis] = 1.0f;
+            const glm::vec3 separatingAxis = glm::cross( boxAxis, edge );
+            const GLfloat p0 = glm::dot( separatingAxis, v[0] ), p1 = glm::dot( separatingAxis, v[1] ), p2 = glm::dot( separatingAxis, v[2] );
+            const GLfloat radius = glm::dot( boxHalfExtent, glm::abs( separatingAxis ) );
+            if( std::min( p0, std::min( p1, p2 ) ) > radius || std::max( p0, std::max( p1, p2 ) ) < -radius ) return false;
+        }
+    }
+
+    const glm::vec3 normal = glm::cross( edges[0], edges[1] );
+    return std::fabs( glm::dot( normal, v[0] ) ) <= glm::dot( boxHalfExtent, glm::abs( normal ) );
+}
+
+#endif // CSCI441_MODEL_BVH_HPP
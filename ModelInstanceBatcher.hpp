@@ -0,0 +1,351 @@
+/** @file ModelInstanceBatcher.hpp
+ * @brief Culls and draws many instances of a model with a single indirect draw call
+ * @author Dr. Jeffrey Paone
+ *
+ * @copyright MIT License Copyright (c) 2026 Dr. Jeffrey Paone
+ *
+ *	These functions, classes, and constants help minimize common
+ *	code that needs to be written.
+ *
+ *	@warning NOTE: This header file will only work with OpenGL 4.3+
+ *	@warning NOTE: This header file depends upon GLAD (or alternatively GLEW)
+ *	@warning NOTE: This header file depends upon glm
+ */
+
+#ifndef CSCI441_MODEL_INSTANCE_BATCHER_HPP
+#define CSCI441_MODEL_INSTANCE_BATCHER_HPP
+
+#include "ModelLoader.hpp"
+#include "OpenGLUtils.hpp"
+
+#ifdef CSCI441_USE_GLEW
+    #include <GL/glew.h>
+#else
+    #include <glad/gl.h>
+#endif
+
+#include <glm/glm.hpp>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #include <xmmintrin.h>
+    #define CSCI441_INTERNAL_CULL_SSE
+#endif
+
+#include <cmath>
+#include <vector>
+
+//******************************************************************************
+
+namespace CSCI441 {
+
+    /**
+     * @class ModelInstanceBatcher
+     * @brief Frustum culls the instances of a model on the CPU and draws the visible ones with one call to glMultiDrawElementsIndirect()
+     * @note Each instance is bounded by the model's bounding box transformed by the instance's model matrix.  Bounds are
+     * stored one component per array so several instances are tested against each frustum plane at once.
+     * @note The visible instances are written to an instance buffer of CSCI441::InstanceData and every material range of
+     * the model becomes one command in the draw indirect buffer, so the draw submitted does not depend on the number of instances.
+     */
+    class [[maybe_unused]] ModelInstanceBatcher final {
+    public:
+        /**
+         * @note must use ModelInstanceBatcher(const ModelLoader&)
+         */
+        ModelInstanceBatcher() = delete;
+
+        /**
+         * @brief Creates an empty batch of instances of a model
+         * @param model model every instance draws, must stay alive and loaded while the batch is used
+         * @note the model must be loaded before the batch is created
+         */
+        [[maybe_unused]] explicit ModelInstanceBatcher(const ModelLoader& model);
+        /**
+         * @brief Deletes the instance and draw indirect buffers from the GPU
+         */
+        ~ModelInstanceBatcher();
+
+        /**
+         * @brief do not allow batches to be copied
+         */
+        ModelInstanceBatcher(const ModelInstanceBatcher&) = delete;
+        /**
+         * @brief do not allow batches to be copied
+         */
+        ModelInstanceBatcher& operator=(const ModelInstanceBatcher&) = delete;
+
+        /**
+         * @brief Move Constructor an existing batch
+         */
+        ModelInstanceBatcher(ModelInstanceBatcher&&) noexcept;
+        /**
+         * @brief Move Assign an existing batch
+         * @return this now reconfigured batch
+         */
+        ModelInstanceBatcher& operator=(ModelInstanceBatcher&&) noexcept;
+
+        /**
+         * @brief Adds an instance of the model to the batch
+         * @param modelMatrix transforms the instance into world space
+         * @param color color of the instance
+         * @return index of the instance within the batch
+         */
+        [[maybe_unused]] GLuint addInstance(const glm::mat4& modelMatrix, const glm::vec4& color = glm::vec4(1.0f));
+        /**
+         * @brief Moves or recolors an instance already in the batch
+         * @param index index of the instance as returned by addInstance()
+         * @param modelMatrix transforms the instance into world space
+         * @param color color of the instance
+         */
+        [[maybe_unused]] void setInstance(GLuint index, const glm::mat4& modelMatrix, const glm::vec4& color = glm::vec4(1.0f));
+        /**
+         * @brief Removes every instance from the batch
+         */
+        [[maybe_unused]] void clearInstances();
+        /**
+         * @brief Return the number of instances in the batch
+         * @return number of instances
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getNumInstances() const;
+
+        /**
+         * @brief Tests every instance against the view frustum and uploads the visible instances for draw()
+         * @param viewProjectionMatrix matrix transforming world space into clip space
+         * @return number of visible instances
+         */
+        [[maybe_unused]] GLuint cull(const glm::mat4& viewProjectionMatrix);
+        /**
+         * @brief Return the number of instances that passed the last call to cull()
+         * @return number of visible instances
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getNumVisibleInstances() const;
+        /**
+         * @brief Return the buffer the visible instances are uploaded to
+         * @return handle of a buffer of CSCI441::InstanceData
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getInstanceBuffer() const;
+
+        /**
+         * @brief Renders every instance that passed the last call to cull() with a single draw call
+         * @param materialBlockBinding uniform buffer binding point to bind the model's material records to
+         * @param diffuseTexture texture number to bind diffuse texture map to
+         * @return true if draw succeeded, false otherwise
+         * @note see ModelLoader::drawIndirect() for how the shader reads materials and instances
+         */
+        [[maybe_unused]] bool draw(GLuint materialBlockBinding, GLenum diffuseTexture = GL_TEXTURE0) const;
+
+    private:
+        const ModelLoader* _model;
+        glm::vec3 _boxCenter;
+        glm::vec3 _boxExtent;
+
+        std::vector<InstanceData> _instances;
+        // world space bounds of each instance, one component per array
+        std::vector<GLfloat> _centerX, _centerY, _centerZ;
+        std::vector<GLfloat> _extentX, _extentY, _extentZ;
+
+        std::vector<CSCI441_INTERNAL::DrawElementsIndirectCommand> _commands;
+        std::vector<InstanceData> _visibleInstances;
+
+        GLuint _instanceBufferd;
+        GLuint _indirectBufferd;
+
+        void _setBounds(GLuint index, const glm::mat4& modelMatrix);
+
+        void _cleanupSelf();
+        void _moveFromSrc(ModelInstanceBatcher&);
+    };
+}
+
+//**********************************************************************************
+//**********************************************************************************
+// Outward facing function implementations
+
+[[maybe_unused]]
+inline CSCI441::ModelInstanceBatcher::ModelInstanceBatcher( const ModelLoader& model ) :
+    _model(&model),
+    _boxCenter( (model.getBoundingBoxMin() + model.getBoundingBoxMax()) * 0.5f ),
+    _boxExtent( (model.getBoundingBoxMax() - model.getBoundingBoxMin()) * 0.5f ),
+    _commands( model.getDrawCommands() ),
+    _instanceBufferd(0),
+    _indirectBufferd(0)
+{
+    glGenBuffers( 1, &_instanceBufferd );
+    glGenBuffers( 1, &_indirectBufferd );
+}
+
+inline CSCI441::ModelInstanceBatcher::~ModelInstanceBatcher() {
+    _cleanupSelf();
+}
+
+inline CSCI441::ModelInstanceBatcher::ModelInstanceBatcher( ModelInstanceBatcher&& src ) noexcept :
+    _model(nullptr),
+    _boxCenter(0.0f),
+    _boxExtent(0.0f),
+    _instanceBufferd(0),
+    _indirectBufferd(0)
+{
+    _moveFromSrc(src);
+}
+
+inline CSCI441::ModelInstanceBatcher& CSCI441::ModelInstanceBatcher::operator=( ModelInstanceBatcher&& src ) noexcept {
+    if( this != &src ) {
+        _cleanupSelf();
+        _moveFromSrc(src);
+    }
+    return *this;
+}
+
+[[maybe_unused]]
+inline GLuint CSCI441::ModelInstanceBatcher::addInstance( const glm::mat4& modelMatrix, const glm::vec4& color ) {
+    const auto index = static_cast<GLuint>(_instances.size());
+    _instances.push_back( { modelMatrix, color } );
+    for( auto* component : { &_centerX, &_centerY, &_centerZ, &_extentX, &_extentY, &_extentZ } ) {
+        component->push_back( 0.0f );
+    }
+    _setBounds( index, modelMatrix );
+    return index;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelInstanceBatcher::setInstance( const GLuint index, const glm::mat4& modelMatrix, const glm::vec4& color ) {
+    if( index >= _instances.size() ) return;
+    _instances[index] = { modelMatrix, color };
+    _setBounds( index, modelMatrix );
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelInstanceBatcher::clearInstances() {
+    _instances.clear();
+    for( auto* component : { &_centerX, &_centerY, &_centerZ, &_extentX, &_extentY, &_extentZ } ) {
+        component->clear();
+    }
+    _visibleInstances.clear();
+}
+
+[[maybe_unused]] inline GLuint CSCI441::ModelInstanceBatcher::getNumInstances() const { return static_cast<GLuint>(_instances.size()); }
+[[maybe_unused]] inline GLuint CSCI441::ModelInstanceBatcher::getNumVisibleInstances() const { return static_cast<GLuint>(_visibleInstances.size()); }
+[[maybe_unused]] inline GLuint CSCI441::ModelInstanceBatcher::getInstanceBuffer() const { return _instanceBufferd; }
+
+[[maybe_unused]]
+inline GLuint CSCI441::ModelInstanceBatcher::cull( const glm::mat4& viewProjectionMatrix ) {
+    // frustum planes in world space, extracted from the rows of the combined matrix
+    glm::vec4 frustumPlanes[6];
+    const glm::mat4 rows = glm::transpose( viewProjectionMatrix );
+    for( int i = 0; i < 3; i++ ) {
+        frustumPlanes[i*2]     = rows[3] + rows[i];
+        frustumPlanes[i*2 + 1] = rows[3] - rows[i];
+    }
+
+    // a box is outside a plane when even its corner furthest along the plane normal is behind it
+    const size_t numInstances = _instances.size();
+    _visibleInstances.clear();
+    size_t i = 0;
+#ifdef CSCI441_INTERNAL_CULL_SSE
+    const __m128 signMask = _mm_set1_ps( -0.0f );
+    __m128 planeX[6], planeY[6], planeZ[6], planeW[6], absX[6], absY[6], absZ[6];
+    for( int p = 0; p < 6; p++ ) {
+        planeX[p] = _mm_set1_ps( frustumPlanes[p].x );
+        planeY[p] = _mm_set1_ps( frustumPlanes[p].y );
+        planeZ[p] = _mm_set1_ps( frustumPlanes[p].z );
+        planeW[p] = _mm_set1_ps( frustumPlanes[p].w );
+        absX[p] = _mm_andnot_ps( signMask, planeX[p] );
+        absY[p] = _mm_andnot_ps( signMask, planeY[p] );
+        absZ[p] = _mm_andnot_ps( signMask, planeZ[p] );
+    }
+    for( ; i + 4 <= numInstances; i += 4 ) {
+        const __m128 cx = _mm_loadu_ps( &_centerX[i] ), cy = _mm_loadu_ps( &_centerY[i] ), cz = _mm_loadu_ps( &_centerZ[i] );
+        const __m128 ex = _mm_loadu_ps( &_extentX[i] ), ey = _mm_loadu_ps( &_extentY[i] ), ez = _mm_loadu_ps( &_extentZ[i] );
+        __m128 inside = _mm_cmpeq_ps( _mm_setzero_ps(), _mm_setzero_ps() );
+        for( int p = 0; p < 6; p++ ) {
+            const __m128 distance = _mm_add_ps( _mm_add_ps( _mm_mul_ps( planeX[p], cx ), _mm_mul_ps( planeY[p], cy ) ), _mm_add_ps( _mm_mul_ps( planeZ[p], cz ), planeW[p] ) );
+            const __m128 radius = _mm_add_ps( _mm_add_ps( _mm_mul_ps( absX[p], ex ), _mm_mul_ps( absY[p], ey ) ), _mm_mul_ps( absZ[p], ez ) );
+            inside = _mm_and_ps( inside, _mm_cmpge_ps( _mm_add_ps( distance, radius ), _mm_setzero_ps() ) );
+        }
+        const int mask = _mm_movemask_ps( inside );
+        for( int lane = 0; lane < 4; lane++ ) {
+            if( mask & (1 << lane) ) _visibleInstances.push_back( _instances[i + lane] );
+        }
+    }
+#endif
+    for( ; i < numInstances; i++ ) {
+        bool inside = true;
+        for( const auto& plane : frustumPlanes ) {
+            const GLfloat distance = plane.x * _centerX[i] + plane.y * _centerY[i] + plane.z * _centerZ[i] + plane.w;
+            const GLfloat radius = std::fabs( plane.x ) * _extentX[i] + std::fabs( plane.y ) * _extentY[i] + std::fabs( plane.z ) * _extentZ[i];
+            if( distance + radius < 0.0f ) {
+                inside = false;
+                break;
+            }
+        }
+        if( inside ) _visibleInstances.push_back( _instances[i] );
+    }
+
+    const auto numVisible = static_cast<GLuint>(_visibleInstances.size());
+    for( auto& command : _commands ) {
+        command.instanceCount = numVisible;
+    }
+
+    // orphan the previous frame's storage rather than waiting for the GPU to finish reading it
+    glBindBuffer( GL_ARRAY_BUFFER, _instanceBufferd );
+    glBufferData( GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(InstanceData) * _visibleInstances.size()), _visibleInstances.data(), GL_STREAM_DRAW );
+    glBindBuffer( GL_DRAW_INDIRECT_BUFFER, _indirectBufferd );
+    glBufferData( GL_DRAW_INDIRECT_BUFFER, static_cast<GLsizeiptr>(sizeof(CSCI441_INTERNAL::DrawElementsIndirectCommand) * _commands.size()), _commands.data(), GL_STREAM_DRAW );
+
+    return numVisible;
+}
+
+[[maybe_unused]]
+inline bool CSCI441::ModelInstanceBatcher::draw( const GLuint materialBlockBinding, const GLenum diffuseTexture ) const {
+    if( _model == nullptr ) return false;
+    if( _visibleInstances.empty() || _commands.empty() ) return true;
+    return _model->drawIndirect( _indirectBufferd, static_cast<GLsizei>(_commands.size()), _instanceBufferd, materialBlockBinding, diffuseTexture );
+}
+
+//**********************************************************************************
+//**********************************************************************************
+// Private helper implementations
+
+inline void CSCI441::ModelInstanceBatcher::_setBounds( const GLuint index, const glm::mat4& modelMatrix ) {
+    // the box stays axis aligned by growing its extent by the absolute value of the rotation and scale
+    const glm::vec3 center = glm::vec3( modelMatrix * glm::vec4( _boxCenter, 1.0f ) );
+    const glm::mat3 absolute = glm::mat3( glm::abs( glm::vec3( modelMatrix[0] ) ), glm::abs( glm::vec3( modelMatrix[1] ) ), glm::abs( glm::vec3( modelMatrix[2] ) ) );
+    const glm::vec3 extent = absolute * _boxExtent;
+    _centerX[index] = center.x; _centerY[index] = center.y; _centerZ[index] = center.z;
+    _extentX[index] = extent.x; _extentY[index] = extent.y; _extentZ[index] = extent.z;
+}
+
+inline void CSCI441::ModelInstanceBatcher::_cleanupSelf() {
+    glDeleteBuffers( 1, &_instanceBufferd );
+    _instanceBufferd = 0;
+    glDeleteBuffers( 1, &_indirectBufferd );
+    _indirectBufferd = 0;
+
+    _model = nullptr;
+    clearInstances();
+    _commands.clear();
+}
+
+inline void CSCI441::ModelInstanceBatcher::_moveFromSrc( ModelInstanceBatcher& src ) {
+    _model = src._model;
+    src._model = nullptr;
+
+    _boxCenter = src._boxCenter;
+    _boxExtent = src._boxExtent;
+
+    _instances = std::move( src._instances );
+    _centerX = std::move( src._centerX );
+    _centerY = std::move( src._centerY );
+    _centerZ = std::move( src._centerZ );
+    _extentX = std::move( src._extentX );
+    _extentY = std::move( src._extentY );
+    _extentZ = std::move( src._extentZ );
+    _commands = std::move( src._commands );
+    _visibleInstances = std::move( src._visibleInstances );
+
+    _instanceBufferd = src._instanceBufferd;
+    src._instanceBufferd = 0;
+    _indirectBufferd = src._indirectBufferd;
+    src._indirectBufferd = 0;
+}
+
+#endif // CSCI441_MODEL_INSTANCE_BATCHER_HPP
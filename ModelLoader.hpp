@@ -7,8 +7,9 @@
   *	This class will load and render object files.  Currently, supports:
   *		.obj + .mtl
   *		.off
-  *     .ply
-  *		.stl
+  *     .ply (ASCII and binary, with faces)
+  *		.stl (ASCII and binary)
+  *		.c441mesh (binary cache written by saveCache())
   *
   *	@warning NOTE: This header file will only work with OpenGL 3.0+
   *	@warning NOTE: This header file depends upon GLAD (or GLEW), glm, stb_image
@@ -20,6 +21,9 @@
 #include "constants.h"
 #include "LogUtils.hpp"
 #include "modelMaterial.hpp"
+#include "OpenGLUtils.hpp"
+#include "ModelLoader_types.hpp"
+#include "GeometryArena.hpp"
 
 #ifdef CSCI441_USE_GLEW
     #include <GL/glew.h>
@@ -28,19 +32,29 @@
 #endif
 
 #include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
 
 #ifndef CSCI441_TEXTURE_UTILS_HPP
 	#include <stb_image.h>
 #endif
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <ctime>
+#include <chrono>
 #include <fstream>
-#include <sstream>
+#include <functional>
+#include <future>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -54,6 +68,86 @@ namespace CSCI441 {
      */
 	class [[maybe_unused]] ModelLoader final {
 	public:
+		/**
+		 * @brief Measurements taken while a model was loaded
+		 * @note phases that did not run during the load are 0
+		 */
+		struct LoadStats {
+			/**
+			 * @brief file the model was loaded from
+			 */
+			std::string filename;
+			/**
+			 * @brief time spent opening the file and finding its structure (headers, chunk boundaries)
+			 */
+			double scanMilliseconds = 0.0;
+			/**
+			 * @brief time spent reading the geometry of the file
+			 * @note streamed loads upload each chunk of vertices as it is parsed, that upload is also counted in gpuUploadMilliseconds
+			 */
+			double parseMilliseconds = 0.0;
+			/**
+			 * @brief time spent collapsing duplicate vertices
+			 */
+			double dedupMilliseconds = 0.0;
+			/**
+			 * @brief time spent generating vertex normals
+			 */
+			double normalGenerationMilliseconds = 0.0;
+			/**
+			 * @brief time spent generating vertex tangents
+			 */
+			double tangentGenerationMilliseconds = 0.0;
+			/**
+			 * @brief time spent merging material ranges, optimizing, building meshlets and levels of detail
+			 */
+			double optimizationMilliseconds = 0.0;
+			/**
+			 * @brief time spent reading material libraries
+			 */
+			double mtlMilliseconds = 0.0;
+			/**
+			 * @brief time the decode pool spent decoding textures this model was the first to use
+			 * @note decoding overlaps parsing, so this is not part of totalMilliseconds
+			 */
+			double textureDecodeMilliseconds = 0.0;
+			/**
+			 * @brief time spent copying buffers and textures to the GPU
+			 */
+			double gpuUploadMilliseconds = 0.0;
+			/**
+			 * @brief time spent in loadModelFile()
+			 */
+			double totalMilliseconds = 0.0;
+			/**
+			 * @brief size of the model, material, and texture files that were read
+			 */
+			size_t bytesRead = 0;
+			/**
+			 * @brief most physical memory the process used during the load, 0 if it could not be queried
+			 */
+			size_t peakResidentSetSize = 0;
+			/**
+			 * @brief number of vertices after duplicates were collapsed
+			 */
+			GLuint numVertices = 0;
+			/**
+			 * @brief number of triangles in the full detail model
+			 */
+			GLuint numTriangles = 0;
+
+			/**
+			 * @brief Return the number of unique vertices for each triangle corner.
+			 * @return ratio in (0, 1], lower means more vertices are shared, 0 if no triangles were loaded
+			 */
+			[[nodiscard]] double uniqueVertexRatio() const { return numTriangles == 0 ? 0.0 : static_cast<double>(numVertices) / (3.0 * numTriangles); }
+			/**
+			 * @brief Formats the measurements as a JSON object.
+			 * @return JSON text
+			 */
+			[[nodiscard]] std::string toJSON() const;
+		};
+
 		/**
 		 * @brief Creates an empty model
          */
@@ -92,9 +186,58 @@ namespace CSCI441 {
          * @param filename file to load model from
          * @param INFO flag to control if informational messages should be displayed
          * @param ERRORS flag to control if error messages should be displayed
+         * @param numThreads number of threads to parse the file with, zero uses every hardware thread
          * @return true if load succeeded, false otherwise
+         * @note only OBJ files are parsed with multiple threads, all other formats are parsed on the calling thread
+         * @note the time spent in each phase of the load is available from getLoadStats() once the load returns
+         * @note PLY files must declare a face element, point clouds are not loaded
+         */
+		bool loadModelFile( std::string filename, bool INFO = true, bool ERRORS = true, GLuint numThreads = 1 );
+
+		/**
+         * @brief Loads a model in the background without blocking the GL thread
+         * @param filename name of file to load
+         * @param INFO flag to control if informational messages should be displayed
+         * @param ERRORS flag to control if error messages should be displayed
+         * @param numThreads number of threads to parse the file with, zero uses every hardware thread
+         * @return future that becomes true once the model is ready to draw, or false if it could not be loaded
+         * @note The model is parsed and its textures decoded on a worker thread.  The GL buffers and textures are then
+         * filled by continueAsyncLoad(), which must be called from the GL thread (e.g. once per frame) until it returns true.
+         * @note The loader settings in effect when this is called apply to the load, changing them afterwards does not
+         * affect it.  The loader may be moved while the load is in progress.
+         * @warning Do not draw or configure the model until the future is ready
          */
-		bool loadModelFile( std::string filename, bool INFO = true, bool ERRORS = true );
+		[[maybe_unused]] std::future<bool> loadModelFileAsync( std::string filename, bool INFO = true, bool ERRORS = true, GLuint numThreads = 1 );
+		/**
+         * @brief Continues an asynchronous load, uploading data for at most the given time
+         * @param timeBudgetMilliseconds time to spend uploading before returning
+         * @return true once no asynchronous load is pending
+         * @note Must be called from the GL thread.  Buffers are copied in chunks of at most 1MB through unsynchronized
+         * mappings and textures are uploaded one at a time, so each call runs for roughly the time budget.
+         */
+		[[maybe_unused]] bool continueAsyncLoad( GLfloat timeBudgetMilliseconds = 2.0f );
+
+		/**
+		 * @brief Saves the loaded model to a binary mesh cache that loads without any parsing
+		 * @param cacheFilename file to write the cache to, an empty name writes the cache next to the model file
+		 * @param ERRORS flag to control if error messages should be displayed
+		 * @return true if the cache was written, false otherwise
+		 * @note the cache holds the final attribute arrays, indices, materials, and material index ranges.  Textures
+		 * are stored by filename and loaded from their images when the cache is loaded.
+		 * @note loadModelFile() automatically loads "<model file>.c441mesh" in place of the model file when the cache
+		 * was saved from the model file at its current size and modification time, is at least as new as every material
+		 * library it read, and was saved with the same auto generation and welding options.  Material libraries are checked by the path they were opened through, so a
+		 * library that can no longer be found there is not checked.
+		 */
+		[[maybe_unused]] bool saveCache( std::string cacheFilename = "", bool ERRORS = true ) const;
+
+		/**
+		 * @brief Saves the measurements of the last load as JSON
+		 * @param statsFilename file to write the measurements to, an empty name writes "<model file>.stats.json"
+		 * @param ERRORS flag to control if error messages should be displayed
+		 * @return true if the file was written, false otherwise
+		 */
+		[[maybe_unused]] bool saveLoadStats( std::string statsFilename = "", bool ERRORS = true ) const;
 
 		/**
 		 * @brief Enables VBO attribute array locations
@@ -102,8 +245,20 @@ namespace CSCI441 {
          * @param normalLocation attribute location of vertex normal
          * @param texCoordLocation attribute location of vertex texture coordinate
          * @param tangentLocation attribute location of vertex tangent
+         * @param colorLocation attribute location of vertex color
+         * @note the color attribute is only enabled if the model contains vertex colors
 		 */
-        [[maybe_unused]] void setAttributeLocations(GLint positionLocation, GLint normalLocation = -1, GLint texCoordLocation = -1, GLint tangentLocation = -1) const;
+        [[maybe_unused]] void setAttributeLocations(GLint positionLocation, GLint normalLocation = -1, GLint texCoordLocation = -1, GLint tangentLocation = -1, GLint colorLocation = -1) const;
+
+        /**
+         * @brief Sets the attribute locations for the per instance model matrix and color read by drawInstanced()
+         * @param modelMatrixLocation first of four consecutive attribute locations of the mat4 model matrix
+         * @param colorLocation attribute location of the vec4 instance color
+         * @param storageBlockBinding shader storage block binding to bind the instance buffer to when neither location is set
+         * @note leave both locations as -1 to read the CSCI441::InstanceData records from a std430 storage block
+         * indexed by gl_InstanceID instead of from vertex attributes
+         */
+        [[maybe_unused]] void setInstanceAttributeLocations(GLint modelMatrixLocation, GLint colorLocation = -1, GLuint storageBlockBinding = 0);
 
         /**
          * @brief Renders a model
@@ -119,6 +274,103 @@ namespace CSCI441 {
                    GLint matDiffLocation = -1, GLint matSpecLocation = -1, GLint matShinLocation = -1, GLint matAmbLocation = -1,
                    GLenum diffuseTexture = GL_TEXTURE0 ) const;
 
+        /**
+         * @brief Renders every material range of a model with a single draw call
+         * @param materialBlockBinding uniform buffer binding point to bind the material records to
+         * @param diffuseTexture texture number to bind diffuse texture map to
+         * @return true if draw succeeded, false otherwise
+         * @note Material parameters are not set as uniforms.  The records are stored in a uniform buffer in the std140
+         * layout <tt>struct Material { vec4 ambient; vec4 diffuse; vec4 specular; float shininess; };</tt> with one
+         * record per draw, so the shader reads <tt>materials[gl_DrawID]</tt> (GLSL 4.60 or ARB_shader_draw_parameters).
+         * @note When the context provides neither, each range is drawn with its own call and only its record bound, so
+         * the shader reads <tt>materials[0]</tt>
+         * @note Ranges are drawn grouped by diffuse texture with one call per texture, binding each texture before its
+         * call.  <tt>gl_DrawID</tt> counts from zero within each call and the records are bound to match.  Materials
+         * without a diffuse map leave the texture bound to diffuseTexture unchanged
+         */
+        [[maybe_unused]] bool drawBatched( GLuint materialBlockBinding, GLenum diffuseTexture = GL_TEXTURE0 ) const;
+
+        /**
+         * @brief Renders many copies of a model, each with its own transform and color
+         * @param instanceCount number of copies to draw
+         * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount records
+         * @param shaderProgramHandle shader program handle that
+         * @param matDiffLocation uniform location of material diffuse component
+         * @param matSpecLocation uniform location of material specular component
+         * @param matShinLocation uniform location of material shininess component
+         * @param matAmbLocation uniform location of material ambient component
+         * @param diffuseTexture texture number to bind diffuse texture map to
+         * @return true if draw succeeded, false otherwise
+         * @note every copy is drawn by the same call, so the number of draw calls matches draw() regardless of instanceCount
+         * @note setInstanceAttributeLocations() selects how the shader reads the instance buffer
+         */
+        [[maybe_unused]] bool drawInstanced( GLsizei instanceCount, GLuint instanceBuffer, GLuint shaderProgramHandle,
+                   GLint matDiffLocation = -1, GLint matSpecLocation = -1, GLint matShinLocation = -1, GLint matAmbLocation = -1,
+                   GLenum diffuseTexture = GL_TEXTURE0 ) const;
+
+        /**
+         * @brief Renders the draw commands stored in a draw indirect buffer with a single call
+         * @param indirectBuffer buffer of CSCI441_INTERNAL::DrawElementsIndirectCommand as returned by getDrawCommands()
+         * @param drawCount number of commands to draw
+         * @param instanceBuffer buffer of CSCI441::InstanceData the commands' instances are read from
+         * @param materialBlockBinding uniform buffer binding point to bind the material records to
+         * @param diffuseTexture texture number to bind diffuse texture map to
+         * @return true if draw succeeded, false otherwise
+         * @note materials are read as with drawBatched() and instances as with drawInstanced(), a shader reading
+         * instances from a storage block must index it by <tt>gl_BaseInstance + gl_InstanceID</tt>
+         * @note requires OpenGL 4.6 or ARB_shader_draw_parameters for the shader to read <tt>materials[gl_DrawID]</tt>
+         * @note every command is drawn by one call, so only the diffuse texture of the first command's material is bound
+         */
+        [[maybe_unused]] bool drawIndirect( GLuint indirectBuffer, GLsizei drawCount, GLuint instanceBuffer,
+                   GLuint materialBlockBinding, GLenum diffuseTexture = GL_TEXTURE0 ) const;
+
+        /**
+         * @brief Renders the meshlets of a model that may be visible
+         * @param shaderProgramHandle shader program handle that
+         * @param modelViewProjectionMatrix matrix transforming the model into clip space, used to frustum cull each meshlet
+         * @param eyePosition camera position in the model's object space, used to cull meshlets that entirely face away from the camera
+         * @param matDiffLocation uniform location of material diffuse component
+         * @param matSpecLocation uniform location of material specular component
+         * @param matShinLocation uniform location of material shininess component
+         * @param matAmbLocation uniform location of material ambient component
+         * @param diffuseTexture texture number to bind diffuse texture map to
+         * @return number of meshlets drawn
+         * @note The meshlets of each material are drawn with one call to glMultiDrawElements()
+         * @note Meshlets must be generated when the model is loaded, see enableMeshletGeneration()
+         */
+        [[maybe_unused]] GLuint drawMeshlets( GLuint shaderProgramHandle,
+                   const glm::mat4& modelViewProjectionMatrix, const glm::vec3& eyePosition,
+                   GLint matDiffLocation = -1, GLint matSpecLocation = -1, GLint matShinLocation = -1, GLint matAmbLocation = -1,
+                   GLenum diffuseTexture = GL_TEXTURE0 ) const;
+
+        /**
+         * @brief Renders a simplified level of detail of a model
+         * @param lodLevel level of detail to draw, 0 is the full detail model
+         * @param shaderProgramHandle shader program handle that
+         * @param matDiffLocation uniform location of material diffuse component
+         * @param matSpecLocation uniform location of material specular component
+         * @param matShinLocation uniform location of material shininess component
+         * @param matAmbLocation uniform location of material ambient component
+         * @param diffuseTexture texture number to bind diffuse texture map to
+         * @return true if draw succeeded, false otherwise
+         * @note levels past the coarsest generated level draw the coarsest level
+         * @note Levels of detail must be generated when the model is loaded, see enableLevelOfDetailGeneration()
+         */
+        [[maybe_unused]] bool drawLevelOfDetail( GLuint lodLevel, GLuint shaderProgramHandle,
+                   GLint matDiffLocation = -1, GLint matSpecLocation = -1, GLint matShinLocation = -1, GLint matAmbLocation = -1,
+                   GLenum diffuseTexture = GL_TEXTURE0 ) const;
+        /**
+         * @brief Selects the coarsest level of detail whose error projects to at most the given number of pixels
+         * @param modelViewMatrix matrix transforming the model into eye space
+         * @param projectionMatrix perspective or orthographic projection matrix
+         * @param viewportHeight height of the viewport in pixels
+         * @param maxPixelError largest screen space error in pixels to allow
+         * @return level of detail to pass to drawLevelOfDetail()
+         * @note the error is projected at the point of the model's bounding sphere closest to the camera
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint selectLevelOfDetail( const glm::mat4& modelViewMatrix, const glm::mat4& projectionMatrix,
+                   GLfloat viewportHeight, GLfloat maxPixelError = 1.0f ) const;
+
         /**
          * @brief Return the number of vertices the model is made up of.  This value corresponds to the size of the Vertices, TexCoords, and Normals arrays.
          * @return the number of vertices within the model
@@ -148,6 +400,13 @@ namespace CSCI441 {
 		 * @note For use with VBOs
 		 */
         [[maybe_unused]] [[nodiscard]] GLfloat* getTexCoords() const;
+        /**
+         * @brief Return the RGBA color array that corresponds to the model mesh.
+         * @return pointer to the color array, nullptr if the model does not contain vertex colors
+         * @note For use with VBOs
+         * @note only PLY files provide vertex colors
+         */
+        [[maybe_unused]] [[nodiscard]] GLfloat* getColors() const;
         /**
          * @brief Return the number of indices to draw the model.  This value corresponds to the size of the Indices array.
          * @return the number of indices when drawing the model
@@ -159,15 +418,83 @@ namespace CSCI441 {
 		 * @note For use with IBOs
 		 */
         [[maybe_unused]] [[nodiscard]] GLuint* getIndices() const;
+        /**
+         * @brief Return the type the index buffer is stored as on the GPU.
+         * @return GL_UNSIGNED_SHORT if every vertex can be addressed with 16 bits, GL_UNSIGNED_INT otherwise
+         * @note The index array returned by getIndices() is always GLuint
+         */
+        [[maybe_unused]] [[nodiscard]] GLenum getIndexType() const;
+        /**
+         * @brief Return the matrix that maps quantized vertex positions back onto the model's bounding box.
+         * @return dequantization matrix, the identity if positions are not quantized
+         * @note Multiply the model matrix by this matrix when positions are quantized
+         */
+        [[maybe_unused]] [[nodiscard]] glm::mat4 getPositionDequantizationMatrix() const;
+        /**
+         * @brief Return the meshlets the model was split into.
+         * @return list of meshlets with their index ranges and culling bounds, empty if meshlets were not generated
+         * @note Meshlets are in the order of their material ranges
+         */
+        [[maybe_unused]] [[nodiscard]] const std::vector<CSCI441_INTERNAL::Meshlet>& getMeshlets() const;
+        /**
+         * @brief Return the number of levels of detail the model can be drawn at.
+         * @return number of levels including the full detail model
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getNumberOfLevelsOfDetail() const;
+        /**
+         * @brief Return the largest distance the surface moved to create a level of detail.
+         * @param lodLevel level of detail to query
+         * @return error in object space units, 0 for the full detail model
+         */
+        [[maybe_unused]] [[nodiscard]] GLfloat getLevelOfDetailError(GLuint lodLevel) const;
+        /**
+         * @brief Return the most physical memory the process used while the model was loaded.
+         * @return peak resident set size in bytes, 0 if it could not be queried
+         * @note Only Linux can restart the measurement for each load, elsewhere the peak covers every load before it
+         */
+        [[maybe_unused]] [[nodiscard]] size_t getPeakResidentSetSize() const;
+        /**
+         * @brief Return the measurements taken during the last load.
+         * @return per phase timings, bytes read, memory, and vertex counts
+         * @note an asynchronous load adds the GPU uploads of continueAsyncLoad() to the measurements as they happen
+         */
+        [[maybe_unused]] [[nodiscard]] const LoadStats& getLoadStats() const;
+        /**
+         * @brief Return the corner of the model's axis aligned bounding box with the smallest coordinates.
+         * @return minimum position in object space, the origin if no model is loaded
+         */
+        [[maybe_unused]] [[nodiscard]] glm::vec3 getBoundingBoxMin() const;
+        /**
+         * @brief Return the corner of the model's axis aligned bounding box with the largest coordinates.
+         * @return maximum position in object space, the origin if no model is loaded
+         */
+        [[maybe_unused]] [[nodiscard]] glm::vec3 getBoundingBoxMax() const;
+        /**
+         * @brief Return an indirect draw command for every material range of the model.
+         * @return commands in the order drawBatched() draws the ranges, each drawing a single instance
+         * @note the material records of drawBatched() line up with the commands, so the shader can read <tt>materials[gl_DrawID]</tt>
+         */
+        [[maybe_unused]] [[nodiscard]] std::vector<CSCI441_INTERNAL::DrawElementsIndirectCommand> getDrawCommands() const;
+        /**
+         * @brief Return the ranges of the geometry arena the model was uploaded into.
+         * @return ranges within the arena, all zero if the model has its own buffers
+         * @note see enableGeometryArena()
+         */
+        [[maybe_unused]] [[nodiscard]] GeometryArena::Allocation getGeometryArenaAllocation() const;
 
 		/**
 		 * @brief Enable auto-generation of vertex normals
+		 * @param creaseAngle largest angle in degrees between two faces that are smoothed across, 0 gives
+		 * flat faces and 180 smooths every face that shares a position
          * @warning Must be called prior to loading in a model from file
-         * @note If an object model does not contain vertex normal data, then normals will be computed based on the cross product of vertex winding order.
+         * @note If an object model does not contain vertex normal data, then smooth normals will be computed from the
+         * winding order of the faces around each vertex, weighted by the angle of each face at the vertex.  Faces that
+         * meet at more than the crease angle keep a hard edge, a vertex on such an edge is duplicated so each side
+         * gets its own normal.  Otherwise vertices that share a position share a normal and the mesh stays indexed.
          * @note No normals are generated by default
          * @note To disable, call disableAutoGenerateNormals
          */
-		[[maybe_unused]] static void enableAutoGenerateNormals();
+		[[maybe_unused]] static void enableAutoGenerateNormals(GLfloat creaseAngle = 60.0f);
 		/**
 		 * @brief Disable auto-generation of vertex normals
          * @warning Must be called prior to loading in a model from file
@@ -179,6 +506,8 @@ namespace CSCI441 {
 		/**
 		 * @brief Enable auto-generation of vertex tangents
 		 * @warning Must be called prior to loading in a model from file
+		 * @note Tangents follow the direction of increasing s texture coordinate and w holds the handedness of the
+		 * bitangent, computed as cross(normal, tangent.xyz) * tangent.w, so mirrored texture coordinates normal map correctly
 		 * @note No tangents are generated by default
 		 * @note To disable, call disableAutoGenerateTangents
 		 */
@@ -191,16 +520,309 @@ namespace CSCI441 {
 		 */
 		[[maybe_unused]] static void disableAutoGenerateTangents();
 
+		/**
+		 * @brief Enable welding of duplicate vertices and removal of redundant triangles
+		 * @param epsilon largest distance along each axis between positions that are welded, 0 welds identical positions only
+		 * @warning Must be called prior to loading in a model from file
+		 * @note When enabled, vertices of every format whose positions are within epsilon and whose normal, texture
+		 * coordinate, and color are identical are merged into a single vertex shared through the index array.  Triangles
+		 * that then repeat a vertex, have zero area, or repeat an earlier triangle are removed.
+		 * @note STL files list a facet normal on every triangle corner, which keeps the corners of a curved surface
+		 * apart.  If normals are also auto-generated, the facet normals are replaced by generated smooth normals
+		 * so the corners weld.
+		 * @note Vertices are not welded by default
+		 * @note To disable, call disableVertexWelding
+		 */
+		[[maybe_unused]] static void enableVertexWelding(GLfloat epsilon = 0.0f);
+		/**
+		 * @brief Disable welding of duplicate vertices
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Vertices are not welded by default
+		 * @note To enable, call enableVertexWelding
+		 */
+		[[maybe_unused]] static void disableVertexWelding();
+
+		/**
+		 * @brief Enable interleaving all attributes of a vertex into a single record
+		 * @warning Must be called prior to loading in a model from file
+		 * @note By default each attribute is buffered as its own block.  When enabled, the position, normal, texture
+		 * coordinate, and tangent of a vertex are stored next to each other in a 48 byte record (64 with colors) so
+		 * fetching a vertex reads one contiguous range of memory.
+		 * @note setAttributeLocations() matches whichever layout the model was buffered with
+		 * @note Vertices are not interleaved by default
+		 * @note To disable, call disableInterleavedVertexLayout
+		 */
+		[[maybe_unused]] static void enableInterleavedVertexLayout();
+		/**
+		 * @brief Disable interleaving all attributes of a vertex into a single record
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Vertices are not interleaved by default
+		 * @note To enable, call enableInterleavedVertexLayout
+		 */
+		[[maybe_unused]] static void disableInterleavedVertexLayout();
+
+		/**
+		 * @brief Enable packing vertex attributes into compact interleaved records
+		 * @warning Must be called prior to loading in a model from file
+		 * @warning Packed attributes require OpenGL 3.3+
+		 * @note Packed vertices are always interleaved.  Normals and tangents are normalized and stored as
+		 * GL_INT_2_10_10_10_REV, texture coordinates as GL_HALF_FLOAT, and colors as normalized GL_UNSIGNED_BYTE,
+		 * for a 24 byte record (28 with colors).  Positions remain full precision.
+		 * @note The CPU side arrays returned by the getters are not packed
+		 * @note Attributes are not packed by default
+		 * @note To disable, call disablePackedVertexAttributes
+		 */
+		[[maybe_unused]] static void enablePackedVertexAttributes();
+		/**
+		 * @brief Disable packing vertex attributes into compact interleaved records
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Attributes are not packed by default
+		 * @note To enable, call enablePackedVertexAttributes
+		 */
+		[[maybe_unused]] static void disablePackedVertexAttributes();
+
+		/**
+		 * @brief Enable quantizing vertex positions to 16 bits relative to the model's bounding box
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Implies packed vertex attributes.  Positions are stored as normalized GL_UNSIGNED_SHORT in [0, 1]
+		 * and must be transformed by getPositionDequantizationMatrix() before the model matrix.
+		 * @note Positions are not quantized by default
+		 * @note To disable, call disableQuantizedPositions
+		 */
+		[[maybe_unused]] static void enableQuantizedPositions();
+		/**
+		 * @brief Disable quantizing vertex positions to 16 bits relative to the model's bounding box
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Positions are not quantized by default
+		 * @note To enable, call enableQuantizedPositions
+		 */
+		[[maybe_unused]] static void disableQuantizedPositions();
+
+		/**
+		 * @brief Enable octahedral encoding of packed normals and tangents
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Implies packed vertex attributes.  Normals are stored as two normalized GL_SHORT octahedral
+		 * coordinates.  Tangents are stored as four normalized GL_SHORT values: the two octahedral coordinates,
+		 * the handedness, and zero.  The shader must decode the octahedral coordinates back to a direction.
+		 * @note Normals and tangents are packed as GL_INT_2_10_10_10_REV by default
+		 * @note To disable, call disableOctahedralNormals
+		 */
+		[[maybe_unused]] static void enableOctahedralNormals();
+		/**
+		 * @brief Disable octahedral encoding of packed normals and tangents
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Normals and tangents are packed as GL_INT_2_10_10_10_REV by default
+		 * @note To enable, call enableOctahedralNormals
+		 */
+		[[maybe_unused]] static void disableOctahedralNormals();
+
+		/**
+		 * @brief Enable storing packed texture coordinates as normalized 16-bit values
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Implies packed vertex attributes.  Texture coordinates are stored as normalized GL_UNSIGNED_SHORT,
+		 * which gives uniform precision across [0, 1] but clamps coordinates outside of that range.
+		 * @note Texture coordinates are packed as GL_HALF_FLOAT by default
+		 * @note To disable, call disableNormalizedTexCoords
+		 */
+		[[maybe_unused]] static void enableNormalizedTexCoords();
+		/**
+		 * @brief Disable storing packed texture coordinates as normalized 16-bit values
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Texture coordinates are packed as GL_HALF_FLOAT by default
+		 * @note To enable, call enableNormalizedTexCoords
+		 */
+		[[maybe_unused]] static void disableNormalizedTexCoords();
+
+		/**
+		 * @brief Enable reordering triangles and vertices for the GPU vertex caches
+		 * @warning Must be called prior to loading in a model from file
+		 * @note The triangles of each material range are reordered for post-transform cache reuse, then vertices
+		 * are reordered into the order they are first used.  The average cache miss ratio (ACMR) and average transform
+		 * to vertex ratio (ATVR) before and after are reported when INFO messages are displayed.
+		 * @note Meshes are not optimized by default
+		 * @note To disable, call disableVertexCacheOptimization
+		 */
+		[[maybe_unused]] static void enableVertexCacheOptimization();
+		/**
+		 * @brief Disable reordering triangles and vertices for the GPU vertex caches
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Meshes are not optimized by default
+		 * @note To enable, call enableVertexCacheOptimization
+		 */
+		[[maybe_unused]] static void disableVertexCacheOptimization();
+
+		/**
+		 * @brief Enable sorting clusters of triangles to reduce overdraw
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Implies vertex cache optimization.  After the cache optimization, each material range is split into
+		 * the clusters where the cache restarts and the clusters facing away from the center of the range are drawn
+		 * first so they occlude the rest of the mesh.
+		 * @note Overdraw is not optimized by default
+		 * @note To disable, call disableOverdrawOptimization
+		 */
+		[[maybe_unused]] static void enableOverdrawOptimization();
+		/**
+		 * @brief Disable sorting clusters of triangles to reduce overdraw
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Overdraw is not optimized by default
+		 * @note To enable, call enableOverdrawOptimization
+		 */
+		[[maybe_unused]] static void disableOverdrawOptimization();
+
+		/**
+		 * @brief Enable splitting each material range into meshlets for culling
+		 * @param maxVertices most unique vertices a meshlet may reference
+		 * @param maxTriangles most triangles a meshlet may contain
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Triangles are reordered so each meshlet is a contiguous index range with a bounding sphere and normal cone,
+		 * see getMeshlets() and drawMeshlets()
+		 * @note Meshlets are not generated by default
+		 * @note To disable, call disableMeshletGeneration
+		 */
+		[[maybe_unused]] static void enableMeshletGeneration(GLuint maxVertices = 64, GLuint maxTriangles = 124);
+		/**
+		 * @brief Disable splitting each material range into meshlets for culling
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Meshlets are not generated by default
+		 * @note To enable, call enableMeshletGeneration
+		 */
+		[[maybe_unused]] static void disableMeshletGeneration();
+
+		/**
+		 * @brief Enable generating simplified levels of detail
+		 * @param numLevels number of levels including the full detail model
+		 * @param reductionPerLevel fraction of the previous level's triangles each level keeps
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Levels are created with quadric error metric edge collapses onto existing vertices, so all levels share
+		 * the model's vertex buffer and append their indices after the full detail indices.  UV and normal seams stay
+		 * closed and vertices on the boundary between two materials are not moved.
+		 * @note Levels of detail are not generated by default
+		 * @note To disable, call disableLevelOfDetailGeneration
+		 */
+		[[maybe_unused]] static void enableLevelOfDetailGeneration(GLuint numLevels = 4, GLfloat reductionPerLevel = 0.5f);
+		/**
+		 * @brief Disable generating simplified levels of detail
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Levels of detail are not generated by default
+		 * @note To enable, call enableLevelOfDetailGeneration
+		 */
+		[[maybe_unused]] static void disableLevelOfDetailGeneration();
+
+		/**
+		 * @brief Enable streaming models straight from file into their GPU buffers
+		 * @param memoryBudgetBytes most memory to stage vertices and indices in while the file is read
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Meant for models larger than memory.  Vertices are decoded in chunks and written into the vertex buffer,
+		 * indices are spilled to a temporary file and uploaded once the whole file is read, and pages of the file that
+		 * have been read are released.  The attribute arrays are never held in memory, so getVertices() and the other
+		 * array accessors return nullptr and the model cannot be saved to a cache file.
+		 * @note Only PLY and binary STL files are streamed, other formats are loaded into memory as usual.  Models that
+		 * load asynchronously are not streamed either, since the file is read off of the GL thread.
+		 * @note Streamed models use the separate vertex layout and are not welded, optimized, split into meshlets or
+		 * levels of detail, and do not have normals or tangents generated
+		 * @note Models are not streamed by default
+		 * @note To disable, call disableStreamingLoad
+		 */
+		[[maybe_unused]] static void enableStreamingLoad(size_t memoryBudgetBytes = 256 << 20);
+		/**
+		 * @brief Disable streaming models straight from file into their GPU buffers
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Models are not streamed by default
+		 * @note To enable, call enableStreamingLoad
+		 */
+		[[maybe_unused]] static void disableStreamingLoad();
+
+		/**
+		 * @brief Enable uploading models into a geometry arena shared with other models
+		 * @param arena arena to upload into
+		 * @warning Must be called prior to loading in a model from file
+		 * @warning The loader and every model uploaded into the arena keep its address.  The arena must outlive those
+		 * models, and disableGeometryArena() must be called before the arena is destroyed if more models will be loaded.
+		 * Arenas cannot be moved for the same reason.
+		 * @note Instead of creating its own vertex and index buffers, each model is given a range of one of the
+		 * arena's pages and draws from the page's vertex array with glDrawElementsBaseVertex().  Models drawn one after
+		 * another from the same page leave the same vertex array bound.
+		 * @note Vertices are stored in the arena's GeometryArena::Vertex format with 32-bit indices, so the interleaved
+		 * and packed vertex layouts do not apply to models in an arena.  Models are not streamed while an arena is enabled.
+		 * @note Models sharing a page share its attribute locations, calling setAttributeLocations() on a model in an
+		 * arena sets them for the whole arena
+		 * @note Models are not uploaded into an arena by default
+		 * @note To disable, call disableGeometryArena
+		 */
+		[[maybe_unused]] static void enableGeometryArena(GeometryArena& arena);
+		/**
+		 * @brief Disable uploading models into a geometry arena, each model creates its own buffers
+		 * @warning Must be called prior to loading in a model from file
+		 * @note Models are not uploaded into an arena by default
+		 * @note To enable, call enableGeometryArena
+		 */
+		[[maybe_unused]] static void disableGeometryArena();
+
+		/**
+		 * @brief Deletes the textures shared between models
+		 * @note Material images are decoded once per process, every model naming an image with the same contents
+		 * receives the same texture.  Images named again after this call are decoded again.
+		 * @warning Models already loaded lose their textures, call only once none of them will be drawn again
+		 */
+		[[maybe_unused]] static void clearTextureCache();
+
 	private:
 		void _init();
 		bool _loadMTLFile( const char *mtlFilename, bool INFO, bool ERRORS );
-		bool _loadOBJFile( bool INFO, bool ERRORS );
+		bool _loadOBJFile( bool INFO, bool ERRORS, GLuint numThreads );
 		bool _loadOFFFile( bool INFO, bool ERRORS );
 		bool _loadPLYFile( bool INFO, bool ERRORS );
+		static bool _parsePLYHeader( CSCI441_INTERNAL::TextCursor &cursor, CSCI441_INTERNAL::PLY_FORMAT &format, std::vector<CSCI441_INTERNAL::PLYElement> &elements );
 		bool _loadSTLFile( bool INFO, bool ERRORS );
+		bool _loadCacheFile( const std::string &cacheFilename, bool INFO, bool ERRORS, bool requireSameOptions );
+		[[nodiscard]] uint32_t _loadOptionFlags() const;
+		static CSCI441_INTERNAL::LoadOptions _snapshotLoadOptions();
+		bool _loadModelFile( std::string filename, bool INFO, bool ERRORS, GLuint numThreads );
+		static bool _isBinarySTL( const CSCI441_INTERNAL::MappedFile &stlFile );
+		bool _loadBinarySTLFile( const CSCI441_INTERNAL::MappedFile &stlFile, bool INFO, bool ERRORS );
+		static void _parseOBJChunk( CSCI441_INTERNAL::OBJChunk &chunk );
+		static bool _parseOBJFaceVertex( std::string_view faceToken, GLint &vertexIndex, GLint &texCoordIndex, GLint &normalIndex );
 		static std::vector<std::string> _tokenizeString( const std::string& input, const std::string& delimiters );
         void _allocateAttributeArrays(GLuint numVertices, GLuint numIndices);
-        void _bufferData() const;
+        void _weldVertices(bool INFO);
+        void _removeRedundantTriangles(bool INFO);
+        void _generateNormals(bool INFO);
+        void _generateTangents(bool INFO);
+        void _postProcessMesh(bool INFO, const char* cachedVertexData, GLsizeiptr cachedVertexDataSize);
+        void _forEachMaterialRange(const std::function<void(const std::string&, GLuint, GLuint*, GLuint, const glm::vec3*, GLuint)>& visit);
+        void _optimizeMesh(bool INFO);
+        void _buildMeshlets(bool INFO);
+        void _buildLevelsOfDetail(bool INFO);
+        void _allocateBuffer(GLenum target, GLuint buffer, GLsizeiptr size, const void* data);
+        void _bufferSubData(GLenum target, GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data);
+        bool _continueBufferUpload(CSCI441_INTERNAL::PendingBufferUpload& upload, std::chrono::steady_clock::time_point deadline);
+        void _decodeMaterialTextures(const std::string& path, bool INFO, bool ERRORS);
+        static std::shared_ptr<const CSCI441_INTERNAL::DecodedImage> _decodeTextureImage(const CSCI441_INTERNAL::MappedFile& textureFile, const CSCI441_INTERNAL::MappedFile* maskFile);
+        static bool _isMaterialTextureDecoded(const CSCI441_INTERNAL::PendingTexture& texture);
+        void _uploadMaterialTexture(const CSCI441_INTERNAL::PendingTexture& texture);
+        void _uploadMaterialTextures();
+        void _mergeMaterialRanges();
+        void _buildDrawList();
+        static bool _supportsShaderDrawParameters();
+        void _bindMaterial(const std::string& materialName, GLuint shaderProgramHandle,
+                           GLint matDiffLocation, GLint matSpecLocation, GLint matShinLocation, GLint matAmbLocation,
+                           GLenum diffuseTexture) const;
+        [[nodiscard]] std::string _logPrefix() const;
+        void _bufferData(bool INFO);
+        void _bufferInterleavedData(bool INFO);
+        void _bufferIndices(const GLuint* indices);
+        [[nodiscard]] bool _packsVertexAttributes() const;
+        void _useSeparateVertexLayout(bool hasColors);
+        void _bufferArenaData();
+        void _releaseGeometryArena();
+        void _bindVertexArray() const;
+        [[nodiscard]] const void* _indexOffset(GLuint index) const;
+        [[nodiscard]] bool _streamsLoad(bool INFO) const;
+        bool _beginStreaming(CSCI441_INTERNAL::StreamingLoadState& stream, GLuint numVertices, bool hasColors);
+        void _streamVertices(CSCI441_INTERNAL::StreamingLoadState& stream, GLuint firstVertex, GLuint numVertices,
+                             const glm::vec3* vertices, const glm::vec3* normals, const glm::vec2* texCoords, const glm::vec4* colors);
+        static bool _streamIndices(CSCI441_INTERNAL::StreamingLoadState& stream, const GLuint* indices, size_t numIndices);
+        bool _endStreaming(CSCI441_INTERNAL::StreamingLoadState& stream, bool INFO);
 
 		std::string _filename;
 		CSCI441_INTERNAL::MODEL_TYPE _modelType;
@@ -208,25 +830,100 @@ namespace CSCI441 {
 		GLuint _vaod;
 		GLuint _vbods[2] = {0};
 
+		GeometryArena* _geometryArena = nullptr;
+		GeometryArena::Allocation _arenaAllocation;
+		bool _pendingArenaUpload = false;
+
+		GLint _instanceModelMatrixLocation = -1;
+		GLint _instanceColorLocation = -1;
+		GLuint _instanceStorageBlockBinding = 0;
+
 		glm::vec3* _vertices;
         glm::vec3* _normals;
         glm::vec4* _tangents;
         glm::vec2* _texCoords;
+        glm::vec4* _colors;
 		GLuint* _indices;
 		GLuint _uniqueIndex;
 		GLuint _numIndices;
+		GLenum _indexType;
 
 		std::map< std::string, CSCI441_INTERNAL::ModelMaterial* > _materials;
 		std::map< std::string, std::vector< std::pair< GLuint, GLuint > > > _materialIndexStartStop;
+		std::vector< std::string > _dependentFiles;
+		size_t _sourceFileSize = 0;
+		int64_t _sourceModificationTime = 0;
+
+		std::vector< GLsizei > _drawCounts;
+		std::vector< const void* > _drawOffsets;
+		std::vector< GLint > _drawBaseVertices;
+		GLuint _materialBufferd;
+		GLsizeiptr _materialRecordStride = sizeof(CSCI441_INTERNAL::MaterialRecord);
+		std::vector< CSCI441_INTERNAL::DrawListGroup > _drawListGroups;
+
+		std::vector< CSCI441_INTERNAL::Meshlet > _meshlets;
+		std::map< std::string, std::vector< std::pair< GLuint, GLuint > > > _materialMeshletStartStop;
+
+		bool _deferUpload;
+		std::vector< CSCI441_INTERNAL::PendingBufferUpload > _pendingBufferUploads;
+		std::vector< CSCI441_INTERNAL::PendingTexture > _pendingTextures;
+		std::unique_ptr< CSCI441_INTERNAL::AsyncLoadState > _asyncLoad;
+
+		CSCI441_INTERNAL::LoadOptions _loadOptions;
+
+		std::vector< GLuint > _lodIndices;
+		std::vector< std::map< std::string, std::vector< std::pair< GLuint, GLuint > > > > _lodMaterialIndexStartStop;
+		std::vector< GLfloat > _lodErrors;
+		glm::vec4 _boundingSphere;
+		glm::vec3 _boundingBoxMin = glm::vec3( 0.0f );
+		glm::vec3 _boundingBoxMax = glm::vec3( 0.0f );
 
 		bool _hasVertexTexCoords;
 		bool _hasVertexNormals;
 
+		CSCI441_INTERNAL::VertexLayout _vertexLayout;
+		glm::mat4 _positionDequantization;
+
+		size_t _peakResidentSetSize;
+		LoadStats _loadStats;
+
 		void _moveFromSrc(ModelLoader&);
 		void _cleanupSelf();
 
         static bool sAUTO_GEN_NORMALS;
+		static GLfloat sNORMAL_CREASE_ANGLE;
 		static bool sAUTO_GEN_TANGENTS;
+		static bool sWELD_VERTICES;
+		static GLfloat sWELD_EPSILON;
+		static bool sINTERLEAVE_VERTICES;
+		static bool sPACK_VERTEX_ATTRIBUTES;
+		static bool sQUANTIZE_POSITIONS;
+		static bool sOCTAHEDRAL_NORMALS;
+		static bool sUNORM16_TEX_COORDS;
+		static bool sOPTIMIZE_VERTEX_CACHE;
+		static bool sOPTIMIZE_OVERDRAW;
+		static bool sBUILD_MESHLETS;
+		static GLuint sMESHLET_MAX_VERTICES;
+		static GLuint sMESHLET_MAX_TRIANGLES;
+		static bool sBUILD_LEVELS_OF_DETAIL;
+		static GLuint sNUM_LEVELS_OF_DETAIL;
+		static GLfloat sLEVEL_OF_DETAIL_REDUCTION;
+		static bool sSTREAM_LOAD;
+		static size_t sSTREAM_MEMORY_BUDGET;
+		static GeometryArena* sGEOMETRY_ARENA;
+
+		/**
+		 * @brief OBJ files are not split across more threads than leave each thread at least this many bytes
+		 */
+		static constexpr size_t OBJ_MIN_BYTES_PER_THREAD = 1 << 20;
+		/**
+		 * @brief size of the binary STL header and triangle count
+		 */
+		static constexpr size_t STL_BINARY_HEADER_SIZE = 84;
+		/**
+		 * @brief size of a single binary STL triangle record
+		 */
+		static constexpr size_t STL_BINARY_TRIANGLE_SIZE = 50;
 	};
 }
 
@@ -239,7 +936,26 @@ namespace CSCI441_INTERNAL {
 }
 
 inline bool CSCI441::ModelLoader::sAUTO_GEN_NORMALS = false;
+inline GLfloat CSCI441::ModelLoader::sNORMAL_CREASE_ANGLE = glm::radians( 60.0f );
 inline bool CSCI441::ModelLoader::sAUTO_GEN_TANGENTS = false;
+inline bool CSCI441::ModelLoader::sWELD_VERTICES = false;
+inline GLfloat CSCI441::ModelLoader::sWELD_EPSILON = 0.0f;
+inline bool CSCI441::ModelLoader::sINTERLEAVE_VERTICES = false;
+inline bool CSCI441::ModelLoader::sPACK_VERTEX_ATTRIBUTES = false;
+inline bool CSCI441::ModelLoader::sQUANTIZE_POSITIONS = false;
+inline bool CSCI441::ModelLoader::sOCTAHEDRAL_NORMALS = false;
+inline bool CSCI441::ModelLoader::sUNORM16_TEX_COORDS = false;
+inline bool CSCI441::ModelLoader::sOPTIMIZE_VERTEX_CACHE = false;
+inline bool CSCI441::ModelLoader::sOPTIMIZE_OVERDRAW = false;
+inline bool CSCI441::ModelLoader::sBUILD_MESHLETS = false;
+inline GLuint CSCI441::ModelLoader::sMESHLET_MAX_VERTICES = 64;
+inline GLuint CSCI441::ModelLoader::sMESHLET_MAX_TRIANGLES = 124;
+inline bool CSCI441::ModelLoader::sBUILD_LEVELS_OF_DETAIL = false;
+inline GLuint CSCI441::ModelLoader::sNUM_LEVELS_OF_DETAIL = 4;
+inline GLfloat CSCI441::ModelLoader::sLEVEL_OF_DETAIL_REDUCTION = 0.5f;
+inline bool CSCI441::ModelLoader::sSTREAM_LOAD = false;
+inline size_t CSCI441::ModelLoader::sSTREAM_MEMORY_BUDGET = 256 << 20;
+inline CSCI441::GeometryArena* CSCI441::ModelLoader::sGEOMETRY_ARENA = nullptr;
 
 inline CSCI441::ModelLoader::ModelLoader() :
 	_modelType(CSCI441_INTERNAL::MODEL_TYPE::UNKNOWN),
@@ -248,11 +964,18 @@ inline CSCI441::ModelLoader::ModelLoader() :
 	_normals(nullptr),
 	_tangents(nullptr),
 	_texCoords(nullptr),
+	_colors(nullptr),
 	_indices(nullptr),
 	_uniqueIndex(0),
 	_numIndices(0),
+	_indexType(GL_UNSIGNED_INT),
+	_materialBufferd(0),
+	_deferUpload(false),
+	_boundingSphere(0.0f),
 	_hasVertexTexCoords(false),
-	_hasVertexNormals(false)
+	_hasVertexNormals(false),
+	_positionDequantization(1.0f),
+	_peakResidentSetSize(0)
 {
 	_init();
 }
@@ -265,11 +988,18 @@ inline CSCI441::ModelLoader::ModelLoader( const char* filename ) :
 	_normals(nullptr),
 	_tangents(nullptr),
 	_texCoords(nullptr),
+	_colors(nullptr),
 	_indices(nullptr),
 	_uniqueIndex(0),
 	_numIndices(0),
+	_indexType(GL_UNSIGNED_INT),
+	_materialBufferd(0),
+	_deferUpload(false),
+	_boundingSphere(0.0f),
 	_hasVertexTexCoords(false),
-	_hasVertexNormals(false)
+	_hasVertexNormals(false),
+	_positionDequantization(1.0f),
+	_peakResidentSetSize(0)
 {
 	_init();
 	loadModelFile( filename );
@@ -286,11 +1016,18 @@ inline CSCI441::ModelLoader::ModelLoader(ModelLoader&& src) noexcept :
 	_normals(nullptr),
 	_tangents(nullptr),
 	_texCoords(nullptr),
+	_colors(nullptr),
 	_indices(nullptr),
 	_uniqueIndex(0),
 	_numIndices(0),
+	_indexType(GL_UNSIGNED_INT),
+	_materialBufferd(0),
+	_deferUpload(false),
+	_boundingSphere(0.0f),
 	_hasVertexTexCoords(false),
-	_hasVertexNormals(false)
+	_hasVertexNormals(false),
+	_positionDequantization(1.0f),
+	_peakResidentSetSize(0)
 {
 	_moveFromSrc(src);
 }
@@ -308,11 +1045,47 @@ inline void CSCI441::ModelLoader::_init() {
 	glGenBuffers( 2, _vbods );
 }
 
-inline bool CSCI441::ModelLoader::loadModelFile( std::string filename, bool const INFO, const bool ERRORS ) {
+inline bool CSCI441::ModelLoader::loadModelFile( std::string filename, bool const INFO, const bool ERRORS, const GLuint numThreads ) {
+	_loadOptions = _snapshotLoadOptions();
+	return _loadModelFile( std::move(filename), INFO, ERRORS, numThreads );
+}
+
+//
+//  bool _loadModelFile(string filename, bool INFO, bool ERRORS, GLuint numThreads)
+//
+//      Loads a model with the options already copied into _loadOptions, so an
+//  asynchronous load only reads options belonging to its own loader.
+//
+inline bool CSCI441::ModelLoader::_loadModelFile( std::string filename, bool const INFO, const bool ERRORS, const GLuint numThreads ) {
+	const auto start = std::chrono::steady_clock::now();
 	bool result = true;
+	_releaseGeometryArena();
 	_filename = std::move(filename);
-	if( _filename.find(".obj") != std::string::npos ) {
-		result = _loadOBJFile( INFO, ERRORS );
+	_dependentFiles.clear();
+	CSCI441_INTERNAL::resetPeakResidentSetSize();
+	_loadStats = LoadStats();
+	_loadStats.filename = _filename;
+	std::string loadedFilename = _filename;
+
+	const std::string cacheExtension = CSCI441_INTERNAL::MESH_CACHE_EXTENSION;
+	const std::string cacheFilename = _filename + cacheExtension;
+	size_t cacheSize = 0;
+	_sourceFileSize = 0;
+	_sourceModificationTime = 0;
+	if( _filename.size() > cacheExtension.size()
+		&& _filename.compare( _filename.size() - cacheExtension.size(), cacheExtension.size(), cacheExtension ) == 0 ) {
+		result = _loadCacheFile( _filename, INFO, ERRORS, false );
+	}
+	// stamp the model before parsing it, a cache saved from this load records the file as it was read
+	else if( CSCI441_INTERNAL::fileSize( _filename.c_str(), _sourceFileSize )
+		&& CSCI441_INTERNAL::fileModificationTime( _filename.c_str(), _sourceModificationTime )
+		&& CSCI441_INTERNAL::fileSize( cacheFilename.c_str(), cacheSize )
+		&& _loadCacheFile( cacheFilename, INFO, ERRORS, true ) ) {
+		loadedFilename = cacheFilename;
+		result = true;
+	}
+	else if( _filename.find(".obj") != std::string::npos ) {
+		result = _loadOBJFile( INFO, ERRORS, numThreads );
 		_modelType = CSCI441_INTERNAL::MODEL_TYPE::OBJ;
 	}
 	else if( _filename.find(".off") != std::string::npos ) {
@@ -332,40 +1105,138 @@ inline bool CSCI441::ModelLoader::loadModelFile( std::string filename, bool cons
 		if (ERRORS) CSCI441::LogUtils::logError("[ERROR]:  Unsupported file format for file: %s\n", _filename.c_str() );
 	}
 
+	// a streamed load keeps no vertices and measured its bounds as they went by
+	if( result && _vertices != nullptr && _uniqueIndex > 0 ) {
+		_boundingBoxMin = _boundingBoxMax = _vertices[0];
+		for( GLuint v = 1; v < _uniqueIndex; v++ ) {
+			_boundingBoxMin = glm::min( _boundingBoxMin, _vertices[v] );
+			_boundingBoxMax = glm::max( _boundingBoxMax, _vertices[v] );
+		}
+	}
+
+	size_t fileSize = 0;
+	if( CSCI441_INTERNAL::fileSize( loadedFilename.c_str(), fileSize ) ) _loadStats.bytesRead += fileSize;
+	_peakResidentSetSize = CSCI441_INTERNAL::peakResidentSetSize();
+	_loadStats.peakResidentSetSize = _peakResidentSetSize;
+	_loadStats.numVertices = _uniqueIndex;
+	_loadStats.numTriangles = _numIndices / 3;
+	_loadStats.totalMilliseconds = CSCI441_INTERNAL::millisecondsSince( start );
 	return result;
 }
 
 [[maybe_unused]]
-inline void CSCI441::ModelLoader::setAttributeLocations(const GLint positionLocation, const GLint normalLocation, const GLint texCoordLocation, const GLint tangentLocation) const {
-    glBindVertexArray( _vaod );
-    glBindBuffer( GL_ARRAY_BUFFER, _vbods[0] );
+inline std::future<bool> CSCI441::ModelLoader::loadModelFileAsync( std::string filename, const bool INFO, const bool ERRORS, const GLuint numThreads ) {
+	// a previous load that was never completed is abandoned
+	if( _asyncLoad && _asyncLoad->worker.joinable() ) _asyncLoad->worker.join();
+	_asyncLoad = std::make_unique<CSCI441_INTERNAL::AsyncLoadState>();
+	std::future<bool> result = _asyncLoad->result.get_future();
+
+	// the worker parses into a loader of its own, created here since creating it generates GL objects,
+	// and queues its GL work to be replayed by continueAsyncLoad()
+	_asyncLoad->staging = std::make_unique<ModelLoader>();
+	_asyncLoad->staging->_loadOptions = _snapshotLoadOptions();
+	_asyncLoad->staging->_deferUpload = true;
+	CSCI441_INTERNAL::AsyncLoadState* asyncLoad = _asyncLoad.get();
+	asyncLoad->worker = std::thread( [asyncLoad, filename = std::move(filename), INFO, ERRORS, numThreads]() mutable {
+		asyncLoad->succeeded = asyncLoad->staging->_loadModelFile( std::move(filename), INFO, ERRORS, numThreads );
+		asyncLoad->parsed.store( true, std::memory_order_release );
+	} );
+
+	return result;
+}
 
-	if (positionLocation >= 0) {
-		glEnableVertexAttribArray( positionLocation );
-		glVertexAttribPointer( positionLocation, 3, GL_FLOAT, GL_FALSE, 0, (void*)nullptr );
+[[maybe_unused]]
+inline bool CSCI441::ModelLoader::continueAsyncLoad( const GLfloat timeBudgetMilliseconds ) {
+	if( !_asyncLoad ) return true;
+	if( !_asyncLoad->parsed.load( std::memory_order_acquire ) ) return false;
+	if( _asyncLoad->worker.joinable() ) _asyncLoad->worker.join();
+
+	// the parsed model replaces this one, keeping how this loader was told to read instances
+	if( _asyncLoad->staging ) {
+		std::unique_ptr< CSCI441_INTERNAL::AsyncLoadState > asyncLoad = std::move(_asyncLoad);
+		const GLint instanceModelMatrixLocation = _instanceModelMatrixLocation;
+		const GLint instanceColorLocation = _instanceColorLocation;
+		const GLuint instanceStorageBlockBinding = _instanceStorageBlockBinding;
+		*this = std::move( *asyncLoad->staging );
+		asyncLoad->staging.reset();
+		_instanceModelMatrixLocation = instanceModelMatrixLocation;
+		_instanceColorLocation = instanceColorLocation;
+		_instanceStorageBlockBinding = instanceStorageBlockBinding;
+		_asyncLoad = std::move(asyncLoad);
 	}
 
-	if (normalLocation >= 0) {
-		glEnableVertexAttribArray( normalLocation );
-		glVertexAttribPointer( normalLocation, 3, GL_FLOAT, GL_FALSE, 0, (void*)(sizeof(glm::vec3) * _uniqueIndex) );
+	if( _asyncLoad->succeeded ) {
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>( std::chrono::duration<GLfloat, std::milli>( timeBudgetMilliseconds ) );
+
+		// the arena's pages are created and written on the GL thread
+		if( _pendingArenaUpload ) {
+			_pendingArenaUpload = false;
+			_bufferArenaData();
+		}
+
+		// indices uploaded to the model's own element array buffer are recorded by its vertex array
+		if( _geometryArena == nullptr ) glBindVertexArray( _vaod );
+		{
+			const CSCI441_INTERNAL::ScopedTimer uploadTimer( _loadStats.gpuUploadMilliseconds );
+			for( ; _asyncLoad->nextBufferUpload < _pendingBufferUploads.size(); _asyncLoad->nextBufferUpload++ ) {
+				if( !_continueBufferUpload( _pendingBufferUploads[_asyncLoad->nextBufferUpload], deadline ) ) return false;
+			}
+		}
+		for( ; _asyncLoad->nextTexture < _pendingTextures.size(); _asyncLoad->nextTexture++ ) {
+			if( std::chrono::steady_clock::now() >= deadline ) return false;
+			// textures still decoding on the pool are waited for on a later call
+			if( !_isMaterialTextureDecoded( _pendingTextures[_asyncLoad->nextTexture] ) ) return false;
+			_uploadMaterialTexture( _pendingTextures[_asyncLoad->nextTexture] );
+		}
 	}
 
-	if (texCoordLocation >= 0) {
-		glEnableVertexAttribArray( texCoordLocation );
-		glVertexAttribPointer( texCoordLocation, 2, GL_FLOAT, GL_FALSE, 0, (void*)(sizeof(glm::vec3) * _uniqueIndex * 2) );
+	_pendingBufferUploads.clear();
+	_pendingTextures.clear();
+	_deferUpload = false;
+	if( _asyncLoad->succeeded ) _buildDrawList();
+
+	_asyncLoad->result.set_value( _asyncLoad->succeeded );
+	_asyncLoad.reset();
+	return true;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::setAttributeLocations(const GLint positionLocation, const GLint normalLocation, const GLint texCoordLocation, const GLint tangentLocation, const GLint colorLocation) const {
+	if( _geometryArena != nullptr ) {
+		_geometryArena->setAttributeLocations( positionLocation, normalLocation, texCoordLocation, tangentLocation, colorLocation );
+		return;
 	}
 
-	if (tangentLocation >= 0) {
-		glEnableVertexAttribArray( tangentLocation );
-		glVertexAttribPointer( tangentLocation, 4, GL_FLOAT, GL_FALSE, 0, (void*)(sizeof(glm::vec3) * _uniqueIndex * 2 + sizeof(glm::vec2) * _uniqueIndex) );
+    glBindVertexArray( _vaod );
+    glBindBuffer( GL_ARRAY_BUFFER, _vbods[0] );
+
+	const std::pair<GLint, const CSCI441_INTERNAL::VertexAttributeFormat*> attributes[] = {
+		{ positionLocation, &_vertexLayout.position },
+		{ normalLocation,   &_vertexLayout.normal },
+		{ texCoordLocation, &_vertexLayout.texCoord },
+		{ tangentLocation,  &_vertexLayout.tangent },
+		{ colorLocation,    &_vertexLayout.color }
+	};
+	for( const auto& [location, format] : attributes ) {
+		if (location >= 0 && format->numComponents > 0) {
+			glEnableVertexAttribArray( location );
+			glVertexAttribPointer( location, format->numComponents, format->type, format->normalized, format->stride, (void*)format->offset );
+		}
 	}
 }
 
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::setInstanceAttributeLocations(const GLint modelMatrixLocation, const GLint colorLocation, const GLuint storageBlockBinding) {
+	_instanceModelMatrixLocation = modelMatrixLocation;
+	_instanceColorLocation = colorLocation;
+	_instanceStorageBlockBinding = storageBlockBinding;
+}
+
 [[maybe_unused]]
 inline bool CSCI441::ModelLoader::draw( const GLuint shaderProgramHandle,
                                         const GLint matDiffLocation, const GLint matSpecLocation, const GLint matShinLocation, const GLint matAmbLocation,
                                         const GLenum diffuseTexture ) const {
-    glBindVertexArray( _vaod );
+    _bindVertexArray();
 
     bool result = true;
 	if( _modelType == CSCI441_INTERNAL::MODEL_TYPE::OBJ ) {
@@ -373,479 +1244,693 @@ inline bool CSCI441::ModelLoader::draw( const GLuint shaderProgramHandle,
 			auto materialName = materialIter.first;
 			auto indexStartStop = materialIter.second;
 
-			CSCI441_INTERNAL::ModelMaterial* material = nullptr;
-			if( _materials.find( materialName ) != _materials.end() )
-				material = _materials.find( materialName )->second;
+			_bindMaterial( materialName, shaderProgramHandle, matDiffLocation, matSpecLocation, matShinLocation, matAmbLocation, diffuseTexture );
 
 			for(const auto &[start, end] : indexStartStop) {
 				const GLsizei length = static_cast<GLsizei>(end - start) + 1;
 
 //				CSCI441::LogUtils::log("rendering material %s (%u, %u) = %u\n", materialName.c_str(), start, end, length );
 
-				if( material != nullptr ) {
-					glProgramUniform4fv( shaderProgramHandle, matAmbLocation, 1, &material->ambient[0] );
-					glProgramUniform4fv( shaderProgramHandle, matDiffLocation, 1, &material->diffuse[0] );
-					glProgramUniform4fv( shaderProgramHandle, matSpecLocation, 1, &material->specular[0] );
-					glProgramUniform1f( shaderProgramHandle, matShinLocation, material->shininess );
-
-					if( material->map_Kd != -1 ) {
-						glActiveTexture( diffuseTexture );
-						glBindTexture( GL_TEXTURE_2D, material->map_Kd );
-					}
-				}
-
-				glDrawElements( GL_TRIANGLES, length, GL_UNSIGNED_INT, (void*)(sizeof(GLuint)*start) );
+				glDrawElementsBaseVertex( GL_TRIANGLES, length, _indexType, _indexOffset(start), static_cast<GLint>(_arenaAllocation.baseVertex) );
 			}
 		}
 	} else {
-		glDrawElements( GL_TRIANGLES, static_cast<GLint>(_numIndices), GL_UNSIGNED_INT, (void*)nullptr );
+		glDrawElementsBaseVertex( GL_TRIANGLES, static_cast<GLint>(_numIndices), _indexType, _indexOffset(0), static_cast<GLint>(_arenaAllocation.baseVertex) );
 	}
 
 	return result;
 }
 
-[[maybe_unused]] inline GLuint CSCI441::ModelLoader::getNumberOfVertices() const { return _uniqueIndex; }
-[[maybe_unused]] inline GLfloat* CSCI441::ModelLoader::getVertices() const { return (_vertices != nullptr ? reinterpret_cast<GLfloat *>(&_vertices[0]) : nullptr); }
-[[maybe_unused]] inline GLfloat* CSCI441::ModelLoader::getNormals() const { return (_normals != nullptr ? reinterpret_cast<GLfloat *>(&_normals[0]) : nullptr); }
-[[maybe_unused]] inline GLfloat* CSCI441::ModelLoader::getTangents() const { return (_tangents != nullptr ? reinterpret_cast<GLfloat *>(&_tangents[0]) : nullptr); }
-[[maybe_unused]] inline GLfloat* CSCI441::ModelLoader::getTexCoords() const { return (_texCoords != nullptr ? reinterpret_cast<GLfloat *>(&_texCoords[0]) : nullptr); }
-[[maybe_unused]] inline GLuint CSCI441::ModelLoader::getNumberOfIndices() const { return _numIndices; }
-[[maybe_unused]] inline GLuint* CSCI441::ModelLoader::getIndices() const { return _indices; }
+[[maybe_unused]]
+inline bool CSCI441::ModelLoader::drawInstanced( const GLsizei instanceCount, const GLuint instanceBuffer, const GLuint shaderProgramHandle,
+                                                 const GLint matDiffLocation, const GLint matSpecLocation, const GLint matShinLocation, const GLint matAmbLocation,
+                                                 const GLenum diffuseTexture ) const {
+	_bindVertexArray();
+	CSCI441_INTERNAL::bindInstanceAttributes( instanceBuffer, _instanceModelMatrixLocation, _instanceColorLocation, _instanceStorageBlockBinding );
 
-// Read in a WaveFront *.obj File
-inline bool CSCI441::ModelLoader::_loadOBJFile( const bool INFO, const bool ERRORS ) {
-	bool result = true;
+	if( _modelType == CSCI441_INTERNAL::MODEL_TYPE::OBJ ) {
+		for( const auto& [materialName, indexStartStop] : _materialIndexStartStop ) {
+			_bindMaterial( materialName, shaderProgramHandle, matDiffLocation, matSpecLocation, matShinLocation, matAmbLocation, diffuseTexture );
 
-	std::string path;
-	if( _filename.find('/') != std::string::npos ) {
-		path = _filename.substr( 0, _filename.find_last_of('/')+1 );
+			for( const auto& [start, end] : indexStartStop ) {
+				glDrawElementsInstancedBaseVertex( GL_TRIANGLES, static_cast<GLsizei>(end - start) + 1, _indexType, _indexOffset(start), instanceCount, static_cast<GLint>(_arenaAllocation.baseVertex) );
+			}
+		}
 	} else {
-		path = "./";
+		glDrawElementsInstancedBaseVertex( GL_TRIANGLES, static_cast<GLsizei>(_numIndices), _indexType, _indexOffset(0), instanceCount, static_cast<GLint>(_arenaAllocation.baseVertex) );
 	}
 
-	if ( INFO ) CSCI441::LogUtils::log("[.obj]: -=-=-=-=-=-=-=- BEGIN %s Info -=-=-=-=-=-=-=- \n", _filename.c_str() );
+	CSCI441_INTERNAL::releaseInstanceAttributes( _instanceModelMatrixLocation, _instanceColorLocation );
 
-	time_t start, end;
-	time(&start);
+	return true;
+}
 
-	std::ifstream in( _filename );
-	if( !in.is_open() ) {
-		if (ERRORS) CSCI441::LogUtils::logError("[.obj]: [ERROR]: Could not open \"%s\"\n", _filename.c_str() );
-		if ( INFO ) CSCI441::LogUtils::log("[.obj]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=- \n", _filename.c_str() );
-		return false;
+[[maybe_unused]]
+inline bool CSCI441::ModelLoader::drawIndirect( const GLuint indirectBuffer, const GLsizei drawCount, const GLuint instanceBuffer,
+                                                const GLuint materialBlockBinding, const GLenum diffuseTexture ) const {
+	_bindVertexArray();
+	CSCI441_INTERNAL::bindInstanceAttributes( instanceBuffer, _instanceModelMatrixLocation, _instanceColorLocation, _instanceStorageBlockBinding );
+
+	if( _materialBufferd != 0 ) glBindBufferBase( GL_UNIFORM_BUFFER, materialBlockBinding, _materialBufferd );
+	if( !_drawListGroups.empty() && _drawListGroups.front().texture != CSCI441_INTERNAL::ModelMaterial::NO_TEXTURE ) {
+		glActiveTexture( diffuseTexture );
+		glBindTexture( GL_TEXTURE_2D, _drawListGroups.front().texture );
 	}
+	glBindBuffer( GL_DRAW_INDIRECT_BUFFER, indirectBuffer );
+	glMultiDrawElementsIndirect( GL_TRIANGLES, _indexType, nullptr, drawCount, 0 );
 
-	GLuint numObjects = 0, numGroups = 0;
-	GLuint numVertices = 0, numTexCoords = 0, numNormals = 0;
-	GLuint numFaces = 0, numTriangles = 0;
-    glm::vec3 minDimension = {999999.f, 999999.f, 999999.f};
-    glm::vec3 maxDimension = { -999999.f, -999999.f, -999999.f };
-	std::string line;
+	CSCI441_INTERNAL::releaseInstanceAttributes( _instanceModelMatrixLocation, _instanceColorLocation );
 
-	std::map<std::string, GLuint> uniqueCounts;
-	_uniqueIndex = 0;
+	return true;
+}
 
-	int progressCounter = 0;
+[[maybe_unused]]
+inline bool CSCI441::ModelLoader::drawBatched( const GLuint materialBlockBinding, const GLenum diffuseTexture ) const {
+	_bindVertexArray();
 
-	while( getline( in, line ) ) {
-		if( line.length() > 1 && line.at(0) == '\t' )
-			line = line.substr( 1 );
-		line.erase( line.find_last_not_of( " \n\r\t" ) + 1 );
+	if( _drawCounts.empty() ) {
+		glDrawElementsBaseVertex( GL_TRIANGLES, static_cast<GLint>(_numIndices), _indexType, _indexOffset(0), static_cast<GLint>(_arenaAllocation.baseVertex) );
+		return true;
+	}
 
-		std::vector< std::string > tokens = _tokenizeString( line, " \t" );
-		if( tokens.empty() ) continue;
+	// one call per diffuse texture, a model whose materials share a texture or use none is drawn with a single call
+	for( const auto& group : _drawListGroups ) {
+		if( group.texture != CSCI441_INTERNAL::ModelMaterial::NO_TEXTURE ) {
+			glActiveTexture( diffuseTexture );
+			glBindTexture( GL_TEXTURE_2D, group.texture );
+		}
 
-		//the line should have a single character that lets us know if it's a...
-		if( tokens[0] == "#"  || tokens[0].find_first_of('#') == 0 ) {
-            // comment ignore
-		} else if( tokens[0] == "o" ) {						// object name ignore
-			numObjects++;
-		} else if( tokens[0] == "g" ) {						// polygon group name ignore
-			numGroups++;
-		} else if( tokens[0] == "mtllib" ) {				// material library
-			std::string mtlFilename = path + tokens[1];
-			_loadMTLFile( mtlFilename.c_str(), INFO, ERRORS );
-		} else if( tokens[0] == "v" ) {						//vertex
-			numVertices++;
+		if( _materialRecordStride == static_cast<GLsizeiptr>(sizeof(CSCI441_INTERNAL::MaterialRecord)) ) {
+			glBindBufferRange( GL_UNIFORM_BUFFER, materialBlockBinding, _materialBufferd, group.recordOffset, group.recordSize );
+			glMultiDrawElementsBaseVertex( GL_TRIANGLES, _drawCounts.data() + group.firstDraw, _indexType, _drawOffsets.data() + group.firstDraw, group.numDraws, _drawBaseVertices.data() + group.firstDraw );
+		} else {
+			// the shader cannot tell the draws of one call apart, so each range is drawn with only its record bound
+			for( GLsizei i = 0; i < group.numDraws; i++ ) {
+				const auto draw = static_cast<size_t>(group.firstDraw + i);
+				glBindBufferRange( GL_UNIFORM_BUFFER, materialBlockBinding, _materialBufferd, group.recordOffset + _materialRecordStride * i, static_cast<GLsizeiptr>(sizeof(CSCI441_INTERNAL::MaterialRecord)) );
+				glDrawElementsBaseVertex( GL_TRIANGLES, _drawCounts[draw], _indexType, _drawOffsets[draw], _drawBaseVertices[draw] );
+			}
+		}
+	}
 
-			glm::vec3 pos = { strtof( tokens[1].c_str(), nullptr ),
-                            strtof( tokens[2].c_str(), nullptr ),
-                            strtof( tokens[3].c_str(), nullptr ) };
-
-			if( pos.x < minDimension.x ) minDimension.x = pos.x;
-			if( pos.x > maxDimension.x ) maxDimension.x = pos.x;
-			if( pos.y < minDimension.y ) minDimension.y = pos.y;
-			if( pos.y > maxDimension.y ) maxDimension.y = pos.y;
-			if( pos.z < minDimension.z ) minDimension.z = pos.z;
-			if( pos.z > maxDimension.z ) maxDimension.z = pos.z;
-		} else if( tokens[0] == "vn" ) {                    //vertex normal
-			numNormals++;
-		} else if( tokens[0] == "vt" ) {                    //vertex tex coord
-			numTexCoords++;
-		} else if( tokens[0] == "f" ) {                     //face!
-            //now, faces can be either quads or triangles (or maybe more?)
-            //split the string on spaces to get the number of vertices+attributes.
-            std::vector<std::string> faceTokens = _tokenizeString(line, " ");
-
-            for (GLuint i = 1; i < faceTokens.size(); i++) {
-                //need to use both the tokens and number of slashes to determine what info is there.
-                std::vector<std::string> groupTokens = _tokenizeString(faceTokens[i], "/");
-                int numSlashes = 0;
-                for (char j: faceTokens[i]) {
-                    if (j == '/') numSlashes++;
-                }
+	return true;
+}
+
+[[maybe_unused]]
+inline GLuint CSCI441::ModelLoader::drawMeshlets( const GLuint shaderProgramHandle,
+                                                  const glm::mat4& modelViewProjectionMatrix, const glm::vec3& eyePosition,
+                                                  const GLint matDiffLocation, const GLint matSpecLocation, const GLint matShinLocation, const GLint matAmbLocation,
+                                                  const GLenum diffuseTexture ) const {
+	// frustum planes in object space, extracted from the rows of the combined matrix
+	glm::vec4 frustumPlanes[6];
+	const glm::mat4 rows = glm::transpose( modelViewProjectionMatrix );
+	for( int i = 0; i < 3; i++ ) {
+		frustumPlanes[i*2]     = rows[3] + rows[i];
+		frustumPlanes[i*2 + 1] = rows[3] - rows[i];
+	}
+	for( auto& plane : frustumPlanes ) {
+		plane /= glm::length( glm::vec3( plane ) );
+	}
+
+	_bindVertexArray();
+
+	std::vector<GLsizei> counts;
+	std::vector<const void*> offsets;
+	GLuint numDrawn = 0;
+	for( const auto& [materialName, meshletStartStop] : _materialMeshletStartStop ) {
+		counts.clear();
+		offsets.clear();
+		for( const auto& [first, last] : meshletStartStop ) {
+			for( GLuint m = first; m <= last; m++ ) {
+				const CSCI441_INTERNAL::Meshlet& meshlet = _meshlets[m];
+
+				bool visible = true;
+				for( const auto& plane : frustumPlanes ) {
+					if( glm::dot( glm::vec3( plane ), meshlet.center ) + plane.w < -meshlet.radius ) {
+						visible = false;
+						break;
+					}
+				}
+				const glm::vec3 eyeToCenter = meshlet.center - eyePosition;
+				if( !visible || glm::dot( eyeToCenter, meshlet.coneAxis ) >= meshlet.coneCutoff * glm::length( eyeToCenter ) + meshlet.radius ) continue;
+
+				counts.push_back( static_cast<GLsizei>(meshlet.numIndices) );
+				offsets.push_back( _indexOffset(meshlet.indexStart) );
+			}
+		}
+		if( counts.empty() ) continue;
+
+		if( _modelType == CSCI441_INTERNAL::MODEL_TYPE::OBJ ) {
+			_bindMaterial( materialName, shaderProgramHandle, matDiffLocation, matSpecLocation, matShinLocation, matAmbLocation, diffuseTexture );
+		}
+		const std::vector<GLint> baseVertices( counts.size(), static_cast<GLint>(_arenaAllocation.baseVertex) );
+		glMultiDrawElementsBaseVertex( GL_TRIANGLES, counts.data(), _indexType, offsets.data(), static_cast<GLsizei>(counts.size()), baseVertices.data() );
+		numDrawn += static_cast<GLuint>(counts.size());
+	}
 
-                std::stringstream currentFaceTokenStream;
+	return numDrawn;
+}
+
+[[maybe_unused]]
+inline bool CSCI441::ModelLoader::drawLevelOfDetail( const GLuint lodLevel, const GLuint shaderProgramHandle,
+                                                     const GLint matDiffLocation, const GLint matSpecLocation, const GLint matShinLocation, const GLint matAmbLocation,
+                                                     const GLenum diffuseTexture ) const {
+	if( lodLevel == 0 || _lodMaterialIndexStartStop.empty() ) {
+		return draw( shaderProgramHandle, matDiffLocation, matSpecLocation, matShinLocation, matAmbLocation, diffuseTexture );
+	}
 
-                auto signedVertexIndex = static_cast<GLint>(strtol(groupTokens[0].c_str(), nullptr, 10));
-                GLuint vertexIndex = signedVertexIndex;
-                if (signedVertexIndex < 0) vertexIndex = numVertices + signedVertexIndex + 1;
+	_bindVertexArray();
 
-                currentFaceTokenStream << vertexIndex;
+	const auto& levelIndexStartStop = _lodMaterialIndexStartStop[ std::min<size_t>( lodLevel, _lodMaterialIndexStartStop.size() ) - 1 ];
+	for( const auto& [materialName, indexStartStop] : levelIndexStartStop ) {
+		if( _modelType == CSCI441_INTERNAL::MODEL_TYPE::OBJ ) {
+			_bindMaterial( materialName, shaderProgramHandle, matDiffLocation, matSpecLocation, matShinLocation, matAmbLocation, diffuseTexture );
+		}
+		for( const auto& [start, end] : indexStartStop ) {
+			glDrawElementsBaseVertex( GL_TRIANGLES, static_cast<GLsizei>(end - start) + 1, _indexType, _indexOffset(start), static_cast<GLint>(_arenaAllocation.baseVertex) );
+		}
+	}
 
-                //based on combination of number of tokens and slashes, we can determine what we have.
-                if (groupTokens.size() == 2 && numSlashes == 1) {
-                    _hasVertexTexCoords = true;
+	return true;
+}
 
-                    auto signedTexCoordIndex = static_cast<GLint>(strtol(groupTokens[1].c_str(), nullptr, 10));
-                    GLuint texCoordIndex = signedTexCoordIndex;
-                    if (signedTexCoordIndex < 0) texCoordIndex = numTexCoords + signedTexCoordIndex + 1;
+[[maybe_unused]]
+inline GLuint CSCI441::ModelLoader::selectLevelOfDetail( const glm::mat4& modelViewMatrix, const glm::mat4& projectionMatrix,
+                                                         const GLfloat viewportHeight, const GLfloat maxPixelError ) const {
+	if( _lodErrors.size() <= 1 ) return 0;
+
+	const glm::vec4 center = modelViewMatrix * glm::vec4( glm::vec3( _boundingSphere ), 1.0f );
+	const GLfloat scale = std::max( { glm::length( glm::vec3( modelViewMatrix[0] ) ), glm::length( glm::vec3( modelViewMatrix[1] ) ), glm::length( glm::vec3( modelViewMatrix[2] ) ) } );
+	GLfloat pixelsPerUnit = projectionMatrix[1][1] * viewportHeight * 0.5f * scale;
+	if( projectionMatrix[2][3] != 0.0f ) {
+		// perspective, measure at the nearest point of the bounding sphere
+		const GLfloat distance = -center.z - _boundingSphere.w * scale;
+		if( distance <= 0.0f ) return 0;
+		pixelsPerUnit /= distance;
+	}
 
-                    currentFaceTokenStream << "/" << texCoordIndex;
-                } else if (groupTokens.size() == 2 && numSlashes == 2) {
-                    _hasVertexNormals = true;
+	GLuint lodLevel = 0;
+	while( lodLevel + 1 < _lodErrors.size() && _lodErrors[lodLevel + 1] * pixelsPerUnit <= maxPixelError ) {
+		lodLevel++;
+	}
+	return lodLevel;
+}
 
-                    auto signedNormalIndex = static_cast<GLint>(strtol(groupTokens[1].c_str(), nullptr, 10));
-                    GLuint normalIndex = signedNormalIndex;
-                    if (signedNormalIndex < 0) normalIndex = numNormals + signedNormalIndex + 1;
+inline void CSCI441::ModelLoader::_bindMaterial( const std::string& materialName, const GLuint shaderProgramHandle,
+                                                 const GLint matDiffLocation, const GLint matSpecLocation, const GLint matShinLocation, const GLint matAmbLocation,
+                                                 const GLenum diffuseTexture ) const {
+	const auto materialIter = _materials.find( materialName );
+	if( materialIter == _materials.end() ) return;
+
+	const CSCI441_INTERNAL::ModelMaterial* material = materialIter->second;
+	glProgramUniform4fv( shaderProgramHandle, matAmbLocation, 1, &material->ambient[0] );
+	glProgramUniform4fv( shaderProgramHandle, matDiffLocation, 1, &material->diffuse[0] );
+	glProgramUniform4fv( shaderProgramHandle, matSpecLocation, 1, &material->specular[0] );
+	glProgramUniform1f( shaderProgramHandle, matShinLocation, material->shininess );
+
+	if( material->map_Kd != CSCI441_INTERNAL::ModelMaterial::NO_TEXTURE ) {
+		glActiveTexture( diffuseTexture );
+		glBindTexture( GL_TEXTURE_2D, material->map_Kd );
+	}
+}
 
-                    currentFaceTokenStream << "//" << normalIndex;
-                } else if (groupTokens.size() == 3) {
-                    _hasVertexTexCoords = true;
-                    _hasVertexNormals = true;
+[[maybe_unused]] inline GLuint CSCI441::ModelLoader::getNumberOfVertices() const { return _uniqueIndex; }
+[[maybe_unused]] inline GLfloat* CSCI441::ModelLoader::getVertices() const { return (_vertices != nullptr ? reinterpret_cast<GLfloat *>(&_vertices[0]) : nullptr); }
+[[maybe_unused]] inline GLfloat* CSCI441::ModelLoader::getNormals() const { return (_normals != nullptr ? reinterpret_cast<GLfloat *>(&_normals[0]) : nullptr); }
+[[maybe_unused]] inline GLfloat* CSCI441::ModelLoader::getTangents() const { return (_tangents != nullptr ? reinterpret_cast<GLfloat *>(&_tangents[0]) : nullptr); }
+[[maybe_unused]] inline GLfloat* CSCI441::ModelLoader::getTexCoords() const { return (_texCoords != nullptr ? reinterpret_cast<GLfloat *>(&_texCoords[0]) : nullptr); }
+[[maybe_unused]] inline GLfloat* CSCI441::ModelLoader::getColors() const { return (_colors != nullptr ? reinterpret_cast<GLfloat *>(&_colors[0]) : nullptr); }
+[[maybe_unused]] inline GLuint CSCI441::ModelLoader::getNumberOfIndices() const { return _numIndices; }
+[[maybe_unused]] inline GLuint* CSCI441::ModelLoader::getIndices() const { return _indices; }
+[[maybe_unused]] inline GLenum CSCI441::ModelLoader::getIndexType() const { return _indexType; }
+[[maybe_unused]] inline glm::mat4 CSCI441::ModelLoader::getPositionDequantizationMatrix() const { return _positionDequantization; }
+[[maybe_unused]] inline const std::vector<CSCI441_INTERNAL::Meshlet>& CSCI441::ModelLoader::getMeshlets() const { return _meshlets; }
+[[maybe_unused]] inline GLuint CSCI441::ModelLoader::getNumberOfLevelsOfDetail() const { return static_cast<GLuint>(_lodMaterialIndexStartStop.size()) + 1; }
+[[maybe_unused]] inline GLfloat CSCI441::ModelLoader::getLevelOfDetailError( const GLuint lodLevel ) const { return lodLevel == 0 || _lodErrors.empty() ? 0.0f : _lodErrors[ std::min<size_t>( lodLevel, _lodErrors.size() - 1 ) ]; }
+[[maybe_unused]] inline size_t CSCI441::ModelLoader::getPeakResidentSetSize() const { return _peakResidentSetSize; }
+[[maybe_unused]] inline const CSCI441::ModelLoader::LoadStats& CSCI441::ModelLoader::getLoadStats() const { return _loadStats; }
+[[maybe_unused]] inline glm::vec3 CSCI441::ModelLoader::getBoundingBoxMin() const { return _boundingBoxMin; }
+[[maybe_unused]] inline glm::vec3 CSCI441::ModelLoader::getBoundingBoxMax() const { return _boundingBoxMax; }
 
-                    auto signedTexCoordIndex = static_cast<GLint>(strtol(groupTokens[1].c_str(), nullptr, 10));
-                    GLuint texCoordIndex = signedTexCoordIndex;
-                    if (signedTexCoordIndex < 0) texCoordIndex = numTexCoords + signedTexCoordIndex + 1;
+[[maybe_unused]]
+inline std::vector<CSCI441_INTERNAL::DrawElementsIndirectCommand> CSCI441::ModelLoader::getDrawCommands() const {
+	std::vector<CSCI441_INTERNAL::DrawElementsIndirectCommand> commands;
+	if( _drawCounts.empty() ) {
+		if( _numIndices > 0 ) commands.push_back( { _numIndices, 1, _arenaAllocation.firstIndex, static_cast<GLint>(_arenaAllocation.baseVertex), 0 } );
+		return commands;
+	}
 
-                    auto signedNormalIndex = static_cast<GLint>(strtol(groupTokens[2].c_str(), nullptr, 10));
-                    GLuint normalIndex = signedNormalIndex;
-                    if (signedNormalIndex < 0) normalIndex = numNormals + signedNormalIndex + 1;
+	const size_t indexSize = (_indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint));
+	for( size_t i = 0; i < _drawCounts.size(); i++ ) {
+		commands.push_back( { static_cast<GLuint>(_drawCounts[i]), 1, static_cast<GLuint>(reinterpret_cast<uintptr_t>(_drawOffsets[i]) / indexSize), _drawBaseVertices[i], 0 } );
+	}
+	return commands;
+}
 
-                    currentFaceTokenStream << "/" << texCoordIndex << "/" << normalIndex;
-                } else if (groupTokens.size() != 1) {
-                    if (ERRORS) CSCI441::LogUtils::logError("[.obj]: [ERROR]: Malformed OBJ file, %s.\n", _filename.c_str());
-                    return false;
-                }
+[[maybe_unused]] inline CSCI441::GeometryArena::Allocation CSCI441::ModelLoader::getGeometryArenaAllocation() const { return _arenaAllocation; }
 
-                std::string processedFaceToken = currentFaceTokenStream.str();
-                if (uniqueCounts.find(processedFaceToken) == uniqueCounts.end()) {
-                    uniqueCounts.insert(std::pair<std::string, long int>(processedFaceToken, _uniqueIndex));
-                    _uniqueIndex++;
-                }
-            }
+[[maybe_unused]]
+inline bool CSCI441::ModelLoader::saveCache( std::string cacheFilename, const bool ERRORS ) const {
+	if( cacheFilename.empty() ) cacheFilename = _filename + CSCI441_INTERNAL::MESH_CACHE_EXTENSION;
+
+	if( _vertices == nullptr || _indices == nullptr ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.c441mesh]: [ERROR]: No model is loaded to save to \"%s\"\n", cacheFilename.c_str() );
+		return false;
+	}
+
+	// serialize the material table followed by the index ranges of each material
+	std::string materialData;
+	const auto appendBytes = [&materialData](const void* bytes, const size_t numBytes) {
+		materialData.append( static_cast<const char*>(bytes), numBytes );
+	};
+	const auto appendString = [&appendBytes](const std::string& value) {
+		const auto length = static_cast<uint32_t>(value.size());
+		appendBytes( &length, sizeof(length) );
+		appendBytes( value.data(), value.size() );
+	};
+	for( const auto& [name, material] : _materials ) {
+		CSCI441_INTERNAL::MeshCacheMaterial cachedMaterial{};
+		memcpy( cachedMaterial.ambient, &material->ambient[0], sizeof(cachedMaterial.ambient) );
+		memcpy( cachedMaterial.diffuse, &material->diffuse[0], sizeof(cachedMaterial.diffuse) );
+		memcpy( cachedMaterial.specular, &material->specular[0], sizeof(cachedMaterial.specular) );
+		memcpy( cachedMaterial.emissive, &material->emissive[0], sizeof(cachedMaterial.emissive) );
+		cachedMaterial.shininess = material->shininess;
+		appendString( name );
+		appendBytes( &cachedMaterial, sizeof(cachedMaterial) );
+		appendString( material->map_KdFilename );
+		appendString( material->map_dFilename );
+	}
+	for( const auto& [name, indexStartStop] : _materialIndexStartStop ) {
+		appendString( name );
+		const auto numRanges = static_cast<uint32_t>(indexStartStop.size());
+		appendBytes( &numRanges, sizeof(numRanges) );
+		for( const auto& [start, stop] : indexStartStop ) {
+			const uint32_t range[2] = { start, stop };
+			appendBytes( range, sizeof(range) );
+		}
+	}
+	const auto numDependentFiles = static_cast<uint32_t>(_dependentFiles.size());
+	appendBytes( &numDependentFiles, sizeof(numDependentFiles) );
+	for( const auto& dependentFile : _dependentFiles ) {
+		appendString( dependentFile );
+	}
+
+	const auto alignOffset = [](const uint64_t offset) {
+		return (offset + CSCI441_INTERNAL::MESH_CACHE_ALIGNMENT - 1) / CSCI441_INTERNAL::MESH_CACHE_ALIGNMENT * CSCI441_INTERNAL::MESH_CACHE_ALIGNMENT;
+	};
+
+	CSCI441_INTERNAL::MeshCacheHeader header{};
+	memcpy( header.magic, CSCI441_INTERNAL::MESH_CACHE_MAGIC, sizeof(header.magic) );
+	header.version = CSCI441_INTERNAL::MESH_CACHE_VERSION;
+	header.byteOrderMark = CSCI441_INTERNAL::MESH_CACHE_BYTE_ORDER_MARK;
+	header.modelType = static_cast<uint32_t>(_modelType);
+	header.attributeFlags = (_hasVertexNormals ? static_cast<uint32_t>(CSCI441_INTERNAL::MeshCacheHeader::HAS_NORMALS) : 0u)
+						  | (_hasVertexTexCoords ? static_cast<uint32_t>(CSCI441_INTERNAL::MeshCacheHeader::HAS_TEX_COORDS) : 0u)
+						  | (_colors != nullptr ? static_cast<uint32_t>(CSCI441_INTERNAL::MeshCacheHeader::HAS_COLORS) : 0u);
+	header.loadOptions = _loadOptionFlags();
+	header.weldEpsilon = _loadOptions.weldVertices ? _loadOptions.weldEpsilon : 0.0f;
+	header.normalCreaseAngle = _loadOptions.autoGenNormals ? _loadOptions.normalCreaseAngle : 0.0f;
+	header.numVertices = _uniqueIndex;
+	header.numIndices = _numIndices;
+	header.numMaterials = static_cast<uint32_t>(_materials.size());
+	header.numMaterialRanges = static_cast<uint32_t>(_materialIndexStartStop.size());
+	header.vertexDataOffset = alignOffset( sizeof(header) );
+	header.vertexDataSize = (sizeof(glm::vec3)*2 + sizeof(glm::vec2) + sizeof(glm::vec4) * (_colors != nullptr ? 2 : 1)) * static_cast<uint64_t>(_uniqueIndex);
+	header.indexDataOffset = alignOffset( header.vertexDataOffset + header.vertexDataSize );
+	header.materialDataOffset = alignOffset( header.indexDataOffset + sizeof(GLuint) * static_cast<uint64_t>(_numIndices) );
+	header.materialDataSize = materialData.size();
+	header.fileSize = header.materialDataOffset + header.materialDataSize;
+	header.sourceFileSize = _sourceFileSize;
+	header.sourceModificationTime = _sourceModificationTime;
+
+	FILE* cacheFile = fopen( cacheFilename.c_str(), "wb" );
+	if( cacheFile == nullptr ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.c441mesh]: [ERROR]: Could not open \"%s\" for writing\n", cacheFilename.c_str() );
+		return false;
+	}
 
-            numTriangles += (faceTokens.size() - 1 - 3 + 1);
+	uint64_t bytesWritten = 0;
+	bool result = true;
+	const auto writeBytes = [&](const void* bytes, const size_t numBytes) {
+		if( numBytes > 0 && fwrite( bytes, 1, numBytes, cacheFile ) != numBytes ) result = false;
+		bytesWritten += numBytes;
+	};
+	const auto padTo = [&](const uint64_t offset) {
+		static constexpr char padding[CSCI441_INTERNAL::MESH_CACHE_ALIGNMENT] = {0};
+		writeBytes( padding, static_cast<size_t>(offset - bytesWritten) );
+	};
 
-            numFaces++;
-        } else if( tokens[0] == "usemtl" ) {					        // use material library
+	writeBytes( &header, sizeof(header) );
+	padTo( header.vertexDataOffset );
+	writeBytes( _vertices, sizeof(glm::vec3) * _uniqueIndex );
+	writeBytes( _normals, sizeof(glm::vec3) * _uniqueIndex );
+	writeBytes( _texCoords, sizeof(glm::vec2) * _uniqueIndex );
+	writeBytes( _tangents, sizeof(glm::vec4) * _uniqueIndex );
+	if( _colors != nullptr ) writeBytes( _colors, sizeof(glm::vec4) * _uniqueIndex );
+	padTo( header.indexDataOffset );
+	writeBytes( _indices, sizeof(GLuint) * _numIndices );
+	padTo( header.materialDataOffset );
+	writeBytes( materialData.data(), materialData.size() );
+
+	if( fclose( cacheFile ) != 0 ) result = false;
+	if( !result ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.c441mesh]: [ERROR]: Could not write \"%s\"\n", cacheFilename.c_str() );
+		remove( cacheFilename.c_str() );
+	}
+	return result;
+}
 
+inline std::string CSCI441::ModelLoader::LoadStats::toJSON() const {
+	std::string escapedFilename;
+	for( const char c : filename ) {
+		if( c == '"' || c == '\\' ) {
+			escapedFilename += '\\';
+			escapedFilename += c;
+		} else if( static_cast<unsigned char>(c) < 0x20 ) {
+			char escape[7];
+			snprintf( escape, sizeof(escape), "\\u%04x", static_cast<unsigned>(c) );
+			escapedFilename += escape;
 		} else {
-            if (INFO) CSCI441::LogUtils::log("[.obj]: ignoring line: %s\n", line.c_str() );
+			escapedFilename += c;
 		}
+	}
 
-		if (INFO) {
-			progressCounter++;
-			if( progressCounter % 5000 == 0 ) {
-				CSCI441::LogUtils::log("\33[2K\r");
-				switch( progressCounter ) {
-					case 5000:	CSCI441::LogUtils::log("[.obj]: scanning %s...\\", _filename.c_str());	break;
-					case 10000:	CSCI441::LogUtils::log("[.obj]: scanning %s...|", _filename.c_str());	break;
-					case 15000:	CSCI441::LogUtils::log("[.obj]: scanning %s.../", _filename.c_str());	break;
-					case 20000:	CSCI441::LogUtils::log("[.obj]: scanning %s...-", _filename.c_str());	break;
-                    default: break;
-				}
-				fflush(stdout);
-			}
-			if( progressCounter == 20000 )
-				progressCounter = 0;
+	char buffer[1024];
+	snprintf( buffer, sizeof(buffer),
+		"  \"milliseconds\": {\n"
+		"    \"scan\": %.3f,\n"
+		"    \"parse\": %.3f,\n"
+		"    \"dedup\": %.3f,\n"
+		"    \"normalGeneration\": %.3f,\n"
+		"    \"tangentGeneration\": %.3f,\n"
+		"    \"optimization\": %.3f,\n"
+		"    \"mtl\": %.3f,\n"
+		"    \"textureDecode\": %.3f,\n"
+		"    \"gpuUpload\": %.3f,\n"
+		"    \"total\": %.3f\n"
+		"  },\n"
+		"  \"bytesRead\": %llu,\n"
+		"  \"peakResidentSetSize\": %llu,\n"
+		"  \"numVertices\": %u,\n"
+		"  \"numTriangles\": %u,\n"
+		"  \"uniqueVertexRatio\": %.6f\n"
+		"}\n",
+		scanMilliseconds, parseMilliseconds, dedupMilliseconds, normalGenerationMilliseconds, tangentGenerationMilliseconds,
+		optimizationMilliseconds, mtlMilliseconds, textureDecodeMilliseconds, gpuUploadMilliseconds, totalMilliseconds,
+		static_cast<unsigned long long>(bytesRead), static_cast<unsigned long long>(peakResidentSetSize),
+		numVertices, numTriangles, uniqueVertexRatio() );
+
+	return "{\n  \"filename\": \"" + escapedFilename + "\",\n" + buffer;
+}
+
+[[maybe_unused]]
+inline bool CSCI441::ModelLoader::saveLoadStats( std::string statsFilename, const bool ERRORS ) const {
+	if( statsFilename.empty() ) statsFilename = _filename + CSCI441_INTERNAL::LOAD_STATS_EXTENSION;
+
+	if( _loadStats.filename.empty() ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.stats.json]: [ERROR]: No model has been loaded to save the statistics of to \"%s\"\n", statsFilename.c_str() );
+		return false;
+	}
+
+	FILE* statsFile = fopen( statsFilename.c_str(), "w" );
+	if( statsFile == nullptr ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.stats.json]: [ERROR]: Could not open \"%s\" for writing\n", statsFilename.c_str() );
+		return false;
+	}
+
+	const std::string json = _loadStats.toJSON();
+	bool result = fwrite( json.data(), 1, json.size(), statsFile ) == json.size();
+	if( fclose( statsFile ) != 0 ) result = false;
+	if( !result ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.stats.json]: [ERROR]: Could not write \"%s\"\n", statsFilename.c_str() );
+		remove( statsFilename.c_str() );
+	}
+	return result;
+}
+
+// Read in a WaveFront *.obj File
+//
+//      The file is memory mapped and split at line boundaries into one chunk
+//  per thread.  Each chunk is parsed independently, then the chunks are merged
+//  in file order so relative indices, materials, and unique vertices resolve
+//  exactly as they would reading the file front to back.
+inline bool CSCI441::ModelLoader::_loadOBJFile( const bool INFO, const bool ERRORS, GLuint numThreads ) {
+	bool result = true;
+
+	std::string path;
+	if( _filename.find('/') != std::string::npos ) {
+		path = _filename.substr( 0, _filename.find_last_of('/')+1 );
+	} else {
+		path = "./";
+	}
+
+	if ( INFO ) CSCI441::LogUtils::log("[.obj]: -=-=-=-=-=-=-=- BEGIN %s Info -=-=-=-=-=-=-=- \n", _filename.c_str() );
+	if (INFO && _loadOptions.streamLoad) CSCI441::LogUtils::log("[.obj]: [WARN]: Only PLY and binary STL files are streamed, loading the model into memory\n" );
+
+	const auto start = std::chrono::steady_clock::now();
+
+	CSCI441_INTERNAL::MappedFile objFile;
+	if( !objFile.open( _filename.c_str() ) ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.obj]: [ERROR]: Could not open \"%s\"\n", _filename.c_str() );
+		if ( INFO ) CSCI441::LogUtils::log("[.obj]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=- \n", _filename.c_str() );
+		return false;
+	}
+
+	// small files are not worth the cost of starting a thread
+	if( numThreads == 0 ) numThreads = std::max( 1u, std::thread::hardware_concurrency() );
+	numThreads = static_cast<GLuint>( std::min<size_t>( numThreads, objFile.size() / OBJ_MIN_BYTES_PER_THREAD + 1 ) );
+
+	if (INFO) CSCI441::LogUtils::log("[.obj]: parsing %s...", _filename.c_str() );
+
+	// split the file at line boundaries
+	std::vector<CSCI441_INTERNAL::OBJChunk> chunks( numThreads );
+	const char* fileEnd = objFile.data() + objFile.size();
+	const char* chunkBegin = objFile.data();
+	for( GLuint i = 0; i < numThreads; i++ ) {
+		const char* chunkEnd = fileEnd;
+		if( i + 1 < numThreads ) {
+			CSCI441_INTERNAL::TextCursor splitCursor( objFile.data() + objFile.size() / numThreads * (i + 1), fileEnd );
+			if( splitCursor.current < chunkBegin ) splitCursor.current = chunkBegin;
+			splitCursor.skipLine();
+			chunkEnd = splitCursor.current;
 		}
+		chunks[i].begin = chunkBegin;
+		chunks[i].end = chunkEnd;
+		chunkBegin = chunkEnd;
+	}
+
+	_loadStats.scanMilliseconds += CSCI441_INTERNAL::millisecondsSince( start );
+	const auto parseStart = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> workers;
+	for( GLuint i = 1; i < numThreads; i++ ) {
+		workers.emplace_back( _parseOBJChunk, std::ref( chunks[i] ) );
+	}
+	_parseOBJChunk( chunks[0] );
+	for( auto& worker : workers ) {
+		worker.join();
 	}
-	in.close();
 
 	if (INFO) {
 		CSCI441::LogUtils::log("\33[2K\r" );
-		CSCI441::LogUtils::log("[.obj]: scanning %s...done!\n", _filename.c_str() );
-		CSCI441::LogUtils::log("[.obj]: ------------\n" );
-		CSCI441::LogUtils::log("[.obj]: Model Stats:\n" );
-		CSCI441::LogUtils::log("[.obj]: Vertices:  \t%u\tNormals:  \t%u\tTex Coords:\t%u\n", numVertices, numNormals, numTexCoords );
-		CSCI441::LogUtils::log("[.obj]: Unique Verts:\t%u\n", _uniqueIndex );
-		CSCI441::LogUtils::log("[.obj]: Faces:     \t%u\tTriangles:\t%u\n", numFaces, numTriangles );
-		CSCI441::LogUtils::log("[.obj]: Objects:   \t%u\tGroups:   \t%u\n", numObjects, numGroups );
-
-        glm::vec3 sizeDimensions = maxDimension - minDimension;
-		CSCI441::LogUtils::log("[.obj]: Dimensions:\t(%f, %f, %f)\n", sizeDimensions.x, sizeDimensions.y, sizeDimensions.z );
+		CSCI441::LogUtils::log("[.obj]: parsing %s...done!\n", _filename.c_str() );
 	}
 
-	if( _hasVertexNormals || !sAUTO_GEN_NORMALS ) {
-		if (INFO && !_hasVertexNormals)
-			CSCI441::LogUtils::log("[.obj]: [WARN]: No vertex normals exist on model.  To autogenerate vertex\n\tnormals, call CSCI441::ModelLoader::enableAutoGenerateNormals()\n\tprior to loading the model file.\n" );
-		if (INFO && sAUTO_GEN_TANGENTS) CSCI441::LogUtils::log("[.obj]: Vertex tangents will be autogenerated\n" );
-        _allocateAttributeArrays(_uniqueIndex, numTriangles*3);
-	} else {
-		if (INFO) CSCI441::LogUtils::log("[.obj]: No vertex normals exist on model, vertex normals will be autogenerated\n" );
-		if (INFO && sAUTO_GEN_TANGENTS) CSCI441::LogUtils::log("[.obj]: Vertex tangents will be autogenerated\n" );
-        _allocateAttributeArrays(numTriangles * 3, numTriangles*3);
+	// prefix sum the attribute counts of each chunk and gather the attributes in file order
+	GLuint numObjects = 0, numGroups = 0;
+	GLuint numFaces = 0, numTriangles = 0;
+	size_t numVertices = 0, numTexCoords = 0, numNormals = 0, numFaceVertices = 0;
+    glm::vec3 minDimension = {999999.f, 999999.f, 999999.f};
+    glm::vec3 maxDimension = { -999999.f, -999999.f, -999999.f };
+	std::vector<size_t> vertexOffsets( numThreads ), texCoordOffsets( numThreads ), normalOffsets( numThreads );
+
+	for( GLuint i = 0; i < numThreads; i++ ) {
+		if( chunks[i].malformed ) {
+			if (ERRORS) CSCI441::LogUtils::logError("[.obj]: [ERROR]: Malformed OBJ file, %s.\n", _filename.c_str());
+			if ( INFO ) CSCI441::LogUtils::log("[.obj]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=- \n", _filename.c_str() );
+			return false;
+		}
+		vertexOffsets[i] = numVertices;
+		texCoordOffsets[i] = numTexCoords;
+		normalOffsets[i] = numNormals;
+
+		numVertices += chunks[i].vertices.size();
+		numTexCoords += chunks[i].texCoords.size();
+		numNormals += chunks[i].normals.size();
+		numFaceVertices += chunks[i].faceVertices.size();
+		numFaces += static_cast<GLuint>( chunks[i].faceSizes.size() );
+		numObjects += chunks[i].numObjects;
+		numGroups += chunks[i].numGroups;
+		minDimension = glm::min( minDimension, chunks[i].minDimension );
+		maxDimension = glm::max( maxDimension, chunks[i].maxDimension );
 	}
 
-	auto objVertices  = new glm::vec3[numVertices];
-	auto objNormals   = new glm::vec3[numNormals];
-    auto objTexCoords = new glm::vec2[numTexCoords];
+	_loadStats.parseMilliseconds += CSCI441_INTERNAL::millisecondsSince( parseStart );
+
+	// read the material libraries first so their textures decode while the faces are processed
+	for( const auto& chunk : chunks ) {
+		for( const auto& directive : chunk.directives ) {
+			if( directive.type == CSCI441_INTERNAL::OBJDirective::TYPE::MTLLIB ) {
+				std::string mtlFilename = path;
+				mtlFilename += directive.text;
+				_loadMTLFile( mtlFilename.c_str(), INFO, ERRORS );
+			}
+		}
+	}
+	_decodeMaterialTextures( path, INFO, ERRORS );
+	const auto dedupStart = std::chrono::steady_clock::now();
+
+	std::vector<glm::vec3> objVertices, objNormals;
+	std::vector<glm::vec2> objTexCoords;
+	objVertices.reserve( numVertices );
+	objNormals.reserve( numNormals );
+	objTexCoords.reserve( numTexCoords );
+	for( auto& chunk : chunks ) {
+		objVertices.insert( objVertices.end(), chunk.vertices.begin(), chunk.vertices.end() );
+		objNormals.insert( objNormals.end(), chunk.normals.begin(), chunk.normals.end() );
+		objTexCoords.insert( objTexCoords.end(), chunk.texCoords.begin(), chunk.texCoords.end() );
+		std::vector<glm::vec3>().swap( chunk.vertices );
+		std::vector<glm::vec3>().swap( chunk.normals );
+		std::vector<glm::vec2>().swap( chunk.texCoords );
+	}
 
-	std::vector<glm::vec3> verticesTemps;
-	std::vector<glm::vec2> texCoordsTemp;
+	// attributes of each unique v/t/n combination in the order they are first referenced
+	std::vector<glm::vec3> uniqueVertices, uniqueNormals;
+	std::vector<glm::vec2> uniqueTexCoords;
+	std::vector<GLuint> indices;
+	std::vector<GLuint> faceCorners;
+	indices.reserve( (numFaceVertices > 2 * numFaces ? numFaceVertices - 2 * numFaces : 0) * 3 );
 
-	CSCI441::LogUtils::log("[.obj]: ------------\n" );
+	CSCI441_INTERNAL::VertexIndexTable uniqueCounts( numVertices );
 
-	uniqueCounts.clear();
 	_uniqueIndex = 0;
 	_numIndices = 0;
 
-	in.open( _filename );
-
-	GLuint verticesSeen = 0, texCoordsSeen = 0, normalsSeen = 0, indicesSeen = 0;
-	GLuint uniqueNumVertices = 0;
+	GLuint indicesSeen = 0;
 
 	std::string currentMaterial = "default";
 	_materialIndexStartStop.insert( std::pair< std::string, std::vector< std::pair< GLuint, GLuint > > >( currentMaterial, std::vector< std::pair< GLuint, GLuint > >(1) ) );
 	_materialIndexStartStop.find( currentMaterial )->second.back().first = indicesSeen;
 
-	while( getline( in, line ) ) {
-		if( line.length() > 1 && line.at(0) == '\t' )
-			line = line.substr( 1 );
-		line.erase( line.find_last_not_of( " \n\r\t" ) + 1 );
-
-		auto tokens = _tokenizeString( line, " \t" );
-		if( tokens.empty() ) continue;
-
-		//the line should have a single character that lets us know if it's a...
-		if( tokens[0] == "#" || tokens[0].find_first_of('#') == 0   // comment ignore
-            || tokens[0] == "o"                                         // object name ignore
-            || tokens[0] == "g"                                         // polygon group name ignore
-            || tokens[0] == "mtllib"                                    // material library
-            || tokens[0] == "s"                                         // smooth shading
-        ) {
-
-		} else if( tokens[0] == "usemtl" ) {					        // use material library
+	const auto processDirective = [&](const CSCI441_INTERNAL::OBJDirective& directive) {
+		if( directive.type == CSCI441_INTERNAL::OBJDirective::TYPE::MTLLIB ) {						// material library
+			// already read before the faces were processed
+		} else if( directive.type == CSCI441_INTERNAL::OBJDirective::TYPE::USEMTL ) {				// use material library
 			if( currentMaterial == "default" && indicesSeen == 0 ) {
 				_materialIndexStartStop.clear();
 			} else {
 				_materialIndexStartStop.find( currentMaterial )->second.back().second = indicesSeen - 1;
 			}
-			currentMaterial = tokens[1];
+			currentMaterial = directive.text;
 			if( _materialIndexStartStop.find( currentMaterial ) == _materialIndexStartStop.end() ) {
 				_materialIndexStartStop.insert( std::pair< std::string, std::vector< std::pair< GLuint, GLuint > > >( currentMaterial, std::vector< std::pair< GLuint, GLuint > >(1) ) );
 				_materialIndexStartStop.find( currentMaterial )->second.back().first = indicesSeen;
 			} else {
 				_materialIndexStartStop.find( currentMaterial )->second.emplace_back(  indicesSeen, -1 );
 			}
-		} else if( tokens[0] == "v" ) {						//vertex
-			objVertices[verticesSeen++] = glm::vec3(strtof(tokens[1].c_str(), nullptr ),
-                                                    strtof( tokens[2].c_str(), nullptr ),
-                                                    strtof( tokens[3].c_str(), nullptr ) );
-		} else if( tokens[0] == "vn" ) {                    //vertex normal
-			objNormals[normalsSeen++] = glm::vec3(strtof(tokens[1].c_str(), nullptr ),
-                                                  strtof( tokens[2].c_str(), nullptr ),
-                                                  strtof( tokens[3].c_str(), nullptr ));
-		} else if( tokens[0] == "vt" ) {                    //vertex tex coord
-		    objTexCoords[texCoordsSeen++] = glm::vec2(strtof(tokens[1].c_str(), nullptr ),
-                                                      strtof( tokens[2].c_str(), nullptr ));
-		} else if( tokens[0] == "f" ) {                     //face!
-            std::vector<std::string> processedFaceTokens;
-
-            bool faceHasVertexNormals = false;
-            bool faceHasTextureCoordinates = false;
-
-            for(GLuint i = 1; i < tokens.size(); i++) {
-                //need to use both the tokens and number of slashes to determine what info is there.
-                auto vertexAttributeTokens = _tokenizeString(tokens[i], "/");
-                int numAttributeSlashes = 0;
-                for(char j : tokens[i]) {
-                    if(j == '/') numAttributeSlashes++;
-                }
-
-                std::stringstream currentFaceTokenStream;
-
-                auto signedVertexIndex = static_cast<GLint>(strtol(vertexAttributeTokens[0].c_str(), nullptr, 10));
-                GLuint vertexIndex = signedVertexIndex;
-                if(signedVertexIndex < 0) vertexIndex = verticesSeen + signedVertexIndex + 1;
-                currentFaceTokenStream << vertexIndex;
-
-            	GLuint texCoordIndex = 0, normalIndex = 0;
-
-                //based on combination of number of tokens and slashes, we can determine what we have.
-                if(vertexAttributeTokens.size() == 2 && numAttributeSlashes == 1) {
-                    // v/t
-                    _hasVertexTexCoords = true;
-                    faceHasTextureCoordinates = true;
-
-                    auto signedTexCoordIndex = static_cast<GLint>(strtol(vertexAttributeTokens[1].c_str(), nullptr, 10));
-                    texCoordIndex = signedTexCoordIndex;
-                    if(signedTexCoordIndex < 0) texCoordIndex = texCoordsSeen + signedTexCoordIndex + 1;
-                    currentFaceTokenStream << "/" << texCoordIndex;
-                } else if(vertexAttributeTokens.size() == 2 && numAttributeSlashes == 2) {
-                    // v//n
-                    _hasVertexNormals = true;
-                    faceHasVertexNormals = true;
-
-                    auto signedNormalIndex = static_cast<GLint>(strtol(vertexAttributeTokens[1].c_str(), nullptr, 10));
-                    normalIndex = signedNormalIndex;
-                    if(signedNormalIndex < 0) normalIndex = normalsSeen + signedNormalIndex + 1;
-                    currentFaceTokenStream << "//" << normalIndex;
-                } else if(vertexAttributeTokens.size() == 3) {
-                    // v/t/n
-                    _hasVertexTexCoords = true;
-                    faceHasTextureCoordinates = true;
-                    _hasVertexNormals = true;
-                    faceHasVertexNormals = true;
-
-                    auto signedTexCoordIndex = static_cast<GLint>(strtol(vertexAttributeTokens[1].c_str(), nullptr, 10));
-                    texCoordIndex = signedTexCoordIndex;
-                    if(signedTexCoordIndex < 0) texCoordIndex = texCoordsSeen + signedTexCoordIndex + 1;
-
-                    auto signedNormalIndex = static_cast<GLint>(strtol(vertexAttributeTokens[2].c_str(), nullptr, 10));
-                    normalIndex = signedNormalIndex;
-                    if(signedNormalIndex < 0) normalIndex = normalsSeen + signedNormalIndex + 1;
-
-                    currentFaceTokenStream << "/" << texCoordIndex << "/" << normalIndex;
-                } else if(vertexAttributeTokens.size() != 1) {
-                    if (ERRORS) CSCI441::LogUtils::logError("[.obj]: [ERROR]: Malformed OBJ file, %s.\n", _filename.c_str());
-                    return false;
-                }
-
-                auto processedFaceToken = currentFaceTokenStream.str();
-                processedFaceTokens.push_back(processedFaceToken);
-
-                // check if we've seen this attribute combination before
-				if( uniqueCounts.find( processedFaceToken ) == uniqueCounts.end() ) {
-                    // if not, add it to the list
-					uniqueCounts.insert( std::pair<std::string,GLuint>(processedFaceToken, uniqueNumVertices) );
-
-					if( _hasVertexNormals || !sAUTO_GEN_NORMALS ) {
-						_vertices[ _uniqueIndex ] = objVertices[ vertexIndex - 1 ];
-						if(faceHasTextureCoordinates && texCoordIndex != 0) { _texCoords[ _uniqueIndex ] = objTexCoords[ texCoordIndex - 1 ]; }
-                        if(faceHasVertexNormals && normalIndex != 0) _normals[ _uniqueIndex ] = objNormals[ normalIndex - 1 ];
-						_uniqueIndex++;
-					} else {
-						verticesTemps.push_back( objVertices[ vertexIndex - 1 ] );
-                        if(faceHasTextureCoordinates && texCoordIndex != 0) { texCoordsTemp.push_back( objTexCoords[ texCoordIndex - 1 ] ); }
-
-						if( (vertexAttributeTokens.size() == 2 && numAttributeSlashes == 2)
-                            || (vertexAttributeTokens.size() == 3) ) {
-							// should not occur if no normals
-							if (ERRORS) CSCI441::LogUtils::logError("[.obj]: [ERROR]: no vertex normals were specified, should not be trying to access values\n" );
-						}
-					}
-					uniqueNumVertices++;
-				}
+		} else {
+			if (INFO) {
+				const std::string line( directive.text );
+				CSCI441::LogUtils::log("[.obj]: ignoring line: %s\n", line.c_str() );
 			}
+		}
+	};
 
-			for(GLuint i = 1; i < processedFaceTokens.size()-1; i++) {
-				if( _hasVertexNormals || !sAUTO_GEN_NORMALS ) {
-					_indices[ indicesSeen++ ] = uniqueCounts.find( processedFaceTokens[0]   )->second;
-					_indices[ indicesSeen++ ] = uniqueCounts.find( processedFaceTokens[i]   )->second;
-					_indices[ indicesSeen++ ] = uniqueCounts.find( processedFaceTokens[i+1] )->second;
-
-					if (sAUTO_GEN_TANGENTS) {
-						glm::vec3 a = _vertices[ _indices[ indicesSeen - 3 ] ];
-						glm::vec3 b = _vertices[ _indices[ indicesSeen - 2 ] ];
-						glm::vec3 c = _vertices[ _indices[ indicesSeen - 1 ] ];
-
-						glm::vec3 ab = b - a;
-						glm::vec3 bc = c - b;
-						glm::vec3 ca = a - c;
-
-						_tangents[ _indices[ indicesSeen - 3 ] ] = glm::vec4(ab, 1.0f);
-						_tangents[ _indices[ indicesSeen - 2 ] ] = glm::vec4(bc, 1.0f);
-						_tangents[ _indices[ indicesSeen - 1 ] ] = glm::vec4(ca, 1.0f);
-					}
-
-					_numIndices += 3;
-				} else {
-					GLuint aI = uniqueCounts.find( processedFaceTokens[0]   )->second;
-					GLuint bI = uniqueCounts.find( processedFaceTokens[i]   )->second;
-					GLuint cI = uniqueCounts.find( processedFaceTokens[i+1] )->second;
-
-					glm::vec3 a = verticesTemps[aI];
-					glm::vec3 b = verticesTemps[bI];
-					glm::vec3 c = verticesTemps[cI];
-
-					glm::vec3 ab = b - a; glm::vec3 ac = c - a;
-					glm::vec3 ba = a - b; glm::vec3 bc = c - b;
-					glm::vec3 ca = a - c; glm::vec3 cb = b - c;
-
-					glm::vec3 aN = glm::normalize( glm::cross( ab, ac ) );
-					glm::vec3 bN = glm::normalize( glm::cross( bc, ba ) );
-					glm::vec3 cN = glm::normalize( glm::cross( ca, cb ) );
-
-					_vertices[ _uniqueIndex ] = a;
-					_normals[ _uniqueIndex ] = aN;
-					if (sAUTO_GEN_TANGENTS) _tangents[ _uniqueIndex ] = glm::vec4(ab, 1.0f);
-					if( faceHasTextureCoordinates && _hasVertexTexCoords ) { _texCoords[ _uniqueIndex ] = texCoordsTemp[ aI ]; }
-					_indices[ _numIndices++ ] = _uniqueIndex++;
+	const auto resolveIndex = [](const GLint index, const bool isRelative, const size_t offset, const size_t numSeen, GLuint &resolvedIndex) {
+		const auto fileIndex = static_cast<long long>(index) + (isRelative ? static_cast<long long>(offset) : 0);
+		if( fileIndex <= 0 || fileIndex > static_cast<long long>(numSeen) ) return false;
+		resolvedIndex = static_cast<GLuint>(fileIndex);
+		return true;
+	};
 
-					indicesSeen++;
+	for( GLuint chunkIndex = 0; chunkIndex < numThreads; chunkIndex++ ) {
+		const auto& chunk = chunks[chunkIndex];
+		size_t directiveIndex = 0, faceVertexIndex = 0;
 
-					_vertices[ _uniqueIndex ] = b;
-					_normals[ _uniqueIndex ] = bN;
-					if (sAUTO_GEN_TANGENTS) _tangents[ _uniqueIndex ] = glm::vec4(bc, 1.0f);
-					if( faceHasTextureCoordinates && _hasVertexTexCoords ) { _texCoords[ _uniqueIndex ] = texCoordsTemp[ bI ]; }
-					_indices[ _numIndices++ ] = _uniqueIndex++;
+		for( size_t faceIndex = 0; faceIndex <= chunk.faceSizes.size(); faceIndex++ ) {
+			while( directiveIndex < chunk.directives.size() && chunk.directives[directiveIndex].faceIndex == faceIndex ) {
+				processDirective( chunk.directives[directiveIndex++] );
+			}
+			if( faceIndex == chunk.faceSizes.size() ) break;
 
-					indicesSeen++;
+			faceCorners.clear();
+			for( GLuint corner = 0; corner < chunk.faceSizes[faceIndex]; corner++ ) {
+				const auto& faceVertex = chunk.faceVertices[faceVertexIndex++];
 
-					_vertices[ _uniqueIndex ] = c;
-					_normals[ _uniqueIndex ] = cN;
-					if (sAUTO_GEN_TANGENTS) _tangents[ _uniqueIndex ] = glm::vec4(ca, 1.0f);
-					if( faceHasTextureCoordinates && _hasVertexTexCoords ) { _texCoords[ _uniqueIndex ] = texCoordsTemp[ cI ]; }
-					_indices[ _numIndices++ ] = _uniqueIndex++;
+				GLuint vertexIndex = 0, texCoordIndex = 0, normalIndex = 0;
+				bool validIndices = resolveIndex( faceVertex.vertexIndex, faceVertex.relativeMask & CSCI441_INTERNAL::OBJFaceVertex::RELATIVE_VERTEX, vertexOffsets[chunkIndex], numVertices, vertexIndex );
+				if( faceVertex.presentMask & CSCI441_INTERNAL::OBJFaceVertex::HAS_TEX_COORD ) {
+					validIndices &= resolveIndex( faceVertex.texCoordIndex, faceVertex.relativeMask & CSCI441_INTERNAL::OBJFaceVertex::RELATIVE_TEX_COORD, texCoordOffsets[chunkIndex], numTexCoords, texCoordIndex );
+					_hasVertexTexCoords = true;
+				}
+				if( faceVertex.presentMask & CSCI441_INTERNAL::OBJFaceVertex::HAS_NORMAL ) {
+					validIndices &= resolveIndex( faceVertex.normalIndex, faceVertex.relativeMask & CSCI441_INTERNAL::OBJFaceVertex::RELATIVE_NORMAL, normalOffsets[chunkIndex], numNormals, normalIndex );
+					_hasVertexNormals = true;
+				}
+				if( !validIndices ) {
+					if (ERRORS) CSCI441::LogUtils::logError("[.obj]: [ERROR]: Malformed OBJ file, %s.\n", _filename.c_str());
+					if ( INFO ) CSCI441::LogUtils::log("[.obj]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=- \n", _filename.c_str() );
+					return false;
+				}
 
-					indicesSeen++;
+				// check if we've seen this attribute combination before
+				const auto [uniqueVertexIndex, isNewVertex] = uniqueCounts.insert( vertexIndex, texCoordIndex, normalIndex, static_cast<GLuint>(uniqueVertices.size()) );
+				if( isNewVertex ) {
+					// if not, add it to the list
+					uniqueVertices.push_back( objVertices[ vertexIndex - 1 ] );
+					uniqueTexCoords.push_back( texCoordIndex != 0 ? objTexCoords[ texCoordIndex - 1 ] : glm::vec2(0.0f) );
+					uniqueNormals.push_back( normalIndex != 0 ? objNormals[ normalIndex - 1 ] : glm::vec3(0.0f) );
 				}
+				faceCorners.push_back( uniqueVertexIndex );
 			}
-		}
 
-		if (INFO) {
-			progressCounter++;
-			if( progressCounter % 5000 == 0 ) {
-				CSCI441::LogUtils::log("\33[2K\r");
-				switch( progressCounter ) {
-					case 5000:	CSCI441::LogUtils::log("[.obj]: parsing %s...\\", _filename.c_str());	break;
-					case 10000:	CSCI441::LogUtils::log("[.obj]: parsing %s...|", _filename.c_str());	break;
-					case 15000:	CSCI441::LogUtils::log("[.obj]: parsing %s.../", _filename.c_str());	break;
-					case 20000:	CSCI441::LogUtils::log("[.obj]: parsing %s...-", _filename.c_str());	break;
-                    default: break;
-				}
-				fflush(stdout);
+			// fan triangulate the face
+			for( size_t i = 1; i + 1 < faceCorners.size(); i++ ) {
+				indices.push_back( faceCorners[0] );
+				indices.push_back( faceCorners[i] );
+				indices.push_back( faceCorners[i+1] );
+				indicesSeen += 3;
+				numTriangles++;
 			}
-			if( progressCounter == 20000 )
-				progressCounter = 0;
 		}
 	}
+	objFile.close();
 
-	in.close();
+	_materialIndexStartStop.find( currentMaterial )->second.back().second = indicesSeen - 1;
+
+	const auto numUniqueVertices = static_cast<GLuint>(uniqueVertices.size());
 
 	if (INFO) {
-		CSCI441::LogUtils::log("\33[2K\r" );
-		CSCI441::LogUtils::log("[.obj]: parsing %s...done!\n", _filename.c_str() );
+		CSCI441::LogUtils::log("[.obj]: ------------\n" );
+		CSCI441::LogUtils::log("[.obj]: Model Stats:\n" );
+		CSCI441::LogUtils::log("[.obj]: Vertices:  \t%zu\tNormals:  \t%zu\tTex Coords:\t%zu\n", numVertices, numNormals, numTexCoords );
+		CSCI441::LogUtils::log("[.obj]: Unique Verts:\t%u\n", numUniqueVertices );
+		CSCI441::LogUtils::log("[.obj]: Faces:     \t%u\tTriangles:\t%u\n", numFaces, numTriangles );
+		CSCI441::LogUtils::log("[.obj]: Objects:   \t%u\tGroups:   \t%u\n", numObjects, numGroups );
+		CSCI441::LogUtils::log("[.obj]: Threads:   \t%u\n", numThreads );
+
+        glm::vec3 sizeDimensions = maxDimension - minDimension;
+		CSCI441::LogUtils::log("[.obj]: Dimensions:\t(%f, %f, %f)\n", sizeDimensions.x, sizeDimensions.y, sizeDimensions.z );
+		CSCI441::LogUtils::log("[.obj]: ------------\n" );
 	}
 
-	_materialIndexStartStop.find( currentMaterial )->second.back().second = indicesSeen - 1;
+	if (INFO && !_hasVertexNormals && !_loadOptions.autoGenNormals)
+		CSCI441::LogUtils::log("[.obj]: [WARN]: No vertex normals exist on model.  To autogenerate vertex\n\tnormals, call CSCI441::ModelLoader::enableAutoGenerateNormals()\n\tprior to loading the model file.\n" );
+	_allocateAttributeArrays(numUniqueVertices, indicesSeen);
+
+	std::copy( uniqueVertices.begin(), uniqueVertices.end(), _vertices );
+	std::copy( uniqueNormals.begin(), uniqueNormals.end(), _normals );
+	std::copy( uniqueTexCoords.begin(), uniqueTexCoords.end(), _texCoords );
+	std::copy( indices.begin(), indices.end(), _indices );
+	_uniqueIndex = numUniqueVertices;
+	_numIndices = indicesSeen;
+	_loadStats.dedupMilliseconds += CSCI441_INTERNAL::millisecondsSince( dedupStart );
 
-	_bufferData();
+	_postProcessMesh( INFO, nullptr, 0 );
+	if( !_deferUpload ) _uploadMaterialTextures();
+	_buildDrawList();
 
-	time(&end);
-	double seconds = difftime( end, start );
+	const double seconds = CSCI441_INTERNAL::millisecondsSince( start ) / 1000.0;
 
 	if (INFO) {
 		CSCI441::LogUtils::log("[.obj]: Completed in %.3fs\n", seconds );
@@ -855,18 +1940,124 @@ inline bool CSCI441::ModelLoader::_loadOBJFile( const bool INFO, const bool ERRO
 	return result;
 }
 
+//
+//  void _parseOBJChunk(chunk)
+//
+//      Parses every line within [chunk.begin, chunk.end).  Geometry is stored
+//  local to the chunk; relative face indices are rewritten relative to the
+//  start of the chunk since the number of attributes in prior chunks is not
+//  yet known.  Safe to call concurrently on different chunks.
+//
+inline void CSCI441::ModelLoader::_parseOBJChunk( CSCI441_INTERNAL::OBJChunk &chunk ) {
+	CSCI441_INTERNAL::TextCursor cursor( chunk.begin, chunk.end );
+	while( !cursor.atEnd() ) {
+		const char* lineStart = cursor.current;
+		const std::string_view keyword = cursor.nextToken();
+
+		//the line should have a single character that lets us know if it's a...
+		if( keyword.empty() || keyword.front() == '#' ) {		// blank line or comment ignore
+		} else if( keyword == "v" ) {						//vertex
+			glm::vec3 pos;
+			CSCI441_INTERNAL::parseFloat( cursor.nextToken(), pos.x );
+			CSCI441_INTERNAL::parseFloat( cursor.nextToken(), pos.y );
+			CSCI441_INTERNAL::parseFloat( cursor.nextToken(), pos.z );
+			chunk.vertices.push_back( pos );
+
+			chunk.minDimension = glm::min( chunk.minDimension, pos );
+			chunk.maxDimension = glm::max( chunk.maxDimension, pos );
+		} else if( keyword == "vn" ) {                    //vertex normal
+			glm::vec3 normal;
+			CSCI441_INTERNAL::parseFloat( cursor.nextToken(), normal.x );
+			CSCI441_INTERNAL::parseFloat( cursor.nextToken(), normal.y );
+			CSCI441_INTERNAL::parseFloat( cursor.nextToken(), normal.z );
+			chunk.normals.push_back( normal );
+		} else if( keyword == "vt" ) {                    //vertex tex coord
+			glm::vec2 texCoord;
+			CSCI441_INTERNAL::parseFloat( cursor.nextToken(), texCoord.s );
+			CSCI441_INTERNAL::parseFloat( cursor.nextToken(), texCoord.t );
+			chunk.texCoords.push_back( texCoord );
+		} else if( keyword == "f" ) {                     //face!
+            //faces can be either quads or triangles (or maybe more?), store every vertex and triangulate when merging
+            GLuint numFaceVertices = 0;
+            for( std::string_view faceToken = cursor.nextToken(); !faceToken.empty(); faceToken = cursor.nextToken() ) {
+                CSCI441_INTERNAL::OBJFaceVertex faceVertex;
+                if( !_parseOBJFaceVertex( faceToken, faceVertex.vertexIndex, faceVertex.texCoordIndex, faceVertex.normalIndex ) ) {
+                    chunk.malformed = true;
+                    return;
+                }
+
+                // a missing index parses as zero, record presence before relative indices are rebased
+                // since rebasing a relative index against an empty chunk can also produce zero
+                if( faceVertex.texCoordIndex != 0 ) faceVertex.presentMask |= CSCI441_INTERNAL::OBJFaceVertex::HAS_TEX_COORD;
+                if( faceVertex.normalIndex != 0 ) faceVertex.presentMask |= CSCI441_INTERNAL::OBJFaceVertex::HAS_NORMAL;
+
+                // relative indices count back from the attributes read so far
+                if( faceVertex.vertexIndex < 0 ) {
+                    faceVertex.vertexIndex += static_cast<GLint>(chunk.vertices.size()) + 1;
+                    faceVertex.relativeMask |= CSCI441_INTERNAL::OBJFaceVertex::RELATIVE_VERTEX;
+                }
+                if( faceVertex.texCoordIndex < 0 ) {
+                    faceVertex.texCoordIndex += static_cast<GLint>(chunk.texCoords.size()) + 1;
+                    faceVertex.relativeMask |= CSCI441_INTERNAL::OBJFaceVertex::RELATIVE_TEX_COORD;
+                }
+                if( faceVertex.normalIndex < 0 ) {
+                    faceVertex.normalIndex += static_cast<GLint>(chunk.normals.size()) + 1;
+                    faceVertex.relativeMask |= CSCI441_INTERNAL::OBJFaceVertex::RELATIVE_NORMAL;
+                }
+
+                chunk.faceVertices.push_back( faceVertex );
+                numFaceVertices++;
+            }
+            chunk.faceSizes.push_back( numFaceVertices );
+		} else if( keyword == "o" ) {						// object name ignore
+			chunk.numObjects++;
+		} else if( keyword == "g" ) {						// polygon group name ignore
+			chunk.numGroups++;
+		} else if( keyword == "s" ) {						// smooth shading ignore
+		} else if( keyword == "mtllib" ) {				// material library
+			chunk.directives.push_back( { CSCI441_INTERNAL::OBJDirective::TYPE::MTLLIB, chunk.faceSizes.size(), cursor.nextToken() } );
+		} else if( keyword == "usemtl" ) {				// use material library
+			chunk.directives.push_back( { CSCI441_INTERNAL::OBJDirective::TYPE::USEMTL, chunk.faceSizes.size(), cursor.nextToken() } );
+		} else {
+			cursor.current = lineStart;
+			chunk.directives.push_back( { CSCI441_INTERNAL::OBJDirective::TYPE::IGNORED, chunk.faceSizes.size(), cursor.restOfLine() } );
+		}
+
+		cursor.skipLine();
+	}
+}
+
+//
+//  bool _parseOBJFaceVertex(faceToken, vertexIndex, texCoordIndex, normalIndex)
+//
+//      Splits a single face vertex of the form v, v/t, v//n, or v/t/n into its
+//  signed attribute indices.  Attributes that are not present are returned as zero.
+//
+inline bool CSCI441::ModelLoader::_parseOBJFaceVertex( std::string_view faceToken, GLint &vertexIndex, GLint &texCoordIndex, GLint &normalIndex ) {
+	vertexIndex = texCoordIndex = normalIndex = 0;
+
+	const size_t firstSlash = faceToken.find('/');
+	if( !CSCI441_INTERNAL::parseInt( faceToken.substr(0, firstSlash), vertexIndex ) || vertexIndex == 0 ) return false;
+	if( firstSlash == std::string_view::npos ) return true;
+
+	const size_t secondSlash = faceToken.find('/', firstSlash + 1);
+	const std::string_view texCoordToken = faceToken.substr(firstSlash + 1, secondSlash == std::string_view::npos ? std::string_view::npos : secondSlash - firstSlash - 1);
+	if( !texCoordToken.empty() && (!CSCI441_INTERNAL::parseInt( texCoordToken, texCoordIndex ) || texCoordIndex == 0) ) return false;
+	if( secondSlash == std::string_view::npos ) return true;
+
+	const std::string_view normalToken = faceToken.substr(secondSlash + 1);
+	if( normalToken.find('/') != std::string_view::npos ) return false;
+	if( !normalToken.empty() && (!CSCI441_INTERNAL::parseInt( normalToken, normalIndex ) || normalIndex == 0) ) return false;
+	return true;
+}
+
 inline bool CSCI441::ModelLoader::_loadMTLFile( const char* mtlFilename, const bool INFO, const bool ERRORS ) {
+	const CSCI441_INTERNAL::ScopedTimer timer( _loadStats.mtlMilliseconds );
 	bool result = true;
 
 	if (INFO) CSCI441::LogUtils::log("[.mtl]: -*-*-*-*-*-*-*- BEGIN %s Info -*-*-*-*-*-*-*-\n", mtlFilename );
 
 	std::string line;
-	std::string path;
-	if( _filename.find('/') != std::string::npos ) {
-	 	path = _filename.substr( 0, _filename.find_last_of('/')+1 );
-	} else {
-		path = "./";
-	}
 
 	std::ifstream in;
 	in.open( mtlFilename );
@@ -878,18 +2069,11 @@ inline bool CSCI441::ModelLoader::_loadMTLFile( const char* mtlFilename, const b
 			return false;
 		}
 	}
+	_dependentFiles.emplace_back( mtlFilename );
 
 	CSCI441_INTERNAL::ModelMaterial* currentMaterial = nullptr;
 	std::string materialName;
 
-	unsigned char *textureData = nullptr;
-	unsigned char *maskData = nullptr;
-	unsigned char *fullData;
-	int texWidth, texHeight, textureChannels = 1, maskChannels = 1;
-	GLuint textureHandle = 0;
-
-	std::map< std::string, GLuint > imageHandles;
-
 	int numMaterials = 0;
 
 	while( getline( in, line ) ) {
@@ -909,12 +2093,6 @@ inline bool CSCI441::ModelLoader::_loadMTLFile( const char* mtlFilename, const b
 			materialName = tokens[1];
 			_materials.insert( std::pair<std::string, CSCI441_INTERNAL::ModelMaterial*>( materialName, currentMaterial ) );
 
-			textureHandle = 0;
-			textureData = nullptr;
-			maskData = nullptr;
-			textureChannels = 1;
-			maskChannels = 1;
-
 			numMaterials++;
 		} else if( tokens[0] == "Ka" ) {					// ambient component
 			currentMaterial->ambient[0] = strtof( tokens[1].c_str(), nullptr );
@@ -942,105 +2120,12 @@ inline bool CSCI441::ModelLoader::_loadMTLFile( const char* mtlFilename, const b
 		} else if( tokens[0] == "illum" ) {				    // illumination type component
 			// TODO illumination type?
 		} else if( tokens[0] == "map_Kd" ) {				// diffuse color texture map
-			if( imageHandles.find( tokens[1] ) != imageHandles.end() ) {
-				// _textureHandles->insert( pair< string, GLuint >( materialName, imageHandles.find( tokens[1] )->second ) );
-				currentMaterial->map_Kd = imageHandles.find( tokens[1] )->second;
-			} else {
-                stbi_set_flip_vertically_on_load(true);
-				textureData = stbi_load( tokens[1].c_str(), &texWidth, &texHeight, &textureChannels, 0 );
-				if( !textureData ) {
-					std::string folderName = path + tokens[1];
-					textureData = stbi_load( folderName.c_str(), &texWidth, &texHeight, &textureChannels, 0 );
-				}
-
-				if( !textureData ) {
-					if (ERRORS) CSCI441::LogUtils::logError("[.mtl]: [ERROR]: File Not Found: %s\n", tokens[1].c_str() );
-				} else {
-					if (INFO) CSCI441::LogUtils::log("[.mtl]: TextureMap:\t%s\tSize: %dx%d\tColors: %d\n", tokens[1].c_str(), texWidth, texHeight, textureChannels );
-
-					if( maskData == nullptr ) {
-						if( textureHandle == 0 ) {
-							glGenTextures( 1, &textureHandle );
-							imageHandles.insert( std::pair<std::string, GLuint>( tokens[1], textureHandle ) );
-						}
-
-						glBindTexture( GL_TEXTURE_2D, textureHandle );
-
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-						GLint colorSpace = GL_RGB;
-						if( textureChannels == 4 )
-							colorSpace = GL_RGBA;
-						glTexImage2D( GL_TEXTURE_2D, 0, colorSpace, texWidth, texHeight, 0, colorSpace, GL_UNSIGNED_BYTE, textureData );
-
-						currentMaterial->map_Kd = textureHandle;
-					} else {
-						fullData = CSCI441_INTERNAL::createTransparentTexture( textureData, maskData, texWidth, texHeight, textureChannels, maskChannels );
-
-						if( textureHandle == 0 ) {
-							glGenTextures( 1, &textureHandle );
-							imageHandles.insert( std::pair<std::string, GLuint>( tokens[1], textureHandle ) );
-						}
-
-						glBindTexture( GL_TEXTURE_2D, textureHandle );
-
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-						glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, texWidth, texHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, fullData );
-
-						delete[] fullData;
-
-						currentMaterial->map_Kd = textureHandle;
-					}
-				}
-			}
+			// decoded by _decodeMaterialTextures() once every material library is read
+			currentMaterial->map_KdFilename = tokens[1];
+			if (INFO) CSCI441::LogUtils::log("[.mtl]: TextureMap:\t%s\n", tokens[1].c_str() );
 		} else if( tokens[0] == "map_d" ) {				// alpha texture map
-			if( imageHandles.find( tokens[1] ) != imageHandles.end() ) {
-				// _textureHandles->insert( pair< string, GLuint >( materialName, imageHandles.find( tokens[1] )->second ) );
-				currentMaterial->map_d = imageHandles.find( tokens[1] )->second;
-			} else {
-			    stbi_set_flip_vertically_on_load(true);
-				maskData = stbi_load( tokens[1].c_str(), &texWidth, &texHeight, &textureChannels, 0 );
-				if( !textureData ) {
-					std::string folderName = path + tokens[1];
-					maskData = stbi_load( folderName.c_str(), &texWidth, &texHeight, &textureChannels, 0 );
-				}
-
-				if( !maskData ) {
-					if (ERRORS) CSCI441::LogUtils::logError("[.mtl]: [ERROR]: File Not Found: %s\n", tokens[1].c_str() );
-				} else {
-					if (INFO) CSCI441::LogUtils::log("[.mtl]: AlphaMap:  \t%s\tSize: %dx%d\tColors: %d\n", tokens[1].c_str(), texWidth, texHeight, maskChannels );
-
-					if( textureData != nullptr ) {
-						fullData = CSCI441_INTERNAL::createTransparentTexture( textureData, maskData, texWidth, texHeight, textureChannels, maskChannels );
-
-						if( textureHandle == 0 ) {
-							glGenTextures( 1, &textureHandle );
-                            imageHandles.insert( std::pair<std::string, GLuint>( tokens[1], textureHandle ) );
-                        }
-
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-						glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-						glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, texWidth, texHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, fullData );
-
-						delete[] fullData;
-
-                        currentMaterial->map_Kd = textureHandle;
-					}
-				}
-			}
+			currentMaterial->map_dFilename = tokens[1];
+			if (INFO) CSCI441::LogUtils::log("[.mtl]: AlphaMap:  \t%s\n", tokens[1].c_str() );
 		} else if( tokens[0] == "map_Ka" ) {				    // ambient color texture map
           // TODO ambient color map?
 		} else if( tokens[0] == "map_Ks" ) {				    // specular color texture map
@@ -1061,6 +2146,9 @@ inline bool CSCI441::ModelLoader::_loadMTLFile( const char* mtlFilename, const b
 
 	in.close();
 
+	size_t fileSize = 0;
+	if( CSCI441_INTERNAL::fileSize( mtlFilename, fileSize ) ) _loadStats.bytesRead += fileSize;
+
 	if ( INFO ) {
 		CSCI441::LogUtils::log("[.mtl]: Materials:\t%d\n", numMaterials );
 		CSCI441::LogUtils::log("[.mtl]: -*-*-*-*-*-*-*-  END %s Info  -*-*-*-*-*-*-*-\n", mtlFilename );
@@ -1069,263 +2157,173 @@ inline bool CSCI441::ModelLoader::_loadMTLFile( const char* mtlFilename, const b
 	return result;
 }
 
+// notes on OFF format: http://paulbourke.net/dataformats/off/
+//
+// Read in a Geomview *.off File
+//
+//      The file is memory mapped and read once.  The vertex and face counts of
+//  the header size the arrays up front, and each polygon is triangulated as a
+//  fan directly into the index array while its indices are read.
 inline bool CSCI441::ModelLoader::_loadOFFFile( const bool INFO, const bool ERRORS ) {
 	bool result = true;
 
 	if (INFO ) CSCI441::LogUtils::log("[.off]: -=-=-=-=-=-=-=- BEGIN %s Info -=-=-=-=-=-=-=-\n", _filename.c_str() );
+	if (INFO && _loadOptions.streamLoad) CSCI441::LogUtils::log("[.off]: [WARN]: Only PLY and binary STL files are streamed, loading the model into memory\n" );
 
-	time_t start, end;
-	time(&start);
+	const auto start = std::chrono::steady_clock::now();
 
-	std::ifstream in( _filename );
-	if( !in.is_open() ) {
+	CSCI441_INTERNAL::MappedFile offFile;
+	if( !offFile.open( _filename.c_str() ) ) {
 		if (ERRORS) CSCI441::LogUtils::logError("[.off]: [ERROR]: Could not open \"%s\"\n", _filename.c_str() );
 		if ( INFO ) CSCI441::LogUtils::log("[.off]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
 		return false;
 	}
 
-	GLuint numVertices = 0, numFaces = 0, numTriangles = 0;
-	GLfloat minX = 999999.0f, maxX = -999999.0f, minY = 999999.0f, maxY = -999999.0f, minZ = 999999.0f, maxZ = -999999.0f;
-	std::string line;
-
-	enum OFF_FILE_STATE { HEADER, VERTICES, FACES, DONE };
-
-	OFF_FILE_STATE fileState = HEADER;
-
-	GLuint vSeen = 0, fSeen = 0;
-
-	while( getline( in, line ) ) {
-		if( line.length() > 1 && line.at(0) == '\t' )
-			line = line.substr( 1 );
-		line.erase( line.find_last_not_of( " \n\r\t" ) + 1 );
+	CSCI441_INTERNAL::TextCursor cursor( offFile.data(), offFile.data() + offFile.size() );
+	// returns the next token, moving past blank lines and comments
+	const auto nextToken = [&cursor]() {
+		while( !cursor.atEnd() ) {
+			const std::string_view token = cursor.nextToken();
+			if( !token.empty() && token.front() != '#' ) return token;
+			cursor.skipLine();
+		}
+		return std::string_view();
+	};
 
-		std::vector< std::string > tokens = _tokenizeString( line, " \t" );
-		if( tokens.empty() ) continue;
+	// the header is the optional OFF keyword followed by the number of vertices, faces, and edges
+	std::string_view token = nextToken();
+	if( token == "OFF" ) token = nextToken();
+	GLint headerVertices = 0, headerFaces = 0, headerEdges = 0;
+	if( !CSCI441_INTERNAL::parseInt( token, headerVertices ) || !CSCI441_INTERNAL::parseInt( nextToken(), headerFaces )
+		|| !CSCI441_INTERNAL::parseInt( nextToken(), headerEdges ) || headerVertices < 0 || headerFaces < 0 ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.off]: [ERROR]: Malformed OFF file.  # vertices, faces, edges not properly specified\n" );
+		if ( INFO ) CSCI441::LogUtils::log("[.off]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		return false;
+	}
+	cursor.skipLine();
+	const auto numVertices = static_cast<GLuint>(headerVertices);
+	const auto numFaces = static_cast<GLuint>(headerFaces);
+
+	// arrays are sized from the header, so check the counts against the text left before trusting them
+	// a vertex is at least "x y z\n" and a face at least "0\n", the last line may be missing its newline
+	if( static_cast<uint64_t>(numVertices) * 6 + static_cast<uint64_t>(numFaces) * 2 > static_cast<uint64_t>(cursor.end - cursor.current) + 1 ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.off]: [ERROR]: File \"%s\" declares %u vertices and %u faces, more than it holds\n", _filename.c_str(), numVertices, numFaces );
+		if ( INFO ) CSCI441::LogUtils::log("[.off]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		return false;
+	}
 
-		//the line should have a single character that lets us know if it's a...
-		if( tokens[0] == "#" || tokens[0].find_first_of('#') == 0 ) {								// comment ignore
-		} else if( fileState == HEADER ) {
-			if( tokens[0] == "OFF" ) {					// denotes OFF File type
-			} else {
-				if( tokens.size() != 3 ) {
-					if (ERRORS) CSCI441::LogUtils::logError("[.off]: [ERROR]: Malformed OFF file.  # vertices, faces, edges not properly specified\n" );
-					if ( INFO ) CSCI441::LogUtils::log("[.off]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
-					in.close();
-					return false;
-				}
-				// read in number of expected vertices, faces, and edges
-				numVertices = static_cast<GLuint>(strtol(tokens[0].c_str(), nullptr, 10));
-				numFaces = static_cast<GLuint>(strtol(tokens[1].c_str(), nullptr, 10));
+	_loadStats.scanMilliseconds += CSCI441_INTERNAL::millisecondsSince( start );
+	const auto parseStart = std::chrono::steady_clock::now();
+
+	if (INFO) CSCI441::LogUtils::log("[.off]: parsing %s...", _filename.c_str() );
+
+	bool truncated = false;
+	glm::vec3 minDimension( 999999.0f ), maxDimension( -999999.0f );
+	auto vertices = new glm::vec3[numVertices];
+	for( GLuint v = 0; v < numVertices && !truncated; v++ ) {
+		truncated = !CSCI441_INTERNAL::parseFloat( nextToken(), vertices[v].x )
+				 || !CSCI441_INTERNAL::parseFloat( nextToken(), vertices[v].y )
+				 || !CSCI441_INTERNAL::parseFloat( nextToken(), vertices[v].z );
+		minDimension = glm::min( minDimension, vertices[v] );
+		maxDimension = glm::max( maxDimension, vertices[v] );
+		// TODO: handle RGB(A) color information following the vertex location
+		cursor.skipLine();
+	}
 
-				// ignore tokens[2] - number of edges -- unnecessary information
-				// numEdges = (GLuint)strtol( tokens[2].c_str(), nullptr, 10 );
+	// most faces of an OFF file are triangles or quads, larger polygons grow the array as needed
+	std::vector<GLuint> faceIndices;
+	faceIndices.reserve( static_cast<size_t>(numFaces) * 3 );
+	GLuint numDegenerateFaces = 0, numInvalidIndices = 0;
+	for( GLuint f = 0; f < numFaces && !truncated; f++ ) {
+		GLint numFaceVertices = 0;
+		if( !CSCI441_INTERNAL::parseInt( nextToken(), numFaceVertices ) ) {
+			truncated = true;
+			break;
+		}
 
-				fileState = VERTICES;
+		// triangulate the polygon as a fan around its first vertex while its indices are read
+		const size_t faceStart = faceIndices.size();
+		GLuint fanRoot = 0, fanPrevious = 0;
+		bool inRange = true;
+		for( GLint i = 0; i < numFaceVertices; i++ ) {
+			GLint index = 0;
+			if( !CSCI441_INTERNAL::parseInt( nextToken(), index ) ) {
+				truncated = true;
+				break;
 			}
-		} else if( fileState == VERTICES ) {
-			// read in x y z vertex location
-			GLfloat x = strtof( tokens[0].c_str(), nullptr ),
-                    y = strtof( tokens[1].c_str(), nullptr ),
-                    z = strtof( tokens[2].c_str(), nullptr );
-
-			if( x < minX ) minX = x;
-			if( x > maxX ) maxX = x;
-			if( y < minY ) minY = y;
-			if( y > maxY ) maxY = y;
-			if( z < minZ ) minZ = z;
-			if( z > maxZ ) maxZ = z;
-
-			vSeen++;
-			if( vSeen == numVertices )
-				fileState = FACES;
-		} else if( fileState == FACES ) {
-			auto numberOfVerticesInFace = static_cast<GLuint>(strtol(tokens[0].c_str(), nullptr, 10));
+			if( index < 0 || index >= headerVertices ) inRange = false;
+
+			const auto vertexIndex = static_cast<GLuint>(index);
+			if( i == 0 ) {
+				fanRoot = vertexIndex;
+			} else if( i >= 2 ) {
+				faceIndices.push_back( fanRoot );
+				faceIndices.push_back( fanPrevious );
+				faceIndices.push_back( vertexIndex );
+			}
+			fanPrevious = vertexIndex;
+		}
+		if( truncated ) break;
+		// TODO: handle RGB(A) color information following the face indices
+		cursor.skipLine();
+
+		if( numFaceVertices < 3 ) {
+			numDegenerateFaces++;
+		} else if( !inRange ) {
+			faceIndices.resize( faceStart );
+			numInvalidIndices++;
+		}
+	}
 
-			numTriangles += numberOfVerticesInFace - 3 + 1;
+	if (INFO) {
+		CSCI441::LogUtils::log("\33[2K\r" );
+		CSCI441::LogUtils::log("[.off]: parsing %s...done!\n", _filename.c_str() );
+	}
+	_loadStats.parseMilliseconds += CSCI441_INTERNAL::millisecondsSince( parseStart );
 
-			if( fSeen == numFaces )
-				fileState = DONE;
-		} else {
-			if (INFO) CSCI441::LogUtils::log("[.off]: unknown file state: %d\n", fileState );
+	// fan triangulated faces can produce more indices than an index buffer can count
+	if( truncated || faceIndices.size() > std::numeric_limits<GLuint>::max() ) {
+		if (ERRORS) {
+			if( truncated ) CSCI441::LogUtils::logError("[.off]: [ERROR]: File \"%s\" ended before every vertex and face was read\n", _filename.c_str() );
+			else            CSCI441::LogUtils::logError("[.off]: [ERROR]: File \"%s\" triangulates to %zu indices, more than can be drawn\n", _filename.c_str(), faceIndices.size() );
 		}
+		if ( INFO ) CSCI441::LogUtils::log("[.off]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		delete[] vertices;
+		return false;
 	}
-	in.close();
+	if (ERRORS && numInvalidIndices > 0) CSCI441::LogUtils::logError("[.off]: [WARN]: %u faces reference vertices that do not exist and were skipped\n", numInvalidIndices );
 
+	const auto numTriangles = static_cast<GLuint>(faceIndices.size() / 3);
 	if (INFO) {
-		CSCI441::LogUtils::log("\33[2K\r" );
-		CSCI441::LogUtils::log("[.off]: scanning %s...done!\n", _filename.c_str() );
+		const glm::vec3 sizeDimensions = numVertices > 0 ? maxDimension - minDimension : glm::vec3( 0.0f );
 		CSCI441::LogUtils::log("[.off]: ------------\n" );
 		CSCI441::LogUtils::log("[.off]: Model Stats:\n" );
 		CSCI441::LogUtils::log("[.off]: Vertices:  \t%u\tNormals:   \t%u\tTex Coords:\t%u\n", numVertices, 0, 0 );
-		CSCI441::LogUtils::log("[.off]: Faces:     \t%u\tTriangles: \t%u\n", numFaces, numTriangles );
-		CSCI441::LogUtils::log("[.off]: Dimensions:\t(%f, %f, %f)\n", (maxX - minX), (maxY - minY), (maxZ - minZ) );
+		CSCI441::LogUtils::log("[.off]: Faces:     \t%u\tTriangles: \t%u\n", numFaces - numDegenerateFaces - numInvalidIndices, numTriangles );
+		CSCI441::LogUtils::log("[.off]: Dimensions:\t(%f, %f, %f)\n", sizeDimensions.x, sizeDimensions.y, sizeDimensions.z );
 	}
 
-	if( _hasVertexNormals || !sAUTO_GEN_NORMALS ) {
-		if (INFO && !_hasVertexNormals)
-			CSCI441::LogUtils::log("[.off]: [WARN]: No vertex normals exist on model.  To autogenerate vertex\n\tnormals, call CSCI441::ModelLoader::enableAutoGenerateNormals()\n\tprior to loading the model file.\n" );
-        _allocateAttributeArrays(numVertices, numTriangles*3);
-	} else {
-		if (INFO) CSCI441::LogUtils::log("[.off]: No vertex normals exist on model, vertex normals will be autogenerated\n" );
-        _allocateAttributeArrays(numTriangles*3, numTriangles*3);
-	}
+	if (INFO && !_hasVertexNormals && !_loadOptions.autoGenNormals)
+		CSCI441::LogUtils::log("[.off]: [WARN]: No vertex normals exist on model.  To autogenerate vertex\n\tnormals, call CSCI441::ModelLoader::enableAutoGenerateNormals()\n\tprior to loading the model file.\n" );
 
-	std::vector<glm::vec3> verticesTemp;
+	// the parsed positions become the vertex array as is
+	_vertices = vertices;
+	_normals = new glm::vec3[numVertices]();
+	_texCoords = new glm::vec2[numVertices]();
+	_tangents = new glm::vec4[numVertices]();
+	_indices = new GLuint[faceIndices.size()];
+	memcpy( _indices, faceIndices.data(), sizeof(GLuint) * faceIndices.size() );
+	_uniqueIndex = numVertices;
+	_numIndices = static_cast<GLuint>(faceIndices.size());
 
 	if (INFO) CSCI441::LogUtils::log("[.off]: ------------\n" );
 
-	in.open( _filename );
-
-	_uniqueIndex = 0;
-	_numIndices = 0;
-	vSeen = 0;
-
-	fileState = HEADER;
-
-	int progressCounter = 0;
-
-	while( getline( in, line ) ) {
-		if( line.length() > 1 && line.at(0) == '\t' )
-			line = line.substr( 1 );
-		line.erase( line.find_last_not_of( " \n\r\t" ) + 1 );
-
-		std::vector< std::string > tokens = _tokenizeString( line, " \t" );
-		if( tokens.empty() ) continue;
-
-		//the line should have a single character that lets us know if it's a...
-		if( tokens[0] == "#"  || tokens[0].find_first_of('#') == 0 ) {
-            // comment ignore
-        } else if( fileState == HEADER ) {
-			if( tokens[0] == "OFF" ) {
-                // denotes OFF File type
-			} else {
-				// end of OFF Header reached
-				fileState = VERTICES;
-			}
-		} else if( fileState == VERTICES ) {
-			// read in x y z vertex location
-			glm::vec3 pos(strtof( tokens[0].c_str(), nullptr ),
-                          strtof( tokens[1].c_str(), nullptr ),
-                          strtof( tokens[2].c_str(), nullptr ) );
-
-			// check if RGB(A) color information is associated with vertex
-			if( tokens.size() == 6 || tokens.size() == 7 ) {
-				// TODO: handle RGBA color info
-//				 glm::vec4 color(strtof( tokens[3].c_str(), nullptr ),
-//                                 strtof( tokens[4].c_str(), nullptr ),
-//                                 strtof( tokens[5].c_str(), nullptr ),
-//                                 (tokens.size() == 7 ? strtof( tokens[6].c_str(), nullptr ) : 1.0f) );
-			}
-
-			if( _hasVertexNormals || !sAUTO_GEN_NORMALS ) {
-				_vertices[ _uniqueIndex ] = pos;
-				_uniqueIndex++;
-			} else {
-				verticesTemp.push_back(pos);
-				vSeen++;
-			}
-			// if all vertices have been read in, move on to faces
-			if( _uniqueIndex == numVertices || vSeen == numVertices )
-				fileState = FACES;
-		} else if( fileState == FACES ) {
-			auto numberOfVerticesInFace = static_cast<GLuint>(strtol(tokens[0].c_str(), nullptr, 10));
-
-			// read in each vertex index of the face
-			for(GLuint i = 2; i <= numberOfVerticesInFace - 1; i++) {
-				if( _hasVertexNormals || !sAUTO_GEN_NORMALS ) {
-					auto fanRoot = strtol( tokens[1].c_str(), nullptr, 10 );
-					auto fanA = strtol( tokens[i].c_str(), nullptr, 10 );
-					auto fanB = strtol( tokens[i+1].c_str(), nullptr, 10 );
-
-					if( fanRoot < 0 ) fanRoot = numVertices + fanRoot + 1;
-					if( fanA < 0 ) fanA = numVertices + fanA + 1;
-					if( fanB < 0 ) fanB = numVertices + fanB + 1;
-
-					//regardless, we always get a vertex index.
-					_indices[ _numIndices++ ] = fanRoot;
-					_indices[ _numIndices++ ] = fanA;
-					_indices[ _numIndices++ ] = fanB;
-				} else {
-					auto aI = strtol( tokens[1].c_str(), nullptr, 10 );
-					auto bI = strtol( tokens[i].c_str(), nullptr, 10 );
-					auto cI = strtol( tokens[i+1].c_str(), nullptr, 10 );
-
-					if( aI < 0 ) aI = numVertices + aI + 1;
-					if( bI < 0 ) bI = numVertices + bI + 1;
-					if( cI < 0 ) cI = numVertices + cI + 1;
-
-					glm::vec3 a = verticesTemp[aI];
-					glm::vec3 b = verticesTemp[bI];
-					glm::vec3 c = verticesTemp[cI];
-
-					glm::vec3 ab = b - a; glm::vec3 ac = c - a;
-					glm::vec3 ba = a - b; glm::vec3 bc = c - b;
-					glm::vec3 ca = a - c; glm::vec3 cb = b - c;
-
-					glm::vec3 aN = glm::normalize( glm::cross( ab, ac ) );
-					glm::vec3 bN = glm::normalize( glm::cross( bc, ba ) );
-					glm::vec3 cN = glm::normalize( glm::cross( ca, cb ) );
-
-					_vertices[ _uniqueIndex ] = a;
-					_normals[ _uniqueIndex ] = aN;
-					_indices[ _numIndices++ ] = _uniqueIndex++;
-
-					_vertices[ _uniqueIndex ] = b;
-					_normals[ _uniqueIndex ] = bN;
-					_indices[ _numIndices++ ] = _uniqueIndex++;
-
-					_vertices[ _uniqueIndex ] = c;
-					_normals[ _uniqueIndex ] = cN;
-					_indices[ _numIndices++ ] = _uniqueIndex++;
-				}
-			}
-
-			// check if RGB(A) color information is associated with face
-			// TODO: handle color info
-			//some local variables to hold the vertex+attribute indices we read in.
-			//we do it this way because we'll have to split quads into triangles ourselves.
-			// GLfloat color[4] = {-1,-1,-1,1};
-			// if( tokens.size() == numberOfVerticesInFace + 4 || tokens.size() == numberOfVerticesInFace + 5 ) {
-			// 	color[0] = atof( tokens[numberOfVerticesInFace + 1].c_str() );
-			// 	color[1] = atof( tokens[numberOfVerticesInFace + 2].c_str() );
-			// 	color[2] = atof( tokens[numberOfVerticesInFace + 3].c_str() );
-			// 	color[3] = 1;
-      //
-			// 	if( tokens.size() == numberOfVerticesInFace + 5 )
-			// 		color[3] = atof( tokens[numberOfVerticesInFace + 4].c_str() );
-			// }
-
-		} else {
-
-		}
-
-		if (INFO) {
-			progressCounter++;
-			if( progressCounter % 5000 == 0 ) {
-				CSCI441::LogUtils::log("\33[2K\r");
-				switch( progressCounter ) {
-					case 5000:	CSCI441::LogUtils::log("[.off]: parsing %s...\\", _filename.c_str());	break;
-					case 10000:	CSCI441::LogUtils::log("[.off]: parsing %s...|", _filename.c_str());	break;
-					case 15000:	CSCI441::LogUtils::log("[.off]: parsing %s.../", _filename.c_str());	break;
-					case 20000:	CSCI441::LogUtils::log("[.off]: parsing %s...-", _filename.c_str());	break;
-                    default: break;
-				}
-				fflush(stdout);
-			}
-			if( progressCounter == 20000 )
-				progressCounter = 0;
-		}
-	}
-	in.close();
-
-    _bufferData();
+	_postProcessMesh( INFO, nullptr, 0 );
 
-	time(&end);
-	double seconds = difftime( end, start );
+	const double seconds = CSCI441_INTERNAL::millisecondsSince( start ) / 1000.0;
 
 	if (INFO) {
-		CSCI441::LogUtils::log("\33[2K\r" );
-		CSCI441::LogUtils::log("[.off]: parsing %s...done!  (Time: %.1fs)\n", _filename.c_str(), seconds );
+		CSCI441::LogUtils::log("[.off]: Time to complete: %.3fs\n", seconds );
 		CSCI441::LogUtils::log("[.off]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
 	}
 
@@ -1333,259 +2331,735 @@ inline bool CSCI441::ModelLoader::_loadOFFFile( const bool INFO, const bool ERRO
 }
 
 // notes on PLY format: http://paulbourke.net/dataformats/ply/
+//
+// Read in a Stanford *.ply File
+//
+//      The header is parsed into the list of elements and their properties.
+//  Each vertex property is mapped to the attribute component it fills, then the
+//  body, ASCII or binary of either byte order, is decoded straight into the
+//  attribute arrays.  Elements other than vertices and faces are skipped.
 inline bool CSCI441::ModelLoader::_loadPLYFile( const bool INFO, const bool ERRORS ) {
 	bool result = true;
 
 	if (INFO ) CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=- BEGIN %s Info -=-=-=-=-=-=-=-\n", _filename.c_str() );
 
-	time_t start, end;
-	time(&start);
+	const auto start = std::chrono::steady_clock::now();
 
-	std::ifstream in( _filename );
-	if( !in.is_open() ) {
+	CSCI441_INTERNAL::MappedFile plyFile;
+	if( !plyFile.open( _filename.c_str() ) ) {
 		if (ERRORS) CSCI441::LogUtils::logError("[.ply]: [ERROR]: Could not open \"%s\"\n", _filename.c_str() );
 		if ( INFO ) CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
 		return false;
 	}
 
-	GLuint numVertices = 0, numFaces = 0, numTriangles = 0, numMaterials = 0;
-	GLfloat minX = 999999.0f, maxX = -999999.0f, minY = 999999.0f, maxY = -999999.0f, minZ = 999999.0f, maxZ = -999999.0f;
-	std::string line;
+	CSCI441_INTERNAL::TextCursor cursor( plyFile.data(), plyFile.data() + plyFile.size() );
+	CSCI441_INTERNAL::PLY_FORMAT format;
+	std::vector<CSCI441_INTERNAL::PLYElement> elements;
+	if( !_parsePLYHeader( cursor, format, elements ) ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.ply]: [ERROR]: File \"%s\" has a malformed or unsupported header\n", _filename.c_str() );
+		if ( INFO ) CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		return false;
+	}
+	_loadStats.scanMilliseconds += CSCI441_INTERNAL::millisecondsSince( start );
+	const auto parseStart = std::chrono::steady_clock::now();
 
-	enum PLY_FILE_STATE { HEADER, VERTICES, FACES, MATERIALS };
-	enum PLY_ELEMENT_TYPE { NONE, VERTEX, FACE, MATERIAL };
+	// map each vertex property to the attribute component it is decoded into
+	enum PLY_VERTEX_TARGET { POS_X, POS_Y, POS_Z, NORM_X, NORM_Y, NORM_Z, TEX_S, TEX_T, COLOR_R, COLOR_G, COLOR_B, COLOR_A, NUM_TARGETS, IGNORED };
 
-	PLY_FILE_STATE fileState = HEADER;
-	PLY_ELEMENT_TYPE elemType = NONE;
+	const CSCI441_INTERNAL::PLYElement* vertexElement = nullptr;
+	const CSCI441_INTERNAL::PLYElement* faceElement = nullptr;
+	for( const auto& element : elements ) {
+		if( element.name == "vertex" && vertexElement == nullptr ) vertexElement = &element;
+		else if( element.name == "face" && faceElement == nullptr ) faceElement = &element;
+	}
 
-	GLuint progressCounter = 0;
-	GLuint vSeen = 0;
+	std::vector<PLY_VERTEX_TARGET> vertexPlan;
+	bool targetSeen[NUM_TARGETS] = {false};
+	if( vertexElement != nullptr ) {
+		for( const auto& property : vertexElement->properties ) {
+			const std::string& name = property.name;
+			PLY_VERTEX_TARGET target = IGNORED;
+			if( property.isList ) target = IGNORED;
+			else if( name == "x" ) target = POS_X;
+			else if( name == "y" ) target = POS_Y;
+			else if( name == "z" ) target = POS_Z;
+			else if( name == "nx" ) target = NORM_X;
+			else if( name == "ny" ) target = NORM_Y;
+			else if( name == "nz" ) target = NORM_Z;
+			else if( name == "s" || name == "u" || name == "texture_s" || name == "texture_u" ) target = TEX_S;
+			else if( name == "t" || name == "v" || name == "texture_t" || name == "texture_v" ) target = TEX_T;
+			else if( name == "red" || name == "diffuse_red" ) target = COLOR_R;
+			else if( name == "green" || name == "diffuse_green" ) target = COLOR_G;
+			else if( name == "blue" || name == "diffuse_blue" ) target = COLOR_B;
+			else if( name == "alpha" || name == "diffuse_alpha" ) target = COLOR_A;
+			if( target != IGNORED ) {
+				if( targetSeen[target] ) target = IGNORED;
+				else targetSeen[target] = true;
+			}
+			vertexPlan.push_back( target );
+		}
+	}
 
-	while( getline( in, line ) ) {
-		if( line.length() > 1 && line.at(0) == '\t' )
-			line = line.substr( 1 );
-		line.erase( line.find_last_not_of( " \n\r\t" ) + 1 );
+	const CSCI441_INTERNAL::PLYProperty* faceIndexProperty = nullptr;
+	if( faceElement != nullptr ) {
+		for( const auto& property : faceElement->properties ) {
+			if( property.isList && (property.name == "vertex_indices" || property.name == "vertex_index") ) {
+				faceIndexProperty = &property;
+				break;
+			}
+		}
+	}
 
-		std::vector< std::string > tokens = _tokenizeString( line, " \t" );
+	// point clouds have nothing to draw as triangles
+	if( vertexElement == nullptr || !targetSeen[POS_X] || !targetSeen[POS_Y] || !targetSeen[POS_Z] || faceIndexProperty == nullptr ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.ply]: [ERROR]: File \"%s\" does not declare vertex positions and face vertex indices, point clouds are not supported\n", _filename.c_str() );
+		if ( INFO ) CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		return false;
+	}
 
-		if( tokens.empty() ) continue;
+	// every record takes at least one byte per ASCII value or the size of each binary value and list count,
+	// so counts the body cannot hold are rejected before anything is allocated for them
+	size_t bodyBytesNeeded = 0;
+	bool countsFit = vertexElement->count <= std::numeric_limits<GLuint>::max() && faceElement->count <= std::numeric_limits<GLuint>::max();
+	for( const auto& element : elements ) {
+		size_t minimumRecordSize = 0;
+		for( const auto& property : element.properties ) {
+			minimumRecordSize += format == CSCI441_INTERNAL::PLY_FORMAT::ASCII ? 1 : CSCI441_INTERNAL::PLYProperty::sizeOf( property.isList ? property.countType : property.type );
+		}
+		if( minimumRecordSize == 0 ) continue;
+		const size_t bodySize = static_cast<size_t>(cursor.end - cursor.current);
+		if( element.count > (bodySize - bodyBytesNeeded) / minimumRecordSize ) {
+			countsFit = false;
+			break;
+		}
+		bodyBytesNeeded += element.count * minimumRecordSize;
+	}
+	if( !countsFit ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.ply]: [ERROR]: File \"%s\" declares more elements than its body holds\n", _filename.c_str() );
+		if ( INFO ) CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		return false;
+	}
 
-		//the line should have a single character that lets us know if it's a...
-		if( tokens[0] == "comment" ) {								// comment ignore
-		} else if( fileState == HEADER ) {
-			if( tokens[0] == "ply" ) {					// denotes ply File type
-			} else if( tokens[0] == "format" ) {
-				if( tokens[1] != "ascii" ) {
-					if (ERRORS) CSCI441::LogUtils::logError("[.ply]: [ERROR]: File \"%s\" not ASCII format\n", _filename.c_str() );
-					if ( INFO ) CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
-					in.close();
-					return false;
-				}
-			} else if( tokens[0] == "element" ) {		// an element (vertex, face, material)
-				if( tokens[1] == "vertex" ) {
-					numVertices = static_cast<GLuint>(strtol(tokens[2].c_str(), nullptr, 10));
-					elemType = VERTEX;
-				} else if( tokens[1] == "face" ) {
-					numFaces = static_cast<GLuint>(strtol(tokens[2].c_str(), nullptr, 10));
-					elemType = FACE;
-				} else if( tokens[1] == "edge" ) {
-
-				} else if( tokens[1] == "material" ) {
-					numMaterials = static_cast<GLuint>(strtol(tokens[2].c_str(), nullptr, 10));
-					elemType = MATERIAL;
-				} else {
+	_hasVertexNormals = targetSeen[NORM_X] && targetSeen[NORM_Y] && targetSeen[NORM_Z];
+	_hasVertexTexCoords = targetSeen[TEX_S] && targetSeen[TEX_T];
+	const bool hasVertexColors = targetSeen[COLOR_R] && targetSeen[COLOR_G] && targetSeen[COLOR_B];
 
-				}
-			} else if( tokens[0] == "property" ) {
-				if( elemType == VERTEX ) {
+	const auto numVertices = static_cast<GLuint>(vertexElement->count);
+	const auto numFaces = static_cast<GLuint>(faceElement->count);
+
+	// integer colors are normalized by the largest value their type holds
+	GLfloat targetScale[NUM_TARGETS];
+	std::fill( targetScale, targetScale + NUM_TARGETS, 1.0f );
+	for( size_t i = 0; i < vertexPlan.size(); i++ ) {
+		if( vertexPlan[i] >= COLOR_R && vertexPlan[i] <= COLOR_A ) {
+			targetScale[vertexPlan[i]] = static_cast<GLfloat>( 1.0 / CSCI441_INTERNAL::PLYProperty::normalizationScale( vertexElement->properties[i].type ) );
+		}
+	}
 
-				} else if( elemType == FACE ) {
+	// a streamed model only holds one chunk of vertices and indices at a time
+	CSCI441_INTERNAL::StreamingLoadState stream;
+	const bool streaming = _streamsLoad( INFO );
+	if( streaming && !_beginStreaming( stream, numVertices, hasVertexColors ) ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.ply]: [ERROR]: Could not create a temporary file to stream \"%s\" through\n", _filename.c_str() );
+		if ( INFO ) CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		return false;
+	}
+	const GLuint numArrayVertices = streaming ? static_cast<GLuint>( std::min<size_t>( stream.chunkVertices, numVertices ) ) : numVertices;
+
+	glm::vec3* vertices = new glm::vec3[numArrayVertices];
+	glm::vec3* normals = new glm::vec3[numArrayVertices]();
+	glm::vec2* texCoords = new glm::vec2[numArrayVertices]();
+	glm::vec4* colors = hasVertexColors ? new glm::vec4[numArrayVertices] : nullptr;
+	std::vector<GLuint> faceIndices;
+	faceIndices.reserve( streaming ? stream.chunkIndices + 3 : static_cast<size_t>(numFaces) * 3 );
+
+	if (INFO) CSCI441::LogUtils::log("[.ply]: parsing %s...", _filename.c_str() );
+
+	CSCI441_INTERNAL::PLYReader reader( cursor.current, cursor.end, format );
+	bool truncated = false, spillFailed = false;
+	GLuint numDegenerateFaces = 0, numInvalidIndices = 0;
+
+	// decodes the next count vertex records into the start of the attribute arrays, false if the body ends first
+	const auto decodeVertices = [&]( const GLuint count ) -> bool {
+		const auto& properties = vertexElement->properties;
+
+		if( format != CSCI441_INTERNAL::PLY_FORMAT::ASCII && vertexElement->recordSize != 0 && !reader.swapsBytes()
+			&& properties.size() == 3 && vertexElement->recordSize == sizeof(glm::vec3)
+			&& properties[0].type == CSCI441_INTERNAL::PLYProperty::TYPE::FLOAT32 && vertexPlan[0] == POS_X
+			&& properties[1].type == CSCI441_INTERNAL::PLYProperty::TYPE::FLOAT32 && vertexPlan[1] == POS_Y
+			&& properties[2].type == CSCI441_INTERNAL::PLYProperty::TYPE::FLOAT32 && vertexPlan[2] == POS_Z ) {
+			// record is exactly the position in host order, copy the whole element at once
+			if( reader.remaining() < sizeof(glm::vec3) * count ) return false;
+			memcpy( vertices, reader.position(), sizeof(glm::vec3) * count );
+			reader.skipBytes( sizeof(glm::vec3) * count );
+		} else if( format != CSCI441_INTERNAL::PLY_FORMAT::ASCII && vertexElement->recordSize != 0 ) {
+			// fixed size records, decode each planned property at its offset
+			if( reader.remaining() < vertexElement->recordSize * count ) return false;
+			const bool swapBytes = reader.swapsBytes();
+			GLfloat components[NUM_TARGETS] = {0.0f};
+			components[COLOR_A] = 1.0f;
+			for( GLuint v = 0; v < count; v++ ) {
+				const char* record = reader.position() + static_cast<size_t>(v) * vertexElement->recordSize;
+				for( size_t p = 0; p < properties.size(); p++ ) {
+					if( vertexPlan[p] == IGNORED ) continue;
+					if( properties[p].type == CSCI441_INTERNAL::PLYProperty::TYPE::FLOAT32 && !swapBytes ) {
+						memcpy( &components[vertexPlan[p]], record + properties[p].offset, sizeof(GLfloat) );
+					} else {
+						components[vertexPlan[p]] = static_cast<GLfloat>( CSCI441_INTERNAL::PLYReader::decodeBinary( record + properties[p].offset, properties[p].type, swapBytes ) );
+					}
+				}
+				vertices[v] = glm::vec3( components[POS_X], components[POS_Y], components[POS_Z] );
+				normals[v] = glm::vec3( components[NORM_X], components[NORM_Y], components[NORM_Z] );
+				texCoords[v] = glm::vec2( components[TEX_S], components[TEX_T] );
+				if( colors != nullptr ) colors[v] = glm::vec4( components[COLOR_R] * targetScale[COLOR_R], components[COLOR_G] * targetScale[COLOR_G], components[COLOR_B] * targetScale[COLOR_B], components[COLOR_A] * targetScale[COLOR_A] );
+			}
+			reader.skipBytes( vertexElement->recordSize * count );
+		} else {
+			// ASCII or variable sized records, decode each property in sequence
+			GLfloat components[NUM_TARGETS] = {0.0f};
+			components[COLOR_A] = 1.0f;
+			for( GLuint v = 0; v < count; v++ ) {
+				for( size_t p = 0; p < properties.size(); p++ ) {
+					double value;
+					if( vertexPlan[p] == IGNORED ) {
+						if( !reader.skip( properties[p] ) ) return false;
+					} else if( reader.read( properties[p].type, value ) ) {
+						components[vertexPlan[p]] = static_cast<GLfloat>( value );
+					} else {
+						return false;
+					}
+				}
+				vertices[v] = glm::vec3( components[POS_X], components[POS_Y], components[POS_Z] );
+				normals[v] = glm::vec3( components[NORM_X], components[NORM_Y], components[NORM_Z] );
+				texCoords[v] = glm::vec2( components[TEX_S], components[TEX_T] );
+				if( colors != nullptr ) colors[v] = glm::vec4( components[COLOR_R] * targetScale[COLOR_R], components[COLOR_G] * targetScale[COLOR_G], components[COLOR_B] * targetScale[COLOR_B], components[COLOR_A] * targetScale[COLOR_A] );
+			}
+		}
+		return true;
+	};
 
-				} else if( elemType == MATERIAL ) {
+	for( const auto& element : elements ) {
+		if( truncated ) break;
 
+		if( &element == vertexElement ) {
+			if( !streaming ) {
+				truncated = !decodeVertices( numVertices );
+				continue;
+			}
+			for( GLuint firstVertex = 0; firstVertex < numVertices && !truncated; firstVertex += numArrayVertices ) {
+				const GLuint count = std::min( numArrayVertices, numVertices - firstVertex );
+				const char* chunkStart = reader.position();
+				if( !decodeVertices( count ) ) {
+					truncated = true;
+					break;
 				}
-			} else if( tokens[0] == "end_header" ) {	// end of the header section
-				fileState = VERTICES;
+				_streamVertices( stream, firstVertex, count, vertices, normals, texCoords, colors );
+				// the decoded chunk of the file is not read again
+				plyFile.discard( static_cast<size_t>(chunkStart - plyFile.data()), static_cast<size_t>(reader.position() - plyFile.data()) );
 			}
-		} else if( fileState == VERTICES ) {
-			// read in x y z vertex location
-			auto x = (GLfloat) strtof( tokens[0].c_str(), nullptr ),
-                 y = (GLfloat) strtof( tokens[1].c_str(), nullptr ),
-                 z = (GLfloat) strtof( tokens[2].c_str(), nullptr );
+		} else if( &element == faceElement ) {
+			const char* chunkStart = reader.position();
+			for( GLuint f = 0; f < numFaces && !truncated; f++ ) {
+				for( const auto& property : element.properties ) {
+					if( &property != faceIndexProperty ) {
+						if( !reader.skip( property ) ) { truncated = true; break; }
+						continue;
+					}
 
-			if( x < minX ) minX = x;
-			if( x > maxX ) maxX = x;
-			if( y < minY ) minY = y;
-			if( y > maxY ) maxY = y;
-			if( z < minZ ) minZ = z;
-			if( z > maxZ ) maxZ = z;
+					double count, index;
+					if( !reader.read( property.countType, count ) ) { truncated = true; break; }
+					// a list cannot have more entries than bytes left in the body
+					if( !(count >= 0.0 && count <= static_cast<double>(reader.remaining())) ) { truncated = true; break; }
+
+					// triangulate the polygon as a fan around its first vertex while its indices are read
+					const size_t faceStart = faceIndices.size();
+					const auto numFaceVertices = static_cast<GLuint>(count);
+					GLuint fanRoot = 0, fanPrevious = 0;
+					bool inRange = true;
+					for( GLuint i = 0; i < numFaceVertices; i++ ) {
+						if( !reader.read( property.type, index ) ) { truncated = true; break; }
+						const bool validIndex = index >= 0.0 && index < static_cast<double>(numVertices);
+						if( !validIndex ) inRange = false;
+						const GLuint vertexIndex = validIndex ? static_cast<GLuint>(index) : 0;
+						if( i == 0 ) {
+							fanRoot = vertexIndex;
+						} else if( i >= 2 ) {
+							faceIndices.push_back( fanRoot );
+							faceIndices.push_back( fanPrevious );
+							faceIndices.push_back( vertexIndex );
+						}
+						fanPrevious = vertexIndex;
+					}
+					if( truncated ) break;
 
-			vSeen++;
-			// if all vertices have been read in, move on to faces
-			if( vSeen == numVertices )
-				fileState = FACES;
-		} else if( fileState == FACES ) {
-			auto numberOfVerticesInFace = static_cast<GLuint>(strtol(tokens[0].c_str(), nullptr, 10));
-			numTriangles += numberOfVerticesInFace - 3 + 1;
-		} else {
-			if (INFO) CSCI441::LogUtils::log("[.ply]: unknown file state: %d\n", fileState );
-		}
+					if( numFaceVertices < 3 ) {
+						numDegenerateFaces++;
+					} else if( !inRange ) {
+						faceIndices.resize( faceStart );
+						numInvalidIndices++;
+					}
+				}
 
-		if (INFO) {
-			progressCounter++;
-			if( progressCounter % 5000 == 0 ) {
-				CSCI441::LogUtils::log("\33[2K\r");
-				switch( progressCounter ) {
-					case 5000:	CSCI441::LogUtils::log("[.ply]: scanning %s...\\", _filename.c_str());	break;
-					case 10000:	CSCI441::LogUtils::log("[.ply]: scanning %s...|", _filename.c_str());	break;
-					case 15000:	CSCI441::LogUtils::log("[.ply]: scanning %s.../", _filename.c_str());	break;
-					case 20000:	CSCI441::LogUtils::log("[.ply]: scanning %s...-", _filename.c_str());	break;
-                    default: break;
+				if( streaming && faceIndices.size() >= stream.chunkIndices ) {
+					if( !_streamIndices( stream, faceIndices.data(), faceIndices.size() ) ) spillFailed = true;
+					faceIndices.clear();
+					plyFile.discard( static_cast<size_t>(chunkStart - plyFile.data()), static_cast<size_t>(reader.position() - plyFile.data()) );
+					chunkStart = reader.position();
+				}
+			}
+			if( streaming && !_streamIndices( stream, faceIndices.data(), faceIndices.size() ) ) spillFailed = true;
+			if( streaming ) faceIndices.clear();
+		} else if( format != CSCI441_INTERNAL::PLY_FORMAT::ASCII && element.recordSize != 0 ) {
+			if( !reader.skipBytes( element.recordSize * element.count ) ) truncated = true;
+		} else {
+			for( size_t r = 0; r < element.count && !truncated; r++ ) {
+				for( const auto& property : element.properties ) {
+					if( !reader.skip( property ) ) { truncated = true; break; }
 				}
-				fflush(stdout);
 			}
-			if( progressCounter == 20000 )
-				progressCounter = 0;
 		}
 	}
-	in.close();
 
 	if (INFO) {
 		CSCI441::LogUtils::log("\33[2K\r" );
-		CSCI441::LogUtils::log("[.ply]: scanning %s...done!\n", _filename.c_str() );
-		CSCI441::LogUtils::log("[.ply]: ------------\n" );
-		CSCI441::LogUtils::log("[.ply]: Model Stats:\n" );
-		CSCI441::LogUtils::log("[.ply]: Vertices:  \t%u\tNormals:   \t%u\tTex Coords:\t%u\n", numVertices, 0, 0 );
-		CSCI441::LogUtils::log("[.ply]: Faces:     \t%u\tTriangles: \t%u\n", numFaces, numTriangles );
-		CSCI441::LogUtils::log("[.ply]: Dimensions:\t(%f, %f, %f)\n", (maxX - minX), (maxY - minY), (maxZ - minZ) );
+		CSCI441::LogUtils::log("[.ply]: parsing %s...done!\n", _filename.c_str() );
 	}
-
-	if( _hasVertexNormals || !sAUTO_GEN_NORMALS ) {
-		if (INFO && !_hasVertexNormals)
-			CSCI441::LogUtils::log("[.ply]: [WARN]: No vertex normals exist on model.  To autogenerate vertex\n\tnormals, call CSCI441::ModelLoader::enableAutoGenerateNormals()\n\tprior to loading the model file.\n" );
-        _allocateAttributeArrays(numVertices, numTriangles*3);
-	} else {
-		if (INFO) CSCI441::LogUtils::log("[.ply]: No vertex normals exist on model, vertex normals will be autogenerated\n" );
-        _allocateAttributeArrays(numTriangles*3, numTriangles*3);
+	_loadStats.parseMilliseconds += CSCI441_INTERNAL::millisecondsSince( parseStart );
+
+	// fan triangulated faces can produce more indices than an index buffer can count
+	const size_t numIndices = streaming ? stream.numIndices : faceIndices.size();
+	const bool tooManyIndices = numIndices > std::numeric_limits<GLuint>::max();
+	if( truncated || spillFailed || tooManyIndices ) {
+		if (ERRORS) {
+			if( truncated )       CSCI441::LogUtils::logError("[.ply]: [ERROR]: File \"%s\" ended before every element was read\n", _filename.c_str() );
+			else if( spillFailed ) CSCI441::LogUtils::logError("[.ply]: [ERROR]: Could not write the indices of \"%s\" to a temporary file\n", _filename.c_str() );
+			else                  CSCI441::LogUtils::logError("[.ply]: [ERROR]: File \"%s\" triangulates to %zu indices, more than can be drawn\n", _filename.c_str(), numIndices );
+		}
+		if ( INFO ) CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		delete[] vertices;
+		delete[] normals;
+		delete[] texCoords;
+		delete[] colors;
+		return false;
 	}
+	if (ERRORS && numInvalidIndices > 0) CSCI441::LogUtils::logError("[.ply]: [WARN]: %u faces reference vertices that do not exist and were skipped\n", numInvalidIndices );
 
-	if (INFO) CSCI441::LogUtils::log("[.ply]: ------------\n" );
+	const auto numTriangles = static_cast<GLuint>(numIndices / 3);
 
-	std::vector<glm::vec3> verticesTemp;
+	GLfloat minX = 999999.0f, maxX = -999999.0f, minY = 999999.0f, maxY = -999999.0f, minZ = 999999.0f, maxZ = -999999.0f;
+	if( streaming && numVertices > 0 ) {
+		minX = stream.minimum.x; minY = stream.minimum.y; minZ = stream.minimum.z;
+		maxX = stream.maximum.x; maxY = stream.maximum.y; maxZ = stream.maximum.z;
+	}
+	for( GLuint v = 0; v < numVertices && !streaming; v++ ) {
+		if( vertices[v].x < minX ) minX = vertices[v].x;
+		if( vertices[v].x > maxX ) maxX = vertices[v].x;
+		if( vertices[v].y < minY ) minY = vertices[v].y;
+		if( vertices[v].y > maxY ) maxY = vertices[v].y;
+		if( vertices[v].z < minZ ) minZ = vertices[v].z;
+		if( vertices[v].z > maxZ ) maxZ = vertices[v].z;
+	}
 
-	in.open( _filename );
+	if (INFO) {
+		CSCI441::LogUtils::log("[.ply]: ------------\n" );
+		CSCI441::LogUtils::log("[.ply]: Model Stats:\n" );
+		CSCI441::LogUtils::log("[.ply]: Vertices:  \t%u\tNormals:   \t%u\tTex Coords:\t%u\n", numVertices, (_hasVertexNormals ? numVertices : 0), (_hasVertexTexCoords ? numVertices : 0) );
+		CSCI441::LogUtils::log("[.ply]: Colors:    \t%u\n", (hasVertexColors ? numVertices : 0) );
+		CSCI441::LogUtils::log("[.ply]: Faces:     \t%u\tTriangles: \t%u\n", numFaces - numDegenerateFaces - numInvalidIndices, numTriangles );
+		CSCI441::LogUtils::log("[.ply]: Dimensions:\t(%f, %f, %f)\n", (maxX - minX), (maxY - minY), (maxZ - minZ) );
+	}
 
 	_uniqueIndex = 0;
 	_numIndices = 0;
 
-	fileState = HEADER;
-	elemType = NONE;
-
-	progressCounter = 0;
-	vSeen = 0;
-
-	while( getline( in, line ) ) {
-		if( line.length() > 1 && line.at(0) == '\t' )
-			line = line.substr( 1 );
-		line.erase( line.find_last_not_of( " \n\r\t" ) + 1 );
+	if( streaming ) {
+		// every vertex is already in the vertex buffer, the arrays only staged the last chunk
+		delete[] vertices;
+		delete[] normals;
+		delete[] texCoords;
+		delete[] colors;
+		result = _endStreaming( stream, INFO );
+		if (ERRORS && !result) CSCI441::LogUtils::logError("[.ply]: [ERROR]: Could not read back the indices of \"%s\" from a temporary file\n", _filename.c_str() );
+		if (INFO) CSCI441::LogUtils::log("[.ply]: ------------\n" );
+	} else {
+		if (INFO && !_hasVertexNormals && !_loadOptions.autoGenNormals)
+			CSCI441::LogUtils::log("[.ply]: [WARN]: No vertex normals exist on model.  To autogenerate vertex\n\tnormals, call CSCI441::ModelLoader::enableAutoGenerateNormals()\n\tprior to loading the model file.\n" );
 
-		std::vector< std::string > tokens = _tokenizeString( line, " \t" );
+		// the decoded arrays become the attribute arrays as is
+		_vertices = vertices;
+		_normals = normals;
+		_texCoords = texCoords;
+		_colors = colors;
+		_tangents = new glm::vec4[numVertices]();
+		_indices = new GLuint[faceIndices.size()];
+		memcpy( _indices, faceIndices.data(), sizeof(GLuint) * faceIndices.size() );
+		_uniqueIndex = numVertices;
+		_numIndices = static_cast<GLuint>(numIndices);
 
-		if( tokens.empty() ) continue;
+		if (INFO) CSCI441::LogUtils::log("[.ply]: ------------\n" );
 
-		//the line should have a single character that lets us know if it's a...
-		if( tokens[0] == "comment" ) {								// comment ignore
-		} else if( fileState == HEADER ) {
-			if( tokens[0] == "ply" ) {					// denotes ply File type
-			} else if( tokens[0] == "format" ) {
-				if( tokens[1] != "ascii" ) {
-					if (ERRORS) CSCI441::LogUtils::logError("[.ply]: [ERROR]: File \"%s\" not ASCII format\n", _filename.c_str() );
-					if ( INFO ) CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
-					in.close();
-					return false;
-				}
-			} else if( tokens[0] == "element" ) {		// an element (vertex, face, material)
-				if( tokens[1] == "vertex" ) {
-					numVertices = static_cast<GLuint>(strtol(tokens[2].c_str(), nullptr, 10));
-					elemType = VERTEX;
-				} else if( tokens[1] == "face" ) {
-					numFaces = static_cast<GLuint>(strtol(tokens[2].c_str(), nullptr, 10));
-					elemType = FACE;
-				} else if( tokens[1] == "edge" ) {
-
-				} else if( tokens[1] == "material" ) {
-					numMaterials = static_cast<GLuint>(strtol(tokens[2].c_str(), nullptr, 10));
-					elemType = MATERIAL;
-				} else {
+		_postProcessMesh( INFO, nullptr, 0 );
+	}
 
-				}
-			} else if( tokens[0] == "property" ) {
-				if( elemType == VERTEX ) {
+	const double seconds = CSCI441_INTERNAL::millisecondsSince( start ) / 1000.0;
 
-				} else if( elemType == FACE ) {
+	if (INFO) {
+		CSCI441::LogUtils::log("[.ply]: Time to complete: %.3fs\n", seconds );
+		CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+	}
 
-				} else if( elemType == MATERIAL ) {
+	return result;
+}
 
-				}
-			} else if( tokens[0] == "end_header" ) {	// end of the header section
-				fileState = VERTICES;
+//
+//  bool _parsePLYHeader(TextCursor& cursor, PLY_FORMAT& format, vector<PLYElement>& elements)
+//
+//      Reads the header of a PLY file up through end_header, leaving the
+//  cursor at the first byte of the body.  Element record sizes and property
+//  offsets are computed for elements without list properties.
+//
+inline bool CSCI441::ModelLoader::_parsePLYHeader( CSCI441_INTERNAL::TextCursor &cursor, CSCI441_INTERNAL::PLY_FORMAT &format, std::vector<CSCI441_INTERNAL::PLYElement> &elements ) {
+	using CSCI441_INTERNAL::PLYProperty;
+
+	if( cursor.nextToken() != "ply" ) return false;
+	cursor.skipLine();
+
+	bool formatSeen = false;
+	while( !cursor.atEnd() ) {
+		const std::string_view keyword = cursor.nextToken();
+
+		if( keyword == "format" ) {
+			const std::string_view formatName = cursor.nextToken();
+			if( formatName == "ascii" )                     format = CSCI441_INTERNAL::PLY_FORMAT::ASCII;
+			else if( formatName == "binary_little_endian" ) format = CSCI441_INTERNAL::PLY_FORMAT::BINARY_LITTLE_ENDIAN;
+			else if( formatName == "binary_big_endian" )    format = CSCI441_INTERNAL::PLY_FORMAT::BINARY_BIG_ENDIAN;
+			else return false;
+			formatSeen = true;
+		} else if( keyword == "element" ) {
+			CSCI441_INTERNAL::PLYElement element;
+			element.name = std::string( cursor.nextToken() );
+			GLint count;
+			if( !CSCI441_INTERNAL::parseInt( cursor.nextToken(), count ) || count < 0 ) return false;
+			element.count = static_cast<size_t>(count);
+			elements.push_back( std::move(element) );
+		} else if( keyword == "property" ) {
+			if( elements.empty() ) return false;
+			PLYProperty property;
+			std::string_view typeName = cursor.nextToken();
+			if( typeName == "list" ) {
+				property.isList = true;
+				property.countType = PLYProperty::typeFromName( cursor.nextToken() );
+				if( property.countType == PLYProperty::TYPE::UNKNOWN
+					|| property.countType == PLYProperty::TYPE::FLOAT32 || property.countType == PLYProperty::TYPE::FLOAT64 ) return false;
+				typeName = cursor.nextToken();
 			}
-		} else if( fileState == VERTICES ) {
-			// read in x y z vertex location
-			glm::vec3 pos(strtof( tokens[0].c_str(), nullptr ),
-                          strtof( tokens[1].c_str(), nullptr ),
-                          strtof( tokens[2].c_str(), nullptr ) );
-
-			if( _hasVertexNormals || !sAUTO_GEN_NORMALS ) {
-				_vertices[ _uniqueIndex ] = pos;
-				_uniqueIndex++;
-			} else {
-				verticesTemp.push_back(pos );
-				vSeen++;
+			property.type = PLYProperty::typeFromName( typeName );
+			if( property.type == PLYProperty::TYPE::UNKNOWN ) return false;
+			property.name = std::string( cursor.nextToken() );
+			elements.back().properties.push_back( std::move(property) );
+		} else if( keyword == "end_header" ) {
+			cursor.skipLine();
+			break;
+		}
+		// comment, obj_info, and blank lines carry nothing to decode
+		cursor.skipLine();
+	}
+	if( !formatSeen ) return false;
+
+	for( auto& element : elements ) {
+		size_t offset = 0;
+		bool fixedSize = true;
+		for( auto& property : element.properties ) {
+			property.offset = offset;
+			if( property.isList ) fixedSize = false;
+			offset += PLYProperty::sizeOf( property.type );
+		}
+		element.recordSize = fixedSize ? offset : 0;
+	}
+	return true;
+}
+
+//
+//  bool _isBinarySTL(stlFile)
+//
+//      Binary STL files are an 80 byte header, a 4 byte triangle count, then
+//  50 bytes per triangle.  The header may itself begin with "solid", so the
+//  file size is checked against the triangle count rather than relying on
+//  the leading text.
+//
+inline bool CSCI441::ModelLoader::_isBinarySTL( const CSCI441_INTERNAL::MappedFile &stlFile ) {
+	if( stlFile.size() < STL_BINARY_HEADER_SIZE ) return false;
+
+	uint32_t numTriangles = 0;
+	memcpy( &numTriangles, stlFile.data() + 80, sizeof(numTriangles) );
+	const size_t expectedSize = STL_BINARY_HEADER_SIZE + static_cast<size_t>(numTriangles) * STL_BINARY_TRIANGLE_SIZE;
+
+	if( stlFile.size() == expectedSize ) return true;
+	// some exporters append trailing bytes, accept those as long as the file does not look like text
+	return stlFile.size() > expectedSize && strncmp( stlFile.data(), "solid", 5 ) != 0;
+}
+
+inline bool CSCI441::ModelLoader::_loadBinarySTLFile( const CSCI441_INTERNAL::MappedFile &stlFile, const bool INFO, const bool ERRORS ) {
+	bool result = true;
+
+	if (INFO) CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=- BEGIN %s Info -=-=-=-=-=-=-=-\n", _filename.c_str() );
+
+	const auto start = std::chrono::steady_clock::now();
+
+	uint32_t numTriangles = 0;
+	memcpy( &numTriangles, stlFile.data() + 80, sizeof(numTriangles) );
+
+	// three unshared vertices per triangle, counted in size_t since the triangle count alone fills 32 bits
+	const size_t numVertices = static_cast<size_t>(numTriangles) * 3;
+	if( numVertices > std::numeric_limits<GLuint>::max() || stlFile.size() < STL_BINARY_HEADER_SIZE + static_cast<size_t>(numTriangles) * STL_BINARY_TRIANGLE_SIZE ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.stl]: [ERROR]: File \"%s\" declares %u triangles, more than %s\n", _filename.c_str(), numTriangles,
+												numVertices > std::numeric_limits<GLuint>::max() ? "can be indexed" : "the file holds" );
+		if ( INFO ) CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		return false;
+	}
+
+	// a streamed model stages one chunk of triangles in the attribute arrays at a time
+	CSCI441_INTERNAL::StreamingLoadState stream;
+	const bool streaming = _streamsLoad( INFO );
+	if( streaming && !_beginStreaming( stream, static_cast<GLuint>(numVertices), false ) ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.stl]: [ERROR]: Could not create a temporary file to stream \"%s\" through\n", _filename.c_str() );
+		if ( INFO ) CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		return false;
+	}
+	const uint32_t chunkTriangles = streaming ? static_cast<uint32_t>( std::min<size_t>( stream.chunkVertices / 3, numTriangles ) ) : numTriangles;
+	bool spillFailed = false;
+
+    _allocateAttributeArrays(chunkTriangles*3, chunkTriangles*3);
+
+	glm::vec3 minDimension = {999999.f, 999999.f, 999999.f};
+	glm::vec3 maxDimension = { -999999.f, -999999.f, -999999.f };
+
+	// each record is a facet normal, three vertex positions, and a two byte attribute count
+	// stored as little endian floats with no padding, so copy the values out instead of casting
+	const char* record = stlFile.data() + STL_BINARY_HEADER_SIZE;
+	for( uint32_t firstTriangle = 0; firstTriangle < numTriangles; firstTriangle += chunkTriangles ) {
+		const char* chunkStart = record;
+		const uint32_t lastTriangle = std::min( firstTriangle + chunkTriangles, numTriangles );
+		for( uint32_t i = firstTriangle; i < lastTriangle; i++, record += STL_BINARY_TRIANGLE_SIZE ) {
+			glm::vec3 facet[4];
+			memcpy( facet, record, sizeof(facet) );
+
+			// not all exporters fill in the facet normal, fall back to the winding order
+			glm::vec3 normal = facet[0];
+			if( normal == glm::vec3(0.0f) ) {
+				const glm::vec3 faceNormal = glm::cross( facet[2] - facet[1], facet[3] - facet[1] );
+				if( glm::dot(faceNormal, faceNormal) > 0.0f ) normal = glm::normalize( faceNormal );
+			}
+
+			for( GLuint j = 1; j <= 3; j++ ) {
+				_vertices[ _uniqueIndex ] = facet[j];
+				_normals[ _uniqueIndex ] = normal;
+				_texCoords[ _uniqueIndex ] = glm::vec2(0.0f);
+				_indices[ _numIndices++ ] = _uniqueIndex++;
+
+				minDimension = glm::min( minDimension, facet[j] );
+				maxDimension = glm::max( maxDimension, facet[j] );
 			}
-			// if all vertices have been read in, move on to faces
-			if( _uniqueIndex == numVertices || vSeen == numVertices )
-				fileState = FACES;
-		} else if( fileState == FACES ) {
-			auto numberOfVerticesInFace = static_cast<GLuint>(strtol(tokens[0].c_str(), nullptr, 10));
-
-			for( GLuint i = 2; i <= numberOfVerticesInFace - 1; i++ ) {
-				if( _hasVertexNormals || !sAUTO_GEN_NORMALS ) {
-					_indices[ _numIndices++ ] = static_cast<GLuint>(strtol(tokens[1].c_str(), nullptr, 10));
-					_indices[ _numIndices++ ] = static_cast<GLuint>(strtol(tokens[i].c_str(), nullptr, 10));
-					_indices[ _numIndices++ ] = static_cast<GLuint>(strtol(tokens[i + 1].c_str(), nullptr, 10));
-				} else {
-					auto aI = static_cast<GLuint>(strtol(tokens[1].c_str(), nullptr, 10));
-					auto bI = static_cast<GLuint>(strtol(tokens[i].c_str(), nullptr, 10));
-					auto cI = static_cast<GLuint>(strtol(tokens[i + 1].c_str(), nullptr, 10));
-
-					glm::vec3 a = verticesTemp[aI];
-					glm::vec3 b = verticesTemp[bI];
-					glm::vec3 c = verticesTemp[cI];
-
-					glm::vec3 ab = b - a; glm::vec3 ac = c - a;
-					glm::vec3 ba = a - b; glm::vec3 bc = c - b;
-					glm::vec3 ca = a - c; glm::vec3 cb = b - c;
-
-					glm::vec3 aN = glm::normalize( glm::cross( ab, ac ) );
-					glm::vec3 bN = glm::normalize( glm::cross( bc, ba ) );
-					glm::vec3 cN = glm::normalize( glm::cross( ca, cb ) );
-
-					_vertices[ _uniqueIndex ] = a;
-					_normals[ _uniqueIndex ] = aN;
-					_indices[ _numIndices++ ] = _uniqueIndex++;
-
-					_vertices[ _uniqueIndex ] = b;
-					_normals[ _uniqueIndex ] = bN;
-					_indices[ _numIndices++ ] = _uniqueIndex++;
-
-					_vertices[ _uniqueIndex ] = c;
-					_normals[ _uniqueIndex ] = cN;
-					_indices[ _numIndices++ ] = _uniqueIndex++;
+		}
+
+		if( streaming ) {
+			const GLuint firstVertex = firstTriangle * 3;
+			_streamVertices( stream, firstVertex, _uniqueIndex, _vertices, _normals, _texCoords, nullptr );
+			for( GLuint j = 0; j < _numIndices; j++ ) _indices[j] += firstVertex;
+			if( !_streamIndices( stream, _indices, _numIndices ) ) spillFailed = true;
+			// the records of the chunk are not read again
+			stlFile.discard( static_cast<size_t>(chunkStart - stlFile.data()), static_cast<size_t>(record - stlFile.data()) );
+			_uniqueIndex = 0;
+			_numIndices = 0;
+		}
+	}
+	_hasVertexNormals = true;
+	_loadStats.parseMilliseconds += CSCI441_INTERNAL::millisecondsSince( start );
+
+	if (INFO) {
+		CSCI441::LogUtils::log("[.stl]: parsing %s...done!\n", _filename.c_str() );
+		CSCI441::LogUtils::log("[.stl]: ------------\n" );
+		CSCI441::LogUtils::log("[.stl]: Model Stats:\n" );
+		CSCI441::LogUtils::log("[.stl]: Format:    \tbinary\n" );
+		CSCI441::LogUtils::log("[.stl]: Vertices:  \t%u\tNormals:   \t%u\tTex Coords:\t%u\n", numTriangles*3, numTriangles, 0 );
+		CSCI441::LogUtils::log("[.stl]: Faces:     \t%u\tTriangles: \t%u\n", numTriangles, numTriangles );
+		const glm::vec3 sizeDimensions = maxDimension - minDimension;
+		CSCI441::LogUtils::log("[.stl]: Dimensions:\t(%f, %f, %f)\n", sizeDimensions.x, sizeDimensions.y, sizeDimensions.z );
+	}
+
+	if( streaming ) {
+		// every vertex is already in the vertex buffer, the arrays only staged the last chunk
+		delete[] _vertices;  _vertices = nullptr;
+		delete[] _normals;   _normals = nullptr;
+		delete[] _tangents;  _tangents = nullptr;
+		delete[] _texCoords; _texCoords = nullptr;
+		delete[] _indices;   _indices = nullptr;
+		result = !spillFailed && _endStreaming( stream, INFO );
+		if (ERRORS && !result) CSCI441::LogUtils::logError("[.stl]: [ERROR]: Could not stream the indices of \"%s\" through a temporary file\n", _filename.c_str() );
+	} else {
+		// facet normals keep the corners of neighboring triangles apart, weld them under generated smooth normals instead
+		if( _loadOptions.weldVertices && _loadOptions.autoGenNormals ) _hasVertexNormals = false;
+		_postProcessMesh( INFO, nullptr, 0 );
+	}
+
+	const double seconds = CSCI441_INTERNAL::millisecondsSince( start ) / 1000.0;
+
+	if (INFO) {
+		CSCI441::LogUtils::log("[.stl]: Time to complete: %.3fs\n", seconds);
+		CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+	}
+
+	return result;
+}
+
+inline bool CSCI441::ModelLoader::_loadSTLFile( const bool INFO, const bool ERRORS ) {
+	bool result = true;
+
+	if( CSCI441_INTERNAL::MappedFile stlFile; stlFile.open( _filename.c_str() ) && _isBinarySTL( stlFile ) ) {
+		return _loadBinarySTLFile( stlFile, INFO, ERRORS );
+	}
+
+	if (INFO) CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=- BEGIN %s Info -=-=-=-=-=-=-=-\n", _filename.c_str() );
+	if (INFO && _loadOptions.streamLoad) CSCI441::LogUtils::log("[.stl]: [WARN]: Only PLY and binary STL files are streamed, loading the model into memory\n" );
+
+	const auto start = std::chrono::steady_clock::now();
+
+	std::ifstream in( _filename );
+	if( !in.is_open() ) {
+		if (ERRORS) CSCI441::LogUtils::logError("[.stl]: [ERROR]: Could not open \"%s\"\n", _filename.c_str() );
+		if ( INFO ) CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		return false;
+	}
+
+	GLuint numVertices = 0, numNormals = 0, numFaces = 0, numTriangles = 0, numVertsInLoop = 0;
+	GLfloat minX = 999999.0f, maxX = -999999.0f, minY = 999999.0f, maxY = -999999.0f, minZ = 999999.0f, maxZ = -999999.0f;
+	std::string line;
+
+	int progressCounter = 0;
+	glm::vec3 normalVector = {0.f,0.f,0.f};
+
+	while( getline( in, line ) ) {
+		if( line.length() > 1 && line.at(0) == '\t' )
+			line = line.substr( 1 );
+		line.erase( line.find_last_not_of( " \n\r\t" ) + 1 );
+
+		std::vector< std::string > tokens = _tokenizeString( line, " \t" );
+
+		if( tokens.empty() ) continue;
+
+		if( tokens[0] == "solid" ) {
+
+		} else if( tokens[0] == "facet" ) {
+			// read in x y z triangle normal
+			numNormals++;
+		} else if( tokens[0] == "outer" && tokens[1] == "loop" ) {
+			// begin a primitive
+			numVertsInLoop = 0;
+		} else if( tokens[0] == "vertex" ) {
+			GLfloat x = strtof( tokens[1].c_str(), nullptr ),
+					y = strtof( tokens[2].c_str(), nullptr ),
+					z = strtof( tokens[3].c_str(), nullptr );
+
+			if( x < minX ) minX = x;
+			if( x > maxX ) maxX = x;
+			if( y < minY ) minY = y;
+			if( y > maxY ) maxY = y;
+			if( z < minZ ) minZ = z;
+			if( z > maxZ ) maxZ = z;
+
+			numVertices++;
+			numVertsInLoop++;
+		} else if( tokens[0] == "endloop" ) {
+			// end primitive
+			numTriangles += numVertsInLoop - 3 + 1;
+		} else if( tokens[0] == "endfacet" ) {
+			numFaces++;
+		} else if( tokens[0] == "endsolid" ) {
+
+		}
+		else {
+			if( memchr( line.c_str(), '\0', line.length() ) != nullptr ) {
+				if (ERRORS) CSCI441::LogUtils::logError("[.stl]: [ERROR]: Cannot read binary STL file \"%s\"\n", _filename.c_str() );
+				if ( INFO ) CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+				in.close();
+				return false;
+			} else if (INFO) CSCI441::LogUtils::log("[.stl]: unknown line: %s\n", line.c_str() );
+		}
+
+		if (INFO) {
+			progressCounter++;
+			if( progressCounter % 5000 == 0 ) {
+				CSCI441::LogUtils::log("\33[2K\r");
+				switch( progressCounter ) {
+					case 5000:	CSCI441::LogUtils::log("[.stl]: scanning %s...\\", _filename.c_str());	break;
+					case 10000:	CSCI441::LogUtils::log("[.stl]: scanning %s...|", _filename.c_str());	break;
+					case 15000:	CSCI441::LogUtils::log("[.stl]: scanning %s.../", _filename.c_str());	break;
+					case 20000:	CSCI441::LogUtils::log("[.stl]: scanning %s...-", _filename.c_str());	break;
+                    default: break;
 				}
+				fflush(stdout);
 			}
-		} else {
-			if (INFO) CSCI441::LogUtils::log("[.ply]: unknown file state: %d\n", fileState );
+			if( progressCounter == 20000 )
+				progressCounter = 0;
+		}
+	}
+	in.close();
+
+	if (INFO) {
+		CSCI441::LogUtils::log("\33[2K\r" );
+		CSCI441::LogUtils::log("[.stl]: scanning %s...done!\n", _filename.c_str() );
+		CSCI441::LogUtils::log("[.stl]: ------------\n" );
+		CSCI441::LogUtils::log("[.stl]: Model Stats:\n" );
+		CSCI441::LogUtils::log("[.stl]: Vertices:  \t%u\tNormals:   \t%u\tTex Coords:\t%u\n", numVertices, numNormals, 0 );
+		CSCI441::LogUtils::log("[.stl]: Faces:     \t%u\tTriangles: \t%u\n", numFaces, numTriangles );
+		CSCI441::LogUtils::log("[.stl]: Dimensions:\t(%f, %f, %f)\n", (maxX - minX), (maxY - minY), (maxZ - minZ) );
+	}
+
+    _allocateAttributeArrays(numVertices, numTriangles*3);
+
+	if (INFO) CSCI441::LogUtils::log("[.stl]: ------------\n" );
+
+	_loadStats.scanMilliseconds += CSCI441_INTERNAL::millisecondsSince( start );
+	const auto parseStart = std::chrono::steady_clock::now();
+
+	in.open( _filename );
+
+	_uniqueIndex = 0;
+	_numIndices = 0;
+
+	while( getline( in, line ) ) {
+		if( line.length() > 1 && line.at(0) == '\t' )
+			line = line.substr( 1 );
+		line.erase( line.find_last_not_of( " \n\r\t" ) + 1 );
+
+		std::vector< std::string > tokens = _tokenizeString( line, " \t" );
+
+		if( tokens.empty() ) continue;
+
+		if( tokens[0] == "solid" ) {
+
+		} else if( tokens[0] == "facet" ) {
+			// read in x y z triangle normal
+			normalVector = glm::vec3( strtof( tokens[2].c_str(), nullptr ),
+                                      strtof( tokens[3].c_str(), nullptr ),
+                                      strtof( tokens[4].c_str(), nullptr ) );
+		} else if( tokens[0] == "outer" && tokens[1] == "loop" ) {
+			// begin a primitive
+		} else if( tokens[0] == "vertex" ) {
+			_vertices[ _uniqueIndex ] = glm::vec3(strtof( tokens[1].c_str(), nullptr ),
+                                                  strtof( tokens[2].c_str(), nullptr ),
+                                                  strtof( tokens[3].c_str(), nullptr ) );
+			_normals[ _uniqueIndex ] = normalVector;
+			_indices[ _numIndices++ ] = _uniqueIndex++;
+		} else if( tokens[0] == "endloop" ) {
+			// end primitive
+		} else if( tokens[0] == "endfacet" ) {
+
+		} else if( tokens[0] == "endsolid" ) {
+
+		}
+		else {
+
 		}
 
 		if (INFO) {
@@ -1593,10 +3067,10 @@ inline bool CSCI441::ModelLoader::_loadPLYFile( const bool INFO, const bool ERRO
 			if( progressCounter % 5000 == 0 ) {
 				CSCI441::LogUtils::log("\33[2K\r");
 				switch( progressCounter ) {
-					case 5000:	CSCI441::LogUtils::log("[.ply]: parsing %s...\\", _filename.c_str());	break;
-					case 10000:	CSCI441::LogUtils::log("[.ply]: parsing %s...|", _filename.c_str());	break;
-					case 15000:	CSCI441::LogUtils::log("[.ply]: parsing %s.../", _filename.c_str());	break;
-					case 20000:	CSCI441::LogUtils::log("[.ply]: parsing %s...-", _filename.c_str());	break;
+					case 5000:	CSCI441::LogUtils::log("[.stl]: parsing %s...\\", _filename.c_str());	break;
+					case 10000:	CSCI441::LogUtils::log("[.stl]: parsing %s...|", _filename.c_str());	break;
+					case 15000:	CSCI441::LogUtils::log("[.stl]: parsing %s.../", _filename.c_str());	break;
+					case 20000:	CSCI441::LogUtils::log("[.stl]: parsing %s...-", _filename.c_str());	break;
                     default: break;
 				}
 				fflush(stdout);
@@ -1606,236 +3080,1672 @@ inline bool CSCI441::ModelLoader::_loadPLYFile( const bool INFO, const bool ERRO
 		}
 	}
 	in.close();
+	_hasVertexNormals = true;
+	_loadStats.parseMilliseconds += CSCI441_INTERNAL::millisecondsSince( parseStart );
 
-    _bufferData();
+	// facet normals keep the corners of neighboring triangles apart, weld them under generated smooth normals instead
+	if( _loadOptions.weldVertices && _loadOptions.autoGenNormals ) _hasVertexNormals = false;
+	_postProcessMesh( INFO, nullptr, 0 );
 
-	time(&end);
-	double seconds = difftime( end, start );
+	const double seconds = CSCI441_INTERNAL::millisecondsSince( start ) / 1000.0;
 
 	if (INFO) {
-		CSCI441::LogUtils::log("\33[2K\r" );
-		CSCI441::LogUtils::log("[.ply]: parsing %s...done!\n[.ply]: Time to complete: %.3fs\n", _filename.c_str(), seconds );
-		CSCI441::LogUtils::log("[.ply]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
+		CSCI441::LogUtils::log("\33[2K\r");
+		CSCI441::LogUtils::log("[.stl]: parsing %s...done!\n[.stl]: Time to complete: %.3fs\n", _filename.c_str(), seconds);
+		CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
 	}
 
 	return result;
 }
 
-inline bool CSCI441::ModelLoader::_loadSTLFile( const bool INFO, const bool ERRORS ) {
-	bool result = true;
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableAutoGenerateNormals( const GLfloat creaseAngle ) {
+    sAUTO_GEN_NORMALS = true;
+    sNORMAL_CREASE_ANGLE = glm::radians( glm::clamp( creaseAngle, 0.0f, 180.0f ) );
+}
 
-	if (INFO) CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=- BEGIN %s Info -=-=-=-=-=-=-=-\n", _filename.c_str() );
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableAutoGenerateNormals() {
+    sAUTO_GEN_NORMALS = false;
+}
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableAutoGenerateTangents() {
+    sAUTO_GEN_TANGENTS = true;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableAutoGenerateTangents() {
+    sAUTO_GEN_TANGENTS = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableVertexWelding( const GLfloat epsilon ) {
+    sWELD_VERTICES = true;
+    sWELD_EPSILON = std::max( epsilon, 0.0f );
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableVertexWelding() {
+    sWELD_VERTICES = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableInterleavedVertexLayout() {
+    sINTERLEAVE_VERTICES = true;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableInterleavedVertexLayout() {
+    sINTERLEAVE_VERTICES = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enablePackedVertexAttributes() {
+    sPACK_VERTEX_ATTRIBUTES = true;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disablePackedVertexAttributes() {
+    sPACK_VERTEX_ATTRIBUTES = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableQuantizedPositions() {
+    sQUANTIZE_POSITIONS = true;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableQuantizedPositions() {
+    sQUANTIZE_POSITIONS = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableOctahedralNormals() {
+    sOCTAHEDRAL_NORMALS = true;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableOctahedralNormals() {
+    sOCTAHEDRAL_NORMALS = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableNormalizedTexCoords() {
+    sUNORM16_TEX_COORDS = true;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableNormalizedTexCoords() {
+    sUNORM16_TEX_COORDS = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableVertexCacheOptimization() {
+    sOPTIMIZE_VERTEX_CACHE = true;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableVertexCacheOptimization() {
+    sOPTIMIZE_VERTEX_CACHE = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableOverdrawOptimization() {
+    sOPTIMIZE_OVERDRAW = true;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableOverdrawOptimization() {
+    sOPTIMIZE_OVERDRAW = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableMeshletGeneration( const GLuint maxVertices, const GLuint maxTriangles ) {
+    sBUILD_MESHLETS = true;
+    sMESHLET_MAX_VERTICES = std::max( maxVertices, 3u );
+    sMESHLET_MAX_TRIANGLES = std::max( maxTriangles, 1u );
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableMeshletGeneration() {
+    sBUILD_MESHLETS = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableLevelOfDetailGeneration( const GLuint numLevels, const GLfloat reductionPerLevel ) {
+    sBUILD_LEVELS_OF_DETAIL = true;
+    sNUM_LEVELS_OF_DETAIL = std::max( numLevels, 1u );
+    sLEVEL_OF_DETAIL_REDUCTION = glm::clamp( reductionPerLevel, 0.0f, 1.0f );
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableLevelOfDetailGeneration() {
+    sBUILD_LEVELS_OF_DETAIL = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableStreamingLoad( const size_t memoryBudgetBytes ) {
+    sSTREAM_LOAD = true;
+    sSTREAM_MEMORY_BUDGET = memoryBudgetBytes;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableStreamingLoad() {
+    sSTREAM_LOAD = false;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::enableGeometryArena( GeometryArena& arena ) {
+    sGEOMETRY_ARENA = &arena;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::disableGeometryArena() {
+    sGEOMETRY_ARENA = nullptr;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ModelLoader::clearTextureCache() {
+    auto& cache = CSCI441_INTERNAL::TextureCache::instance();
+    std::vector<GLuint> handles;
+    {
+        std::lock_guard<std::mutex> lock( cache.mutex() );
+        handles = cache.clear();
+    }
+    glDeleteTextures( static_cast<GLsizei>(handles.size()), handles.data() );
+}
+
+// Read in a *.c441mesh cache File
+//
+//      The cache is memory mapped and validated before anything is modified.
+//  The vertex and index blocks are uploaded to the GPU directly out of the
+//  mapping and copied into the attribute arrays, and textures named by the
+//  material table are loaded from their image files.
+inline bool CSCI441::ModelLoader::_loadCacheFile( const std::string& cacheFilename, const bool INFO, const bool ERRORS, const bool requireSameOptions ) {
+	if ( INFO ) CSCI441::LogUtils::log("[.c441mesh]: -=-=-=-=-=-=-=- BEGIN %s Info -=-=-=-=-=-=-=-\n", cacheFilename.c_str() );
+
+	const auto start = std::chrono::steady_clock::now();
+
+	CSCI441_INTERNAL::MappedFile cacheFile;
+	CSCI441_INTERNAL::MeshCacheHeader header{};
+	const char* errorMessage = nullptr;
+	if( !cacheFile.open( cacheFilename.c_str() ) ) {
+		errorMessage = "could not be opened";
+	} else if( cacheFile.size() < sizeof(header) ) {
+		errorMessage = "is too small to be a mesh cache";
+	} else {
+		memcpy( &header, cacheFile.data(), sizeof(header) );
+		const uint64_t vertexDataSize = (sizeof(glm::vec3)*2 + sizeof(glm::vec2) + sizeof(glm::vec4) * ((header.attributeFlags & CSCI441_INTERNAL::MeshCacheHeader::HAS_COLORS) ? 2 : 1)) * static_cast<uint64_t>(header.numVertices);
+		if( memcmp( header.magic, CSCI441_INTERNAL::MESH_CACHE_MAGIC, sizeof(header.magic) ) != 0
+			|| header.byteOrderMark != CSCI441_INTERNAL::MESH_CACHE_BYTE_ORDER_MARK ) {
+			errorMessage = "is not a mesh cache for this platform";
+		} else if( header.version != CSCI441_INTERNAL::MESH_CACHE_VERSION ) {
+			errorMessage = "was written by a different version";
+		} else if( header.fileSize != cacheFile.size()
+			|| header.vertexDataSize != vertexDataSize
+			|| header.vertexDataOffset < sizeof(header) || header.vertexDataOffset % CSCI441_INTERNAL::MESH_CACHE_ALIGNMENT != 0
+			|| header.indexDataOffset < header.vertexDataOffset + header.vertexDataSize
+			|| header.materialDataOffset < header.indexDataOffset + sizeof(GLuint) * static_cast<uint64_t>(header.numIndices)
+			|| header.materialDataOffset + header.materialDataSize > header.fileSize
+			|| header.modelType > static_cast<uint32_t>(CSCI441_INTERNAL::MODEL_TYPE::UNKNOWN) ) {
+			errorMessage = "is truncated or corrupt";
+		} else if( requireSameOptions && (header.loadOptions != _loadOptionFlags()
+			|| header.weldEpsilon != (_loadOptions.weldVertices ? _loadOptions.weldEpsilon : 0.0f)
+			|| header.normalCreaseAngle != (_loadOptions.autoGenNormals ? _loadOptions.normalCreaseAngle : 0.0f)) ) {
+			errorMessage = "was saved with different loader options";
+		} else if( requireSameOptions && (header.sourceFileSize != _sourceFileSize
+			|| header.sourceModificationTime != _sourceModificationTime) ) {
+			errorMessage = "was saved from a different revision of the model file";
+		}
+	}
+
+	_loadStats.scanMilliseconds += CSCI441_INTERNAL::millisecondsSince( start );
+	const auto parseStart = std::chrono::steady_clock::now();
+
+	// decode the material table before touching the model so a bad cache leaves it untouched
+	std::map< std::string, CSCI441_INTERNAL::ModelMaterial* > materials;
+	std::map< std::string, std::vector< std::pair< GLuint, GLuint > > > materialIndexStartStop;
+	std::vector< std::string > dependentFiles;
+	if( errorMessage == nullptr ) {
+		CSCI441_INTERNAL::BinaryCursor cursor{ cacheFile.data() + header.materialDataOffset, cacheFile.data() + header.materialDataOffset + header.materialDataSize };
+		for( uint32_t i = 0; i < header.numMaterials && errorMessage == nullptr; i++ ) {
+			std::string name;
+			CSCI441_INTERNAL::MeshCacheMaterial cachedMaterial{};
+			auto material = new CSCI441_INTERNAL::ModelMaterial();
+			if( cursor.readString( name ) && cursor.read( &cachedMaterial, sizeof(cachedMaterial) )
+				&& cursor.readString( material->map_KdFilename ) && cursor.readString( material->map_dFilename ) ) {
+				memcpy( &material->ambient[0], cachedMaterial.ambient, sizeof(cachedMaterial.ambient) );
+				memcpy( &material->diffuse[0], cachedMaterial.diffuse, sizeof(cachedMaterial.diffuse) );
+				memcpy( &material->specular[0], cachedMaterial.specular, sizeof(cachedMaterial.specular) );
+				memcpy( &material->emissive[0], cachedMaterial.emissive, sizeof(cachedMaterial.emissive) );
+				material->shininess = cachedMaterial.shininess;
+				if( !materials.emplace( name, material ).second ) delete material;
+			} else {
+				delete material;
+				errorMessage = "has a corrupt material table";
+			}
+		}
+		for( uint32_t i = 0; i < header.numMaterialRanges && errorMessage == nullptr; i++ ) {
+			std::string name;
+			uint32_t numRanges;
+			if( !cursor.readString( name ) || !cursor.read( &numRanges, sizeof(numRanges) ) ) {
+				errorMessage = "has corrupt material ranges";
+				break;
+			}
+			auto& indexStartStop = materialIndexStartStop[name];
+			for( uint32_t r = 0; r < numRanges; r++ ) {
+				uint32_t range[2];
+				if( !cursor.read( range, sizeof(range) ) || range[0] > range[1] || range[1] >= header.numIndices ) {
+					errorMessage = "has corrupt material ranges";
+					break;
+				}
+				indexStartStop.emplace_back( range[0], range[1] );
+			}
+		}
+		uint32_t numDependentFiles = 0;
+		if( errorMessage == nullptr && !cursor.read( &numDependentFiles, sizeof(numDependentFiles) ) ) {
+			errorMessage = "has a corrupt list of material libraries";
+		}
+		for( uint32_t i = 0; i < numDependentFiles && errorMessage == nullptr; i++ ) {
+			std::string dependentFile;
+			if( !cursor.readString( dependentFile ) ) {
+				errorMessage = "has a corrupt list of material libraries";
+				break;
+			}
+			dependentFiles.push_back( std::move(dependentFile) );
+		}
+
+		// a material library edited after the cache was saved makes the cache stale
+		int64_t cacheTime = 0, dependentTime = 0;
+		if( errorMessage == nullptr && requireSameOptions && CSCI441_INTERNAL::fileModificationTime( cacheFilename.c_str(), cacheTime ) ) {
+			for( const auto& dependentFile : dependentFiles ) {
+				if( CSCI441_INTERNAL::fileModificationTime( dependentFile.c_str(), dependentTime ) && dependentTime > cacheTime ) {
+					errorMessage = "is older than a material library the model uses";
+					break;
+				}
+			}
+		}
+	}
+
+	if( errorMessage != nullptr ) {
+		for( const auto& [name, material] : materials ) {
+			delete material;
+		}
+		// a stale or foreign cache found next to a model is quietly replaced by parsing the model
+		if (ERRORS && !requireSameOptions) CSCI441::LogUtils::logError("[.c441mesh]: [ERROR]: File \"%s\" %s\n", cacheFilename.c_str(), errorMessage );
+		if (INFO && requireSameOptions) CSCI441::LogUtils::log("[.c441mesh]: File \"%s\" %s, parsing the model file instead\n", cacheFilename.c_str(), errorMessage );
+		if ( INFO ) CSCI441::LogUtils::log("[.c441mesh]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", cacheFilename.c_str() );
+		return false;
+	}
+
+	const GLuint numVertices = header.numVertices;
+	const char* vertexData = cacheFile.data() + header.vertexDataOffset;
+	const auto indexData = reinterpret_cast<const GLuint*>( cacheFile.data() + header.indexDataOffset );
+
+	_allocateAttributeArrays( numVertices, header.numIndices );
+	memcpy( _vertices, vertexData, sizeof(glm::vec3) * numVertices );
+	memcpy( _normals, vertexData + sizeof(glm::vec3) * numVertices, sizeof(glm::vec3) * numVertices );
+	memcpy( _texCoords, vertexData + sizeof(glm::vec3) * numVertices * 2, sizeof(glm::vec2) * numVertices );
+	memcpy( _tangents, vertexData + (sizeof(glm::vec3) * 2 + sizeof(glm::vec2)) * numVertices, sizeof(glm::vec4) * numVertices );
+	if( header.attributeFlags & CSCI441_INTERNAL::MeshCacheHeader::HAS_COLORS ) {
+		_colors = new glm::vec4[numVertices];
+		memcpy( _colors, vertexData + (sizeof(glm::vec3) * 2 + sizeof(glm::vec2) + sizeof(glm::vec4)) * numVertices, sizeof(glm::vec4) * numVertices );
+	}
+	memcpy( _indices, indexData, sizeof(GLuint) * header.numIndices );
+
+	_uniqueIndex = numVertices;
+	_numIndices = header.numIndices;
+	_hasVertexNormals = (header.attributeFlags & CSCI441_INTERNAL::MeshCacheHeader::HAS_NORMALS) != 0;
+	_hasVertexTexCoords = (header.attributeFlags & CSCI441_INTERNAL::MeshCacheHeader::HAS_TEX_COORDS) != 0;
+	_modelType = static_cast<CSCI441_INTERNAL::MODEL_TYPE>(header.modelType);
+	_materials = std::move(materials);
+	_materialIndexStartStop = std::move(materialIndexStartStop);
+	_dependentFiles = std::move(dependentFiles);
+	_sourceFileSize = static_cast<size_t>(header.sourceFileSize);
+	_sourceModificationTime = header.sourceModificationTime;
+
+	_loadStats.parseMilliseconds += CSCI441_INTERNAL::millisecondsSince( parseStart );
+
+	_postProcessMesh( INFO, vertexData, static_cast<GLsizeiptr>(header.vertexDataSize) );
+
+	// textures are not cached, load them again from the images the materials name
+	std::string path;
+	if( cacheFilename.find('/') != std::string::npos ) {
+		path = cacheFilename.substr( 0, cacheFilename.find_last_of('/')+1 );
+	} else {
+		path = "./";
+	}
+	_decodeMaterialTextures( path, INFO, ERRORS );
+	if( !_deferUpload ) _uploadMaterialTextures();
+
+	_buildDrawList();
+
+	const double seconds = CSCI441_INTERNAL::millisecondsSince( start ) / 1000.0;
+
+	if (INFO) {
+		CSCI441::LogUtils::log("[.c441mesh]: ------------\n" );
+		CSCI441::LogUtils::log("[.c441mesh]: Model Stats:\n" );
+		CSCI441::LogUtils::log("[.c441mesh]: Vertices:  \t%u\tIndices:   \t%u\n", _uniqueIndex, _numIndices );
+		CSCI441::LogUtils::log("[.c441mesh]: Materials: \t%u\n", header.numMaterials );
+		CSCI441::LogUtils::log("[.c441mesh]: ------------\n" );
+		CSCI441::LogUtils::log("[.c441mesh]: Time to complete: %.3fs\n", seconds );
+		CSCI441::LogUtils::log("[.c441mesh]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", cacheFilename.c_str() );
+	}
+
+	return true;
+}
+
+//
+//  LoadOptions _snapshotLoadOptions()
+//
+//      Copies the current loader settings for a load about to start.
+//
+inline CSCI441_INTERNAL::LoadOptions CSCI441::ModelLoader::_snapshotLoadOptions() {
+	CSCI441_INTERNAL::LoadOptions options;
+	options.autoGenNormals = sAUTO_GEN_NORMALS;
+	options.normalCreaseAngle = sNORMAL_CREASE_ANGLE;
+	options.autoGenTangents = sAUTO_GEN_TANGENTS;
+	options.weldVertices = sWELD_VERTICES;
+	options.weldEpsilon = sWELD_EPSILON;
+	options.interleaveVertices = sINTERLEAVE_VERTICES;
+	options.packVertexAttributes = sPACK_VERTEX_ATTRIBUTES;
+	options.quantizePositions = sQUANTIZE_POSITIONS;
+	options.octahedralNormals = sOCTAHEDRAL_NORMALS;
+	options.unorm16TexCoords = sUNORM16_TEX_COORDS;
+	options.optimizeVertexCache = sOPTIMIZE_VERTEX_CACHE;
+	options.optimizeOverdraw = sOPTIMIZE_OVERDRAW;
+	options.buildMeshlets = sBUILD_MESHLETS;
+	options.meshletMaxVertices = sMESHLET_MAX_VERTICES;
+	options.meshletMaxTriangles = sMESHLET_MAX_TRIANGLES;
+	options.buildLevelsOfDetail = sBUILD_LEVELS_OF_DETAIL;
+	options.numLevelsOfDetail = sNUM_LEVELS_OF_DETAIL;
+	options.levelOfDetailReduction = sLEVEL_OF_DETAIL_REDUCTION;
+	options.streamLoad = sSTREAM_LOAD;
+	options.streamMemoryBudget = sSTREAM_MEMORY_BUDGET;
+	options.geometryArena = sGEOMETRY_ARENA;
+	return options;
+}
+
+inline uint32_t CSCI441::ModelLoader::_loadOptionFlags() const {
+	return (_loadOptions.autoGenNormals ? static_cast<uint32_t>(CSCI441_INTERNAL::MeshCacheHeader::AUTO_GEN_NORMALS) : 0u)
+		 | (_loadOptions.autoGenTangents ? static_cast<uint32_t>(CSCI441_INTERNAL::MeshCacheHeader::AUTO_GEN_TANGENTS) : 0u)
+		 | (_loadOptions.weldVertices ? static_cast<uint32_t>(CSCI441_INTERNAL::MeshCacheHeader::WELD_VERTICES) : 0u)
+		 | (_loadOptions.optimizeVertexCache ? static_cast<uint32_t>(CSCI441_INTERNAL::MeshCacheHeader::OPTIMIZE_VERTEX_CACHE) : 0u)
+		 | (_loadOptions.optimizeOverdraw ? static_cast<uint32_t>(CSCI441_INTERNAL::MeshCacheHeader::OPTIMIZE_OVERDRAW) : 0u);
+}
+
+//
+//  void _mergeMaterialRanges()
+//
+//      Gathers the triangles of every material into one contiguous range so
+//  each material is bound once no matter how often the file switched to it.
+//
+inline void CSCI441::ModelLoader::_mergeMaterialRanges() {
+	const CSCI441_INTERNAL::ScopedTimer timer( _loadStats.optimizationMilliseconds );
+	bool split = false;
+	for( const auto& [name, indexStartStop] : _materialIndexStartStop ) {
+		if( indexStartStop.size() > 1 ) split = true;
+	}
+	if( !split ) return;
+
+	std::vector<GLuint> merged;
+	merged.reserve( _numIndices );
+	std::map< std::string, std::vector< std::pair< GLuint, GLuint > > > materialIndexStartStop;
+	for( const auto& [name, indexStartStop] : _materialIndexStartStop ) {
+		const auto start = static_cast<GLuint>(merged.size());
+		for( const auto& [rangeStart, rangeStop] : indexStartStop ) {
+			if( rangeStop < rangeStart || rangeStop >= _numIndices ) continue;
+			merged.insert( merged.end(), _indices + rangeStart, _indices + rangeStop + 1 );
+		}
+		if( merged.size() > start ) {
+			materialIndexStartStop[name].emplace_back( start, static_cast<GLuint>(merged.size()) - 1 );
+		}
+	}
+	// ranges that do not cover the model exactly are left as they were read
+	if( merged.size() != _numIndices ) return;
+
+	std::copy( merged.begin(), merged.end(), _indices );
+	_materialIndexStartStop = std::move(materialIndexStartStop);
+}
+
+//
+//  void _buildDrawList()
+//
+//      Precomputes the counts and offsets of every material range and uploads
+//  the material of each range into a uniform buffer for drawBatched().
+//
+inline void CSCI441::ModelLoader::_buildDrawList() {
+	// an asynchronous load builds the list once its buffers are uploaded
+	if( _deferUpload ) return;
+
+	_drawCounts.clear();
+	_drawOffsets.clear();
+	_drawBaseVertices.clear();
+	_drawListGroups.clear();
+
+	// order materials by diffuse texture so drawBatched() binds each texture for one call
+	const CSCI441_INTERNAL::ModelMaterial defaultMaterial;
+	std::vector< std::pair< const CSCI441_INTERNAL::ModelMaterial*, const std::vector< std::pair< GLuint, GLuint > >* > > materialRanges;
+	for( const auto& [materialName, indexStartStop] : _materialIndexStartStop ) {
+		const auto materialIter = _materials.find( materialName );
+		materialRanges.emplace_back( materialIter != _materials.end() ? materialIter->second : &defaultMaterial, &indexStartStop );
+	}
+	std::stable_sort( materialRanges.begin(), materialRanges.end(), [](const auto& a, const auto& b) { return a.first->map_Kd < b.first->map_Kd; } );
+
+	std::vector<CSCI441_INTERNAL::MaterialRecord> records;
+	for( const auto& [material, indexStartStop] : materialRanges ) {
+		for( const auto& [start, end] : *indexStartStop ) {
+			if( end < start || end >= _numIndices ) continue;
+			if( _drawListGroups.empty() || _drawListGroups.back().texture != material->map_Kd ) {
+				CSCI441_INTERNAL::DrawListGroup group;
+				group.texture = material->map_Kd;
+				group.firstDraw = static_cast<GLsizei>(_drawCounts.size());
+				_drawListGroups.push_back( group );
+			}
+			_drawListGroups.back().numDraws++;
+			_drawCounts.push_back( static_cast<GLsizei>(end - start) + 1 );
+			_drawOffsets.push_back( _indexOffset(start) );
+			_drawBaseVertices.push_back( static_cast<GLint>(_arenaAllocation.baseVertex) );
+			records.push_back( { material->ambient, material->diffuse, material->specular, material->shininess, { 0.0f, 0.0f, 0.0f } } );
+		}
+	}
+	if( records.empty() ) return;
+
+	// records bound on their own or as the start of a group must begin on a uniform buffer offset boundary
+	GLint offsetAlignment = 0;
+	glGetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment );
+	const auto alignOffset = [offsetAlignment](const GLsizeiptr offset) {
+		return offsetAlignment > 0 ? (offset + offsetAlignment - 1) / offsetAlignment * offsetAlignment : offset;
+	};
+
+	// without gl_DrawID each record is bound on its own and is padded to the alignment
+	_materialRecordStride = static_cast<GLsizeiptr>(sizeof(CSCI441_INTERNAL::MaterialRecord));
+	if( !_supportsShaderDrawParameters() ) _materialRecordStride = alignOffset( _materialRecordStride );
+
+	// every record back to back first, as drawIndirect() indexes them by gl_DrawID across all draws.  gl_DrawID counts
+	// from zero in each of drawBatched()'s calls, so with packed records each later group gets an aligned copy of its own
+	auto bufferSize = _materialRecordStride * static_cast<GLsizeiptr>(records.size());
+	for( auto& group : _drawListGroups ) {
+		if( _materialRecordStride != static_cast<GLsizeiptr>(sizeof(CSCI441_INTERNAL::MaterialRecord)) || group.firstDraw == 0 ) {
+			group.recordOffset = _materialRecordStride * group.firstDraw;
+		} else {
+			group.recordOffset = alignOffset( bufferSize );
+			bufferSize = group.recordOffset + _materialRecordStride * group.numDraws;
+		}
+	}
+
+	std::vector<char> recordData( static_cast<size_t>(bufferSize) );
+	for( size_t i = 0; i < records.size(); i++ ) {
+		memcpy( recordData.data() + static_cast<size_t>(_materialRecordStride) * i, &records[i], sizeof(CSCI441_INTERNAL::MaterialRecord) );
+	}
+	for( auto& group : _drawListGroups ) {
+		const auto firstRecord = static_cast<size_t>(_materialRecordStride * group.firstDraw);
+		if( static_cast<size_t>(group.recordOffset) != firstRecord ) {
+			memcpy( recordData.data() + group.recordOffset, recordData.data() + firstRecord, static_cast<size_t>(_materialRecordStride * group.numDraws) );
+		}
+		group.recordSize = bufferSize - group.recordOffset;
+	}
+
+	if( _materialBufferd == 0 ) glGenBuffers( 1, &_materialBufferd );
+	glBindBuffer( GL_UNIFORM_BUFFER, _materialBufferd );
+	glBufferData( GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(recordData.size()), recordData.data(), GL_STATIC_DRAW );
+}
+
+//
+//  bool _supportsShaderDrawParameters()
+//
+//      True if the current context provides gl_DrawID to shaders, either as
+//  part of OpenGL 4.6 or through ARB_shader_draw_parameters.
+//
+inline bool CSCI441::ModelLoader::_supportsShaderDrawParameters() {
+	GLint major = 0, minor = 0, numExtensions = 0;
+	glGetIntegerv( GL_MAJOR_VERSION, &major );
+	glGetIntegerv( GL_MINOR_VERSION, &minor );
+	if( major > 4 || (major == 4 && minor >= 6) ) return true;
+
+	glGetIntegerv( GL_NUM_EXTENSIONS, &numExtensions );
+	for( GLint i = 0; i < numExtensions; i++ ) {
+		const auto extension = reinterpret_cast<const char*>( glGetStringi( GL_EXTENSIONS, static_cast<GLuint>(i) ) );
+		if( extension != nullptr && strcmp( extension, "GL_ARB_shader_draw_parameters" ) == 0 ) return true;
+	}
+	return false;
+}
+
+//
+//  void _forEachMaterialRange(visit)
+//
+//      Calls visit with the triangles of each material range, or of the whole
+//  model when it has no materials, renumbered over only the vertices the range
+//  uses.  Any reordering of the triangles is written back to the index array.
+//
+inline void CSCI441::ModelLoader::_forEachMaterialRange( const std::function<void(const std::string&, GLuint, GLuint*, GLuint, const glm::vec3*, GLuint)>& visit ) {
+	std::vector< std::pair< std::string, std::pair< GLuint, GLuint > > > ranges;
+	for( const auto& [name, indexStartStop] : _materialIndexStartStop ) {
+		for( const auto& startStop : indexStartStop ) {
+			ranges.emplace_back( name, startStop );
+		}
+	}
+	if( ranges.empty() && _numIndices > 0 ) ranges.emplace_back( "", std::make_pair( 0u, _numIndices - 1 ) );
+
+	constexpr GLuint UNUSED = 0xFFFFFFFF;
+	std::vector<GLuint> localIndex( _uniqueIndex, UNUSED );
+	std::vector<GLuint> globalIndex;
+	std::vector<glm::vec3> localPositions;
+	std::vector<GLuint> rangeIndices;
+	for( const auto& [name, startStop] : ranges ) {
+		const auto& [start, stop] = startStop;
+		const GLuint numRangeIndices = (stop - start + 1) / 3 * 3;
+		if( numRangeIndices == 0 ) continue;
+
+		globalIndex.clear();
+		localPositions.clear();
+		rangeIndices.resize( numRangeIndices );
+		for( GLuint i = 0; i < numRangeIndices; i++ ) {
+			const GLuint vertex = _indices[start + i];
+			if( localIndex[vertex] == UNUSED ) {
+				localIndex[vertex] = static_cast<GLuint>(globalIndex.size());
+				globalIndex.push_back( vertex );
+				localPositions.push_back( _vertices[vertex] );
+			}
+			rangeIndices[i] = localIndex[vertex];
+		}
+
+		visit( name, start, rangeIndices.data(), numRangeIndices, localPositions.data(), static_cast<GLuint>(globalIndex.size()) );
+
+		for( GLuint i = 0; i < numRangeIndices; i++ ) {
+			_indices[start + i] = globalIndex[ rangeIndices[i] ];
+		}
+		for( const GLuint vertex : globalIndex ) {
+			localIndex[vertex] = UNUSED;
+		}
+	}
+}
+
+//
+//  void _postProcessMesh(bool INFO, const char* cachedVertexData, GLsizeiptr cachedVertexDataSize)
+//
+//      Runs the steps every loader applies to the indexed mesh it read, in
+//  order: welding, normal and tangent generation, merging material ranges,
+//  optimization, meshlets, levels of detail, then buffering.  A mesh read
+//  from a cache passes its mapped vertex block, it was already welded, given
+//  its normals and tangents, and optimized before it was saved, so only the
+//  later steps run and the block is uploaded as is when the buffer uses the
+//  same layout.  Parsed meshes pass nullptr.
+//
+inline void CSCI441::ModelLoader::_postProcessMesh( const bool INFO, const char* cachedVertexData, const GLsizeiptr cachedVertexDataSize ) {
+	const bool isCachedMesh = cachedVertexData != nullptr;
+	if( !isCachedMesh ) {
+		if( _loadOptions.weldVertices ) _weldVertices( INFO );
+		if( !_hasVertexNormals && _loadOptions.autoGenNormals ) _generateNormals( INFO );
+		if( _loadOptions.autoGenTangents ) _generateTangents( INFO );
+
+		_mergeMaterialRanges();
+		if( _loadOptions.optimizeVertexCache || _loadOptions.optimizeOverdraw ) _optimizeMesh( INFO );
+	}
+	if( _loadOptions.buildMeshlets ) _buildMeshlets( INFO );
+	if( _loadOptions.buildLevelsOfDetail ) _buildLevelsOfDetail( INFO );
+
+	if( isCachedMesh && _loadOptions.geometryArena == nullptr && !_loadOptions.interleaveVertices && !_packsVertexAttributes() ) {
+		// the vertex block is laid out exactly as the vertex buffer, upload both blocks straight from the mapping
+		_allocateBuffer( GL_ARRAY_BUFFER, _vbods[0], cachedVertexDataSize, cachedVertexData );
+		_bufferIndices( _indices );
+		_useSeparateVertexLayout( _colors != nullptr );
+	} else {
+		_bufferData( INFO );
+	}
+}
+
+//
+//  void _optimizeMesh(bool INFO)
+//
+//      Reorders the triangles of each material range for post-transform cache
+//  reuse, optionally sorts clusters of triangles to reduce overdraw, then
+//  reorders the vertices into the order the triangles first use them.
+//
+inline void CSCI441::ModelLoader::_optimizeMesh( const bool INFO ) {
+	const CSCI441_INTERNAL::ScopedTimer timer( _loadStats.optimizationMilliseconds );
+	if( _numIndices < 3 || _uniqueIndex == 0 ) return;
+
+	const CSCI441_INTERNAL::VertexCacheStatistics before = CSCI441_INTERNAL::analyzeVertexCache( _indices, _numIndices, _uniqueIndex );
+
+	const bool optimizeOverdraw = _loadOptions.optimizeOverdraw;
+	_forEachMaterialRange( [optimizeOverdraw](const std::string&, GLuint, GLuint* rangeIndices, const GLuint numRangeIndices, const glm::vec3* positions, const GLuint numVertices) {
+		CSCI441_INTERNAL::optimizeVertexCache( rangeIndices, numRangeIndices, numVertices );
+		if( optimizeOverdraw ) CSCI441_INTERNAL::optimizeOverdraw( rangeIndices, numRangeIndices, positions, numVertices );
+	} );
+
+	// store vertices in the order they are fetched
+	const std::vector<GLuint> remap = CSCI441_INTERNAL::optimizeVertexFetch( _indices, _numIndices, _uniqueIndex );
+	const auto permute = [this, &remap](auto*& attribute) {
+		if( attribute == nullptr ) return;
+		auto* reordered = new std::remove_reference_t<decltype(*attribute)>[_uniqueIndex];
+		for( GLuint v = 0; v < _uniqueIndex; v++ ) {
+			reordered[ remap[v] ] = attribute[v];
+		}
+		delete[] attribute;
+		attribute = reordered;
+	};
+	permute( _vertices );
+	permute( _normals );
+	permute( _texCoords );
+	permute( _tangents );
+	permute( _colors );
+
+	if (INFO) {
+		const CSCI441_INTERNAL::VertexCacheStatistics after = CSCI441_INTERNAL::analyzeVertexCache( _indices, _numIndices, _uniqueIndex );
+		const std::string prefix = _logPrefix();
+		CSCI441::LogUtils::log("[%s]: ACMR:      \t%.3f -> %.3f\n", prefix.c_str(), before.acmr, after.acmr );
+		CSCI441::LogUtils::log("[%s]: ATVR:      \t%.3f -> %.3f\n", prefix.c_str(), before.atvr, after.atvr );
+	}
+}
+
+inline std::string CSCI441::ModelLoader::_logPrefix() const {
+	return _filename.find_last_of('.') != std::string::npos ? _filename.substr( _filename.find_last_of('.') ) : "";
+}
+
+//
+//  void _buildMeshlets(bool INFO)
+//
+//      Splits each material range into meshlets with bounds for culling.  The
+//  triangles of each meshlet are made contiguous within its material range.
+//
+inline void CSCI441::ModelLoader::_buildMeshlets( const bool INFO ) {
+	const CSCI441_INTERNAL::ScopedTimer timer( _loadStats.optimizationMilliseconds );
+	_meshlets.clear();
+	_materialMeshletStartStop.clear();
+
+	_forEachMaterialRange( [this](const std::string& materialName, const GLuint indexStart, GLuint* rangeIndices, const GLuint numRangeIndices, const glm::vec3* positions, const GLuint numVertices) {
+		const auto firstMeshlet = static_cast<GLuint>(_meshlets.size());
+		CSCI441_INTERNAL::buildMeshlets( rangeIndices, numRangeIndices, positions, numVertices, _loadOptions.meshletMaxVertices, _loadOptions.meshletMaxTriangles, indexStart, _meshlets );
+		if( _meshlets.size() > firstMeshlet ) {
+			_materialMeshletStartStop[materialName].emplace_back( firstMeshlet, static_cast<GLuint>(_meshlets.size()) - 1 );
+		}
+	} );
+
+	if (INFO && !_meshlets.empty()) {
+		size_t numVertices = 0, numIndices = 0;
+		for( const auto& meshlet : _meshlets ) {
+			numVertices += meshlet.numVertices;
+			numIndices += meshlet.numIndices;
+		}
+		const std::string prefix = _logPrefix();
+		CSCI441::LogUtils::log("[%s]: Meshlets:  \t%zu\tAverage:   \t%.1f vertices, %.1f triangles\n", prefix.c_str(), _meshlets.size(),
+							   static_cast<double>(numVertices) / static_cast<double>(_meshlets.size()),
+							   static_cast<double>(numIndices) / 3.0 / static_cast<double>(_meshlets.size()) );
+	}
+}
+
+//
+//  void _buildLevelsOfDetail(bool INFO)
+//
+//      Simplifies the model into successively coarser levels of detail.  The
+//  triangles of each level are grouped by material and appended after the
+//  full detail indices so every level draws from the same buffers.
+//
+inline void CSCI441::ModelLoader::_buildLevelsOfDetail( const bool INFO ) {
+	const CSCI441_INTERNAL::ScopedTimer timer( _loadStats.optimizationMilliseconds );
+	_lodIndices.clear();
+	_lodMaterialIndexStartStop.clear();
+	_lodErrors.assign( 1, 0.0f );
+	if( _numIndices < 3 || _uniqueIndex == 0 ) return;
+
+	glm::vec3 minimum = _vertices[0], maximum = _vertices[0];
+	for( GLuint v = 1; v < _uniqueIndex; v++ ) {
+		minimum = glm::min( minimum, _vertices[v] );
+		maximum = glm::max( maximum, _vertices[v] );
+	}
+	_boundingSphere = glm::vec4( (minimum + maximum) * 0.5f, glm::length( maximum - minimum ) * 0.5f );
+
+	// triangles of the same material share a group, positions between groups stay put
+	std::vector<std::string> materialNames;
+	std::vector<GLuint> triangleGroups( _numIndices / 3, 0 );
+	for( const auto& [name, indexStartStop] : _materialIndexStartStop ) {
+		for( const auto& [start, stop] : indexStartStop ) {
+			for( GLuint t = start / 3; t < (stop + 1) / 3 && t < triangleGroups.size(); t++ ) {
+				triangleGroups[t] = static_cast<GLuint>(materialNames.size());
+			}
+		}
+		materialNames.push_back( name );
+	}
+	if( materialNames.empty() ) materialNames.emplace_back( "" );
+
+	CSCI441_INTERNAL::MeshSimplifier simplifier( _vertices, _uniqueIndex, _indices, _numIndices, triangleGroups.data() );
+	auto targetTriangles = static_cast<double>(_numIndices / 3);
+	std::vector<GLuint> groupOffsets;
+	for( GLuint lodLevel = 1; lodLevel < _loadOptions.numLevelsOfDetail; lodLevel++ ) {
+		targetTriangles *= _loadOptions.levelOfDetailReduction;
+		const size_t previousTriangles = simplifier.triangleGroups().size();
+		simplifier.simplify( static_cast<size_t>(targetTriangles) );
+		const std::vector<GLuint>& levelIndices = simplifier.indices();
+		const std::vector<GLuint>& levelGroups = simplifier.triangleGroups();
+		if( levelGroups.empty() || levelGroups.size() == previousTriangles ) break;
+
+		// bucket the triangles by material
+		groupOffsets.assign( materialNames.size() + 1, 0 );
+		for( const GLuint group : levelGroups ) groupOffsets[group + 1] += 3;
+		for( size_t g = 0; g < materialNames.size(); g++ ) groupOffsets[g + 1] += groupOffsets[g];
+		const auto levelStart = static_cast<GLuint>(_lodIndices.size());
+		_lodIndices.resize( _lodIndices.size() + levelIndices.size() );
+		std::vector<GLuint> fill( groupOffsets.begin(), groupOffsets.end() - 1 );
+		for( size_t t = 0; t < levelGroups.size(); t++ ) {
+			std::copy( &levelIndices[t*3], &levelIndices[t*3] + 3, &_lodIndices[ levelStart + fill[ levelGroups[t] ] ] );
+			fill[ levelGroups[t] ] += 3;
+		}
+
+		std::map< std::string, std::vector< std::pair< GLuint, GLuint > > > levelIndexStartStop;
+		for( size_t g = 0; g < materialNames.size(); g++ ) {
+			if( groupOffsets[g + 1] == groupOffsets[g] ) continue;
+			const GLuint start = _numIndices + levelStart + groupOffsets[g];
+			levelIndexStartStop[ materialNames[g] ].emplace_back( start, start + (groupOffsets[g + 1] - groupOffsets[g]) - 1 );
+		}
+		_lodMaterialIndexStartStop.push_back( std::move(levelIndexStartStop) );
+		_lodErrors.push_back( simplifier.error() );
+
+		if (INFO) {
+			CSCI441::LogUtils::log("[%s]: LOD %u:     \t%zu triangles\tError:     \t%.3g\n", _logPrefix().c_str(), lodLevel, levelGroups.size(), simplifier.error() );
+		}
+	}
+}
+
+//
+//  void _generateNormals(INFO)
+//
+//      Replaces the normals of the indexed mesh with smooth, angle weighted
+//  normals shared by every vertex at the same position, except across faces
+//  meeting at more than the crease angle.  A vertex whose corners lie on both
+//  sides of a crease is copied so each side keeps its own normal, the
+//  attribute arrays are reallocated when any vertex is copied.
+//
+inline void CSCI441::ModelLoader::_generateNormals( const bool INFO ) {
+	const CSCI441_INTERNAL::ScopedTimer timer( _loadStats.normalGenerationMilliseconds );
+	if (INFO) CSCI441::LogUtils::log("[%s]: No vertex normals exist on model, vertex normals will be autogenerated\n", _logPrefix().c_str() );
+	std::vector<glm::vec3> cornerNormals;
+	CSCI441_INTERNAL::generateSmoothNormals( _vertices, _uniqueIndex, _indices, _numIndices, _loadOptions.normalCreaseAngle, cornerNormals );
+
+	// a vertex takes the normal of its first corner, corners with another normal move to a copy of it
+	constexpr GLuint NO_COPY = std::numeric_limits<GLuint>::max();
+	std::vector<bool> hasNormal( _uniqueIndex, false );
+	std::vector<GLuint> firstCopy( _uniqueIndex, NO_COPY );
+	std::vector<GLuint> copySources, nextCopy;
+	std::vector<glm::vec3> copyNormals;
+	for( GLuint i = 0; i < _numIndices; i++ ) {
+		const GLuint vertex = _indices[i];
+		const glm::vec3& normal = cornerNormals[i];
+		if( !hasNormal[vertex] ) {
+			_normals[vertex] = normal;
+			hasNormal[vertex] = true;
+			continue;
+		}
+		if( _normals[vertex] == normal ) continue;
+
+		GLuint copy = firstCopy[vertex];
+		while( copy != NO_COPY && copyNormals[copy] != normal ) copy = nextCopy[copy];
+		if( copy == NO_COPY ) {
+			copy = static_cast<GLuint>(copySources.size());
+			copySources.push_back( vertex );
+			copyNormals.push_back( normal );
+			nextCopy.push_back( firstCopy[vertex] );
+			firstCopy[vertex] = copy;
+		}
+		_indices[i] = _uniqueIndex + copy;
+	}
+	for( GLuint v = 0; v < _uniqueIndex; v++ ) {
+		if( !hasNormal[v] ) _normals[v] = glm::vec3( 0.0f );
+	}
+	if( copySources.empty() ) return;
+
+	// grow the attribute arrays to hold the copies
+	const GLuint numVertices = _uniqueIndex + static_cast<GLuint>(copySources.size());
+	auto* vertices  = new glm::vec3[numVertices];
+	auto* normals   = new glm::vec3[numVertices];
+	auto* tangents  = new glm::vec4[numVertices];
+	auto* texCoords = new glm::vec2[numVertices];
+	std::copy( _vertices, _vertices + _uniqueIndex, vertices );
+	std::copy( _normals, _normals + _uniqueIndex, normals );
+	std::copy( _tangents, _tangents + _uniqueIndex, tangents );
+	std::copy( _texCoords, _texCoords + _uniqueIndex, texCoords );
+	for( GLuint c = 0; c < copySources.size(); c++ ) {
+		vertices[_uniqueIndex + c] = _vertices[ copySources[c] ];
+		normals[_uniqueIndex + c] = copyNormals[c];
+		tangents[_uniqueIndex + c] = _tangents[ copySources[c] ];
+		texCoords[_uniqueIndex + c] = _texCoords[ copySources[c] ];
+	}
+	delete[] _vertices;  _vertices = vertices;
+	delete[] _normals;   _normals = normals;
+	delete[] _tangents;  _tangents = tangents;
+	delete[] _texCoords; _texCoords = texCoords;
+	if( _colors != nullptr ) {
+		auto* colors = new glm::vec4[numVertices];
+		std::copy( _colors, _colors + _uniqueIndex, colors );
+		for( GLuint c = 0; c < copySources.size(); c++ ) colors[_uniqueIndex + c] = _colors[ copySources[c] ];
+		delete[] _colors; _colors = colors;
+	}
+
+	if (INFO) CSCI441::LogUtils::log("[%s]: Crease Verts:\t%u -> %u\n", _logPrefix().c_str(), _uniqueIndex, numVertices );
+	_uniqueIndex = numVertices;
+}
+
+//
+//  void _generateTangents(INFO)
+//
+//      Replaces the tangents of the indexed mesh with tangents aligned to the
+//  texture coordinates, handedness stored in w.
+//
+inline void CSCI441::ModelLoader::_generateTangents( const bool INFO ) {
+	const CSCI441_INTERNAL::ScopedTimer timer( _loadStats.tangentGenerationMilliseconds );
+	if (INFO) CSCI441::LogUtils::log("[%s]: Vertex tangents will be autogenerated\n", _logPrefix().c_str() );
+	CSCI441_INTERNAL::generateTangents( _vertices, _normals, _texCoords, _uniqueIndex, _indices, _numIndices, _tangents );
+}
+
+//
+//  void _weldVertices(INFO)
+//
+//      Collapses vertices whose positions are within the weld epsilon and whose
+//  normal, texture coordinate, and color are identical into a single shared
+//  vertex and remaps the index array to match.  The attribute arrays are
+//  reallocated to the welded size, then redundant triangles are removed.
+//
+inline void CSCI441::ModelLoader::_weldVertices( const bool INFO ) {
+	{
+		const CSCI441_INTERNAL::ScopedTimer timer( _loadStats.dedupMilliseconds );
+		CSCI441_INTERNAL::VertexWeldTable weldTable( _uniqueIndex, _loadOptions.weldEpsilon );
+		std::vector<GLuint> remap( _uniqueIndex );
+
+		GLuint numWeldedVertices = 0;
+		for( GLuint i = 0; i < _uniqueIndex; i++ ) {
+			// attributes the model does not have are regenerated or ignored, so they never keep vertices apart
+			const glm::vec3 normal = _hasVertexNormals ? _normals[i] : glm::vec3(0.0f);
+			const glm::vec2 texCoord = _hasVertexTexCoords ? _texCoords[i] : glm::vec2(0.0f);
+			const glm::vec4 color = _colors != nullptr ? _colors[i] : glm::vec4(0.0f);
+			const auto [weldedIndex, isNewVertex] = weldTable.insert( _vertices[i], normal, texCoord, color, numWeldedVertices );
+			if( isNewVertex ) {
+				// welded vertices are never ahead of the vertex being read, so compact in place
+				_vertices[numWeldedVertices] = _vertices[i];
+				_normals[numWeldedVertices] = normal;
+				_tangents[numWeldedVertices] = _tangents[i];
+				_texCoords[numWeldedVertices] = texCoord;
+				if( _colors != nullptr ) _colors[numWeldedVertices] = color;
+				numWeldedVertices++;
+			}
+			remap[i] = weldedIndex;
+		}
+
+		for( GLuint i = 0; i < _numIndices; i++ ) {
+			_indices[i] = remap[ _indices[i] ];
+		}
+
+		if (INFO) CSCI441::LogUtils::log("[%s]: Welded Verts:\t%u -> %u\n", _logPrefix().c_str(), _uniqueIndex, numWeldedVertices );
+
+		// shrink the attribute arrays down to the welded size
+		auto* vertices  = new glm::vec3[numWeldedVertices];
+		auto* normals   = new glm::vec3[numWeldedVertices];
+		auto* tangents  = new glm::vec4[numWeldedVertices];
+		auto* texCoords = new glm::vec2[numWeldedVertices];
+		std::copy( _vertices, _vertices + numWeldedVertices, vertices );
+		std::copy( _normals, _normals + numWeldedVertices, normals );
+		std::copy( _tangents, _tangents + numWeldedVertices, tangents );
+		std::copy( _texCoords, _texCoords + numWeldedVertices, texCoords );
+		delete[] _vertices;  _vertices = vertices;
+		delete[] _normals;   _normals = normals;
+		delete[] _tangents;  _tangents = tangents;
+		delete[] _texCoords; _texCoords = texCoords;
+		if( _colors != nullptr ) {
+			auto* colors = new glm::vec4[numWeldedVertices];
+			std::copy( _colors, _colors + numWeldedVertices, colors );
+			delete[] _colors; _colors = colors;
+		}
+
+		_uniqueIndex = numWeldedVertices;
+	}
+
+	_removeRedundantTriangles( INFO );
+}
+
+//
+//  void _removeRedundantTriangles(INFO)
+//
+//      Removes triangles that repeat a vertex, have zero area, or repeat an
+//  earlier triangle with the same winding.  The index array is rebuilt at its
+//  new size and every material range is shifted to match.
+//
+inline void CSCI441::ModelLoader::_removeRedundantTriangles( const bool INFO ) {
+	const CSCI441_INTERNAL::ScopedTimer timer( _loadStats.dedupMilliseconds );
+	std::vector<bool> keep;
+	GLuint numDegenerate, numDuplicate;
+	CSCI441_INTERNAL::findRedundantTriangles( _indices, _numIndices, _vertices, keep, numDegenerate, numDuplicate );
+	if( numDegenerate == 0 && numDuplicate == 0 ) return;
+
+	// number of triangles kept before each triangle, material ranges are remapped through it
+	const size_t numTriangles = keep.size();
+	std::vector<GLuint> keptBefore( numTriangles + 1, 0 );
+	for( size_t t = 0; t < numTriangles; t++ ) {
+		keptBefore[t + 1] = keptBefore[t] + (keep[t] ? 1 : 0);
+	}
 
-	time_t start, end;
-	time(&start);
+	auto* indices = new GLuint[ keptBefore[numTriangles] * 3 ];
+	for( size_t t = 0; t < numTriangles; t++ ) {
+		if( keep[t] ) std::copy( _indices + 3*t, _indices + 3*t + 3, indices + 3 * static_cast<size_t>(keptBefore[t]) );
+	}
 
-	std::ifstream in( _filename );
-	if( !in.is_open() ) {
-		if (ERRORS) CSCI441::LogUtils::logError("[.stl]: [ERROR]: Could not open \"%s\"\n", _filename.c_str() );
-		if ( INFO ) CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
-		return false;
+	for( auto& [name, indexStartStop] : _materialIndexStartStop ) {
+		std::vector< std::pair< GLuint, GLuint > > shiftedRanges;
+		for( const auto& [start, stop] : indexStartStop ) {
+			if( stop < start || stop >= _numIndices ) continue;
+			const GLuint shiftedStart = keptBefore[start / 3] * 3;
+			const GLuint shiftedEnd = keptBefore[(stop + 1) / 3] * 3;
+			if( shiftedEnd > shiftedStart ) shiftedRanges.emplace_back( shiftedStart, shiftedEnd - 1 );
+		}
+		indexStartStop = std::move(shiftedRanges);
 	}
 
-	GLuint numVertices = 0, numNormals = 0, numFaces = 0, numTriangles = 0, numVertsInLoop = 0;
-	GLfloat minX = 999999.0f, maxX = -999999.0f, minY = 999999.0f, maxY = -999999.0f, minZ = 999999.0f, maxZ = -999999.0f;
-	std::string line;
+	if (INFO) CSCI441::LogUtils::log("[%s]: Removed Tris:\t%u degenerate, %u duplicate\n", _logPrefix().c_str(), numDegenerate, numDuplicate );
 
-	int progressCounter = 0;
-	glm::vec3 normalVector = {0.f,0.f,0.f};
+	delete[] _indices;
+	_indices = indices;
+	_numIndices = keptBefore[numTriangles] * 3;
+}
 
-	while( getline( in, line ) ) {
-		if( line.length() > 1 && line.at(0) == '\t' )
-			line = line.substr( 1 );
-		line.erase( line.find_last_not_of( " \n\r\t" ) + 1 );
+inline void CSCI441::ModelLoader::_allocateAttributeArrays(const GLuint numVertices, const GLuint numIndices) {
+    _vertices  = new glm::vec3[numVertices];
+    _normals   = new glm::vec3[numVertices];
+	_tangents  = new glm::vec4[numVertices];
+    _texCoords = new glm::vec2[numVertices];
+    _indices   = new GLuint[numIndices];
+}
 
-		std::vector< std::string > tokens = _tokenizeString( line, " \t" );
+inline void CSCI441::ModelLoader::_bufferData( const bool INFO ) {
+    if( _loadOptions.geometryArena != nullptr ) {
+        _geometryArena = _loadOptions.geometryArena;
+        if( _deferUpload ) _pendingArenaUpload = true;
+        else               _bufferArenaData();
+        return;
+    }
+
+    if( !_loadOptions.interleaveVertices && !_packsVertexAttributes() ) {
+        _allocateBuffer( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLsizeiptr>((sizeof(glm::vec3)*2 + sizeof(glm::vec2) + sizeof(glm::vec4) * (_colors != nullptr ? 2 : 1)) * _uniqueIndex), nullptr );
+        _bufferSubData( GL_ARRAY_BUFFER, _vbods[0], 0, static_cast<GLsizeiptr>(sizeof(glm::vec3) * _uniqueIndex), _vertices );
+        _bufferSubData( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLintptr>(sizeof(glm::vec3) * _uniqueIndex), static_cast<GLsizeiptr>(sizeof(glm::vec3) * _uniqueIndex), _normals );
+        _bufferSubData( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLintptr>(sizeof(glm::vec3) * _uniqueIndex * 2), static_cast<GLsizeiptr>(sizeof(glm::vec2) * _uniqueIndex), _texCoords );
+        _bufferSubData( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLintptr>(sizeof(glm::vec3) * _uniqueIndex * 2 + sizeof(glm::vec2) * _uniqueIndex), static_cast<GLsizeiptr>(sizeof(glm::vec4) * _uniqueIndex), _tangents );
+        if( _colors != nullptr ) {
+            _bufferSubData( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLintptr>(sizeof(glm::vec3) * _uniqueIndex * 2 + sizeof(glm::vec2) * _uniqueIndex + sizeof(glm::vec4) * _uniqueIndex), static_cast<GLsizeiptr>(sizeof(glm::vec4) * _uniqueIndex), _colors );
+        }
+        _useSeparateVertexLayout( _colors != nullptr );
+    } else {
+        _bufferInterleavedData( INFO );
+    }
+
+    _bufferIndices( _indices );
+}
 
-		if( tokens.empty() ) continue;
+//
+//  void _allocateBuffer(GLenum target, GLuint buffer, GLsizeiptr size, const void* data)
+//
+//      Creates the storage of a buffer, filled with data when it is not null.
+//  During an asynchronous load the data is copied and uploaded later.
+//
+inline void CSCI441::ModelLoader::_allocateBuffer( const GLenum target, const GLuint buffer, const GLsizeiptr size, const void* data ) {
+    if( _deferUpload ) {
+        CSCI441_INTERNAL::PendingBufferUpload upload;
+        upload.target = target;
+        upload.buffer = buffer;
+        upload.allocationSize = size;
+        if( data != nullptr ) upload.data.assign( static_cast<const char*>(data), static_cast<const char*>(data) + size );
+        _pendingBufferUploads.push_back( std::move(upload) );
+        return;
+    }
+    const CSCI441_INTERNAL::ScopedTimer uploadTimer( _loadStats.gpuUploadMilliseconds );
+    glBindVertexArray( _vaod );
+    glBindBuffer( target, buffer );
+    glBufferData( target, size, data, GL_STATIC_DRAW );
+}
 
-		if( tokens[0] == "solid" ) {
+//
+//  void _bufferSubData(GLenum target, GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data)
+//
+//      Copies data into part of a buffer.  During an asynchronous load the data
+//  is copied and uploaded later.
+//
+inline void CSCI441::ModelLoader::_bufferSubData( const GLenum target, const GLuint buffer, const GLintptr offset, const GLsizeiptr size, const void* data ) {
+    if( size <= 0 ) return;
+    if( _deferUpload ) {
+        CSCI441_INTERNAL::PendingBufferUpload upload;
+        upload.target = target;
+        upload.buffer = buffer;
+        upload.offset = offset;
+        upload.allocated = true;
+        upload.data.assign( static_cast<const char*>(data), static_cast<const char*>(data) + size );
+        _pendingBufferUploads.push_back( std::move(upload) );
+        return;
+    }
+    const CSCI441_INTERNAL::ScopedTimer uploadTimer( _loadStats.gpuUploadMilliseconds );
+    glBindVertexArray( _vaod );
+    glBindBuffer( target, buffer );
+    glBufferSubData( target, offset, size, data );
+}
 
-		} else if( tokens[0] == "facet" ) {
-			// read in x y z triangle normal
-			numNormals++;
-		} else if( tokens[0] == "outer" && tokens[1] == "loop" ) {
-			// begin a primitive
-			numVertsInLoop = 0;
-		} else if( tokens[0] == "vertex" ) {
-			GLfloat x = strtof( tokens[1].c_str(), nullptr ),
-					y = strtof( tokens[2].c_str(), nullptr ),
-					z = strtof( tokens[3].c_str(), nullptr );
+//
+//  bool _continueBufferUpload(PendingBufferUpload& upload, time_point deadline)
+//
+//      Copies a queued upload into its buffer one chunk at a time until it is
+//  complete or the deadline passes.  Chunks are written through unsynchronized
+//  mappings since the buffer is not drawn from until the load completes.
+//
+inline bool CSCI441::ModelLoader::_continueBufferUpload( CSCI441_INTERNAL::PendingBufferUpload& upload, const std::chrono::steady_clock::time_point deadline ) {
+    glBindBuffer( upload.target, upload.buffer );
+    if( !upload.allocated ) {
+        glBufferData( upload.target, upload.allocationSize, nullptr, GL_STATIC_DRAW );
+        upload.allocated = true;
+    }
+    while( upload.bytesUploaded < upload.data.size() ) {
+        const size_t chunkSize = std::min( CSCI441_INTERNAL::ASYNC_UPLOAD_CHUNK_SIZE, upload.data.size() - upload.bytesUploaded );
+        const auto offset = static_cast<GLintptr>(upload.offset + upload.bytesUploaded);
+        void* mapping = glMapBufferRange( upload.target, offset, static_cast<GLsizeiptr>(chunkSize), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT );
+        if( mapping != nullptr ) {
+            memcpy( mapping, upload.data.data() + upload.bytesUploaded, chunkSize );
+            glUnmapBuffer( upload.target );
+        } else {
+            glBufferSubData( upload.target, offset, static_cast<GLsizeiptr>(chunkSize), upload.data.data() + upload.bytesUploaded );
+        }
+        upload.bytesUploaded += chunkSize;
+        if( upload.bytesUploaded < upload.data.size() && std::chrono::steady_clock::now() >= deadline ) return false;
+    }
+    upload.data = std::vector<char>();
+    return true;
+}
 
-			if( x < minX ) minX = x;
-			if( x > maxX ) maxX = x;
-			if( y < minY ) minY = y;
-			if( y > maxY ) maxY = y;
-			if( z < minZ ) minZ = z;
-			if( z > maxZ ) maxZ = z;
+//
+//  void _decodeMaterialTextures(const std::string& path, bool INFO, bool ERRORS)
+//
+//      Looks up the diffuse map of every material, combined with its alpha map,
+//  in the process-wide texture cache by the contents of the image files.
+//  Images not yet cached are decoded on the texture decode pool while loading
+//  continues, each one only once no matter how many models name it.
+//
+inline void CSCI441::ModelLoader::_decodeMaterialTextures( const std::string& path, const bool INFO, const bool ERRORS ) {
+	_pendingTextures.clear();
+	const std::string prefix = _logPrefix();
+	auto& cache = CSCI441_INTERNAL::TextureCache::instance();
+	GLuint numShared = 0;
 
-			numVertices++;
-			numVertsInLoop++;
-		} else if( tokens[0] == "endloop" ) {
-			// end primitive
-			numTriangles += numVertsInLoop - 3 + 1;
-		} else if( tokens[0] == "endfacet" ) {
-			numFaces++;
-		} else if( tokens[0] == "endsolid" ) {
+	std::map< std::string, size_t > textureIndices;
+	for( const auto& [name, material] : _materials ) {
+		if( material->map_KdFilename.empty() ) continue;
 
+		const std::string imageKey = material->map_KdFilename + '\n' + material->map_dFilename;
+		if( textureIndices.find( imageKey ) != textureIndices.end() ) {
+			_pendingTextures[ textureIndices.find( imageKey )->second ].materials.push_back( material );
+			continue;
 		}
-		else {
-			if( memchr( line.c_str(), '\0', line.length() ) != nullptr ) {
-				if (ERRORS) CSCI441::LogUtils::logError("[.stl]: [ERROR]: Cannot read binary STL file \"%s\"\n", _filename.c_str() );
-				if ( INFO ) CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
-				in.close();
-				return false;
-			} else if (INFO) CSCI441::LogUtils::log("[.stl]: unknown line: %s\n", line.c_str() );
+
+		auto textureFile = std::make_shared<CSCI441_INTERNAL::MappedFile>();
+		if( !textureFile->open( material->map_KdFilename.c_str() ) && !textureFile->open( (path + material->map_KdFilename).c_str() ) ) {
+			if (ERRORS) CSCI441::LogUtils::logError("[%s]: [ERROR]: File Not Found: %s\n", prefix.c_str(), material->map_KdFilename.c_str() );
+			continue;
+		}
+		std::shared_ptr<CSCI441_INTERNAL::MappedFile> maskFile;
+		if( !material->map_dFilename.empty() ) {
+			maskFile = std::make_shared<CSCI441_INTERNAL::MappedFile>();
+			if( !maskFile->open( material->map_dFilename.c_str() ) && !maskFile->open( (path + material->map_dFilename).c_str() ) ) {
+				if (ERRORS) CSCI441::LogUtils::logError("[%s]: [ERROR]: File Not Found: %s\n", prefix.c_str(), material->map_dFilename.c_str() );
+				maskFile.reset();
+			}
 		}
 
-		if (INFO) {
-			progressCounter++;
-			if( progressCounter % 5000 == 0 ) {
-				CSCI441::LogUtils::log("\33[2K\r");
-				switch( progressCounter ) {
-					case 5000:	CSCI441::LogUtils::log("[.stl]: scanning %s...\\", _filename.c_str());	break;
-					case 10000:	CSCI441::LogUtils::log("[.stl]: scanning %s...|", _filename.c_str());	break;
-					case 15000:	CSCI441::LogUtils::log("[.stl]: scanning %s.../", _filename.c_str());	break;
-					case 20000:	CSCI441::LogUtils::log("[.stl]: scanning %s...-", _filename.c_str());	break;
-                    default: break;
-				}
-				fflush(stdout);
+		_loadStats.bytesRead += textureFile->size() + (maskFile ? maskFile->size() : 0);
+		CSCI441_INTERNAL::TextureCacheKey contentKey;
+		contentKey.imageSize = textureFile->size();
+		contentKey.maskSize = maskFile ? maskFile->size() : 0;
+		contentKey.hash = CSCI441_INTERNAL::hashBytes( textureFile->data(), textureFile->size() );
+		if( maskFile ) contentKey.hash = CSCI441_INTERNAL::hashBytes( maskFile->data(), maskFile->size(), contentKey.hash ^ 0x9e3779b97f4a7c15ull );
+
+		CSCI441_INTERNAL::PendingTexture texture;
+		texture.materials.push_back( material );
+		{
+			std::lock_guard<std::mutex> lock( cache.mutex() );
+			std::tie( texture.entry, texture.isNewImage ) = cache.findOrInsert( contentKey, textureFile->data(), maskFile ? maskFile->data() : nullptr );
+			if( texture.isNewImage ) {
+				auto decode = std::make_shared< std::packaged_task< std::shared_ptr<const CSCI441_INTERNAL::DecodedImage>() > >(
+					[textureFile, maskFile, prefix, filename = material->map_KdFilename, ERRORS]() {
+						auto image = _decodeTextureImage( *textureFile, maskFile.get() );
+						if( !image && ERRORS ) CSCI441::LogUtils::logError("[%s]: [ERROR]: Could not decode image: %s\n", prefix.c_str(), filename.c_str() );
+						return image;
+					} );
+				texture.entry->image = decode->get_future().share();
+				CSCI441_INTERNAL::ThreadPool::textureDecodePool().submit( [decode]() { (*decode)(); } );
+			} else {
+				numShared++;
 			}
-			if( progressCounter == 20000 )
-				progressCounter = 0;
 		}
-	}
-	in.close();
 
-	if (INFO) {
-		CSCI441::LogUtils::log("\33[2K\r" );
-		CSCI441::LogUtils::log("[.stl]: scanning %s...done!\n", _filename.c_str() );
-		CSCI441::LogUtils::log("[.stl]: ------------\n" );
-		CSCI441::LogUtils::log("[.stl]: Model Stats:\n" );
-		CSCI441::LogUtils::log("[.stl]: Vertices:  \t%u\tNormals:   \t%u\tTex Coords:\t%u\n", numVertices, numNormals, 0 );
-		CSCI441::LogUtils::log("[.stl]: Faces:     \t%u\tTriangles: \t%u\n", numFaces, numTriangles );
-		CSCI441::LogUtils::log("[.stl]: Dimensions:\t(%f, %f, %f)\n", (maxX - minX), (maxY - minY), (maxZ - minZ) );
+		textureIndices.insert( std::pair<std::string, size_t>( imageKey, _pendingTextures.size() ) );
+		_pendingTextures.push_back( std::move(texture) );
 	}
 
-    _allocateAttributeArrays(numVertices, numTriangles*3);
-
-	if (INFO) CSCI441::LogUtils::log("[.stl]: ------------\n" );
+	if (INFO && !_pendingTextures.empty()) {
+		CSCI441::LogUtils::log("[%s]: Textures:  \t%zu\t(%u already cached)\n", prefix.c_str(), _pendingTextures.size(), numShared );
+	}
+}
 
-	in.open( _filename );
+//
+//  std::shared_ptr<const DecodedImage> _decodeTextureImage(const MappedFile& textureFile, const MappedFile* maskFile)
+//
+//      Decodes an image, replacing its alpha channel with the mask when one is
+//  given.  Returns nullptr if the image cannot be decoded.  Safe to call
+//  concurrently.
+//
+inline std::shared_ptr<const CSCI441_INTERNAL::DecodedImage> CSCI441::ModelLoader::_decodeTextureImage( const CSCI441_INTERNAL::MappedFile& textureFile, const CSCI441_INTERNAL::MappedFile* maskFile ) {
+	const auto start = std::chrono::steady_clock::now();
+	int texWidth, texHeight, fileChannels = 1, maskWidth, maskHeight, maskChannels = 1;
+	// grey images are expanded to RGB and grey with alpha to RGBA so the pixels always match the upload format
+	if( !stbi_info_from_memory( reinterpret_cast<const stbi_uc*>(textureFile.data()), static_cast<int>(textureFile.size()), &texWidth, &texHeight, &fileChannels ) ) return nullptr;
+	const int textureChannels = (fileChannels == 2 || fileChannels == 4) ? 4 : 3;
+	unsigned char* textureData = stbi_load_from_memory( reinterpret_cast<const stbi_uc*>(textureFile.data()), static_cast<int>(textureFile.size()), &texWidth, &texHeight, &fileChannels, textureChannels );
+	if( !textureData ) return nullptr;
+	// stb_image's flip setting is global and TextureUtils may change it while this runs on
+	// a pool thread, so the rows are flipped here instead
+	CSCI441_INTERNAL::flipImageY( texWidth, texHeight, textureChannels, textureData );
+
+	unsigned char* maskData = nullptr;
+	if( maskFile != nullptr ) {
+		maskData = stbi_load_from_memory( reinterpret_cast<const stbi_uc*>(maskFile->data()), static_cast<int>(maskFile->size()), &maskWidth, &maskHeight, &maskChannels, 0 );
+		if( maskData != nullptr ) CSCI441_INTERNAL::flipImageY( maskWidth, maskHeight, maskChannels, maskData );
+	}
 
-	_uniqueIndex = 0;
-	_numIndices = 0;
+	auto image = std::make_shared<CSCI441_INTERNAL::DecodedImage>();
+	image->width = texWidth;
+	image->height = texHeight;
+	if( maskData != nullptr ) {
+		unsigned char* fullData = CSCI441_INTERNAL::createTransparentTexture( textureData, maskData, texWidth, texHeight, textureChannels, maskChannels );
+		image->format = GL_RGBA;
+		image->pixels.assign( fullData, fullData + static_cast<size_t>(texWidth) * texHeight * 4 );
+		delete[] fullData;
+		stbi_image_free( maskData );
+	} else {
+		image->format = (textureChannels == 4 ? GL_RGBA : GL_RGB);
+		image->pixels.assign( textureData, textureData + static_cast<size_t>(texWidth) * texHeight * textureChannels );
+	}
+	stbi_image_free( textureData );
+	image->decodeMilliseconds = CSCI441_INTERNAL::millisecondsSince( start );
+	return image;
+}
 
-	while( getline( in, line ) ) {
-		if( line.length() > 1 && line.at(0) == '\t' )
-			line = line.substr( 1 );
-		line.erase( line.find_last_not_of( " \n\r\t" ) + 1 );
+//
+//  bool _isMaterialTextureDecoded(const PendingTexture& texture)
+//
+//      Returns true once uploading the texture will not wait on the decode pool.
+//
+inline bool CSCI441::ModelLoader::_isMaterialTextureDecoded( const CSCI441_INTERNAL::PendingTexture& texture ) {
+	std::lock_guard<std::mutex> lock( CSCI441_INTERNAL::TextureCache::instance().mutex() );
+	return texture.entry->handle != 0
+		|| !texture.entry->image.valid()
+		|| texture.entry->image.wait_for( std::chrono::seconds(0) ) == std::future_status::ready;
+}
 
-		std::vector< std::string > tokens = _tokenizeString( line, " \t" );
+//
+//  void _uploadMaterialTexture(const PendingTexture& texture)
+//
+//      Assigns a cached texture to the materials that use it, creating the
+//  texture from its decoded image if no model has uploaded it yet.  Waits for
+//  the image to finish decoding.  The decode is counted against the model
+//  that queued it.
+//
+inline void CSCI441::ModelLoader::_uploadMaterialTexture( const CSCI441_INTERNAL::PendingTexture& texture ) {
+	auto& cache = CSCI441_INTERNAL::TextureCache::instance();
+	std::unique_lock<std::mutex> lock( cache.mutex() );
+	auto& entry = *texture.entry;
+	if( entry.handle == 0 && entry.image.valid() ) {
+		// other loads may use the cache while this image finishes decoding
+		const auto pendingImage = entry.image;
+		lock.unlock();
+		std::shared_ptr<const CSCI441_INTERNAL::DecodedImage> image;
+		try {
+			image = pendingImage.get();
+		} catch( const std::future_error& ) {
+			// the decode pool shut down before the image was decoded
+		}
+		lock.lock();
 
-		if( tokens.empty() ) continue;
+		if( entry.handle == 0 && image ) {
+			if( texture.isNewImage ) _loadStats.textureDecodeMilliseconds += image->decodeMilliseconds;
+			const CSCI441_INTERNAL::ScopedTimer uploadTimer( _loadStats.gpuUploadMilliseconds );
+			glGenTextures( 1, &entry.handle );
+			glBindTexture( GL_TEXTURE_2D, entry.handle );
 
-		if( tokens[0] == "solid" ) {
+			glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-		} else if( tokens[0] == "facet" ) {
-			// read in x y z triangle normal
-			normalVector = glm::vec3( strtof( tokens[2].c_str(), nullptr ),
-                                      strtof( tokens[3].c_str(), nullptr ),
-                                      strtof( tokens[4].c_str(), nullptr ) );
-		} else if( tokens[0] == "outer" && tokens[1] == "loop" ) {
-			// begin a primitive
-		} else if( tokens[0] == "vertex" ) {
-			_vertices[ _uniqueIndex ] = glm::vec3(strtof( tokens[1].c_str(), nullptr ),
-                                                  strtof( tokens[2].c_str(), nullptr ),
-                                                  strtof( tokens[3].c_str(), nullptr ) );
-			_normals[ _uniqueIndex ] = normalVector;
-			_indices[ _numIndices++ ] = _uniqueIndex++;
-		} else if( tokens[0] == "endloop" ) {
-			// end primitive
-		} else if( tokens[0] == "endfacet" ) {
+			glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+			glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-		} else if( tokens[0] == "endsolid" ) {
+			// decoded rows are tightly packed, RGB rows need not be a multiple of 4 bytes
+			GLint previousUnpackAlignment = 4;
+			glGetIntegerv( GL_UNPACK_ALIGNMENT, &previousUnpackAlignment );
+			glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+			glTexImage2D( GL_TEXTURE_2D, 0, image->format, image->width, image->height, 0, image->format, GL_UNSIGNED_BYTE, image->pixels.data() );
+			glPixelStorei( GL_UNPACK_ALIGNMENT, previousUnpackAlignment );
 
+			// the pixels are no longer needed once they are on the GPU
+			entry.image = std::shared_future< std::shared_ptr<const CSCI441_INTERNAL::DecodedImage> >();
 		}
-		else {
+	}
 
+	if( entry.handle != 0 ) {
+		for( const auto material : texture.materials ) {
+			material->map_Kd = entry.handle;
 		}
+	}
+}
 
-		if (INFO) {
-			progressCounter++;
-			if( progressCounter % 5000 == 0 ) {
-				CSCI441::LogUtils::log("\33[2K\r");
-				switch( progressCounter ) {
-					case 5000:	CSCI441::LogUtils::log("[.stl]: parsing %s...\\", _filename.c_str());	break;
-					case 10000:	CSCI441::LogUtils::log("[.stl]: parsing %s...|", _filename.c_str());	break;
-					case 15000:	CSCI441::LogUtils::log("[.stl]: parsing %s.../", _filename.c_str());	break;
-					case 20000:	CSCI441::LogUtils::log("[.stl]: parsing %s...-", _filename.c_str());	break;
-                    default: break;
-				}
-				fflush(stdout);
-			}
-			if( progressCounter == 20000 )
-				progressCounter = 0;
-		}
+//
+//  void _uploadMaterialTextures()
+//
+//      Uploads every texture the model is waiting on.
+//
+inline void CSCI441::ModelLoader::_uploadMaterialTextures() {
+	for( const auto& texture : _pendingTextures ) {
+		_uploadMaterialTexture( texture );
 	}
-	in.close();
+	_pendingTextures.clear();
+}
 
-	_bufferData();
+//
+//  void _bufferIndices(const GLuint* indices)
+//
+//      Uploads the index array with the narrowest type that can address every
+//  vertex of the model.  The CPU side index array always remains GLuint.
+//
+inline void CSCI441::ModelLoader::_bufferIndices( const GLuint* indices ) {
+    // levels of detail follow the full detail indices
+    const size_t numIndices = _numIndices + _lodIndices.size();
+    if( _uniqueIndex <= 65536 ) {
+        _indexType = GL_UNSIGNED_SHORT;
+        std::vector<GLushort> shortIndices( indices, indices + _numIndices );
+        shortIndices.insert( shortIndices.end(), _lodIndices.begin(), _lodIndices.end() );
+        _allocateBuffer( GL_ELEMENT_ARRAY_BUFFER, _vbods[1], static_cast<GLsizeiptr>(sizeof(GLushort) * numIndices), shortIndices.data() );
+    } else {
+        _indexType = GL_UNSIGNED_INT;
+        _allocateBuffer( GL_ELEMENT_ARRAY_BUFFER, _vbods[1], static_cast<GLsizeiptr>(sizeof(GLuint) * numIndices), nullptr );
+        _bufferSubData( GL_ELEMENT_ARRAY_BUFFER, _vbods[1], 0, static_cast<GLsizeiptr>(sizeof(GLuint) * _numIndices), indices );
+        _bufferSubData( GL_ELEMENT_ARRAY_BUFFER, _vbods[1], static_cast<GLintptr>(sizeof(GLuint) * _numIndices), static_cast<GLsizeiptr>(sizeof(GLuint) * _lodIndices.size()), _lodIndices.data() );
+    }
+}
 
-	time(&end);
-	double seconds = difftime( end, start );
+inline bool CSCI441::ModelLoader::_packsVertexAttributes() const {
+    return _loadOptions.packVertexAttributes || _loadOptions.quantizePositions || _loadOptions.octahedralNormals || _loadOptions.unorm16TexCoords;
+}
 
-	if (INFO) {
-		CSCI441::LogUtils::log("\33[2K\r");
-		CSCI441::LogUtils::log("[.stl]: parsing %s...done!\n[.stl]: Time to complete: %.3fs\n", _filename.c_str(), seconds);
-		CSCI441::LogUtils::log("[.stl]: -=-=-=-=-=-=-=-  END %s Info  -=-=-=-=-=-=-=-\n\n", _filename.c_str() );
-	}
+inline void CSCI441::ModelLoader::_useSeparateVertexLayout( const bool hasColors ) {
+    _positionDequantization = glm::mat4( 1.0f );
+    const GLintptr blockSize = static_cast<GLintptr>(_uniqueIndex);
+    _vertexLayout = CSCI441_INTERNAL::VertexLayout();
+    _vertexLayout.position = { 3, GL_FLOAT, GL_FALSE, 0, 0 };
+    _vertexLayout.normal   = { 3, GL_FLOAT, GL_FALSE, 0, static_cast<GLintptr>(sizeof(glm::vec3)) * blockSize };
+    _vertexLayout.texCoord = { 2, GL_FLOAT, GL_FALSE, 0, static_cast<GLintptr>(sizeof(glm::vec3) * 2) * blockSize };
+    _vertexLayout.tangent  = { 4, GL_FLOAT, GL_FALSE, 0, static_cast<GLintptr>(sizeof(glm::vec3) * 2 + sizeof(glm::vec2)) * blockSize };
+    if( hasColors ) {
+        _vertexLayout.color = { 4, GL_FLOAT, GL_FALSE, 0, static_cast<GLintptr>(sizeof(glm::vec3) * 2 + sizeof(glm::vec2) + sizeof(glm::vec4)) * blockSize };
+    }
+}
 
-	return result;
+//
+//  void _bufferArenaData()
+//
+//      Copies the model into a range of the geometry arena, interleaving its
+//  attributes into the arena's vertex format.  Levels of detail follow the
+//  full detail indices as they do in the model's own index buffer.
+//
+inline void CSCI441::ModelLoader::_bufferArenaData() {
+    const CSCI441_INTERNAL::ScopedTimer uploadTimer( _loadStats.gpuUploadMilliseconds );
+    const size_t numIndices = _numIndices + _lodIndices.size();
+    _arenaAllocation = _geometryArena->allocate( _uniqueIndex, static_cast<GLuint>(numIndices) );
+
+    std::vector<GeometryArena::Vertex> vertices( _uniqueIndex );
+    for( GLuint v = 0; v < _uniqueIndex; v++ ) {
+        // a model without colors reads the value a disabled color attribute would have
+        vertices[v] = { _vertices[v], _normals[v], _texCoords[v], _tangents[v], _colors != nullptr ? _colors[v] : glm::vec4( 0.0f, 0.0f, 0.0f, 1.0f ) };
+    }
+    std::vector<GLuint> indices( _indices, _indices + _numIndices );
+    indices.insert( indices.end(), _lodIndices.begin(), _lodIndices.end() );
+    _geometryArena->upload( _arenaAllocation, vertices.data(), indices.data() );
+
+    _indexType = GL_UNSIGNED_INT;
+    _positionDequantization = glm::mat4( 1.0f );
+    _vertexLayout = CSCI441_INTERNAL::VertexLayout();
+    const auto stride = static_cast<GLsizei>(sizeof(GeometryArena::Vertex));
+    _vertexLayout.position = { 3, GL_FLOAT, GL_FALSE, stride, static_cast<GLintptr>(offsetof(GeometryArena::Vertex, position)) };
+    _vertexLayout.normal   = { 3, GL_FLOAT, GL_FALSE, stride, static_cast<GLintptr>(offsetof(GeometryArena::Vertex, normal)) };
+    _vertexLayout.texCoord = { 2, GL_FLOAT, GL_FALSE, stride, static_cast<GLintptr>(offsetof(GeometryArena::Vertex, texCoord)) };
+    _vertexLayout.tangent  = { 4, GL_FLOAT, GL_FALSE, stride, static_cast<GLintptr>(offsetof(GeometryArena::Vertex, tangent)) };
+    _vertexLayout.color    = { 4, GL_FLOAT, GL_FALSE, stride, static_cast<GLintptr>(offsetof(GeometryArena::Vertex, color)) };
 }
 
-[[maybe_unused]]
-inline void CSCI441::ModelLoader::enableAutoGenerateNormals() {
-    sAUTO_GEN_NORMALS = true;
+//
+//  void _releaseGeometryArena()
+//
+//      Returns the model's range to the geometry arena it was uploaded into
+//
+inline void CSCI441::ModelLoader::_releaseGeometryArena() {
+    if( _geometryArena != nullptr && !_pendingArenaUpload ) _geometryArena->release( _arenaAllocation );
+    _geometryArena = nullptr;
+    _arenaAllocation = GeometryArena::Allocation();
+    _pendingArenaUpload = false;
 }
 
-[[maybe_unused]]
-inline void CSCI441::ModelLoader::disableAutoGenerateNormals() {
-    sAUTO_GEN_NORMALS = false;
+//
+//  void _bindVertexArray()
+//
+//      Binds the vertex array the model draws from, either its own or the
+//  arena page holding the model
+//
+inline void CSCI441::ModelLoader::_bindVertexArray() const {
+    if( _geometryArena != nullptr ) _geometryArena->bindPage( _arenaAllocation.page );
+    else                            glBindVertexArray( _vaod );
 }
-[[maybe_unused]]
-inline void CSCI441::ModelLoader::enableAutoGenerateTangents() {
-    sAUTO_GEN_TANGENTS = true;
+
+//
+//  const void* _indexOffset(GLuint index)
+//
+//      Byte offset into the bound index buffer of one of the model's indices
+//
+inline const void* CSCI441::ModelLoader::_indexOffset( const GLuint index ) const {
+    const size_t indexSize = (_indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint));
+    return (const void*)(indexSize * (static_cast<size_t>(_arenaAllocation.firstIndex) + index));
 }
 
-[[maybe_unused]]
-inline void CSCI441::ModelLoader::disableAutoGenerateTangents() {
-    sAUTO_GEN_TANGENTS = false;
+//
+//  bool _streamsLoad(bool INFO)
+//
+//      Models are streamed when enabled, except during an asynchronous load
+//  where the file is read off of the GL thread, or when models are uploaded
+//  into a geometry arena, which needs the vertices in memory to interleave
+//  them.  Options that need the whole model in memory are reported as skipped.
+//
+inline bool CSCI441::ModelLoader::_streamsLoad( const bool INFO ) const {
+    if( !_loadOptions.streamLoad || _deferUpload || _loadOptions.geometryArena != nullptr ) return false;
+    if( INFO && (_loadOptions.weldVertices || _loadOptions.autoGenNormals || _loadOptions.autoGenTangents || _loadOptions.interleaveVertices || _packsVertexAttributes()
+                 || _loadOptions.optimizeVertexCache || _loadOptions.optimizeOverdraw || _loadOptions.buildMeshlets || _loadOptions.buildLevelsOfDetail) ) {
+        CSCI441::LogUtils::log("[%s]: [WARN]: Streamed models are not welded, interleaved, packed, optimized, or split into\n\tmeshlets or levels of detail, and do not have normals or tangents generated.\n", _logPrefix().c_str() );
+    }
+    return true;
 }
 
-inline void CSCI441::ModelLoader::_allocateAttributeArrays(const GLuint numVertices, const GLuint numIndices) {
-    _vertices  = new glm::vec3[numVertices];
-    _normals   = new glm::vec3[numVertices];
-	_tangents  = new glm::vec4[numVertices];
-    _texCoords = new glm::vec2[numVertices];
-    _indices   = new GLuint[numIndices];
+//
+//  bool _beginStreaming(StreamingLoadState& stream, GLuint numVertices, bool hasColors)
+//
+//      Opens the temporary file indices are spilled to and allocates the
+//  vertex buffer in the separate layout.  The memory budget is split evenly
+//  between staged vertices and staged indices.
+//
+inline bool CSCI441::ModelLoader::_beginStreaming( CSCI441_INTERNAL::StreamingLoadState& stream, const GLuint numVertices, const bool hasColors ) {
+    stream.numVertices = numVertices;
+    stream.hasColors = hasColors;
+    stream.chunkVertices = std::max<size_t>( _loadOptions.streamMemoryBudget / 2 / CSCI441_INTERNAL::STREAMING_BYTES_PER_VERTEX, 1024 );
+    stream.chunkIndices = std::max<size_t>( _loadOptions.streamMemoryBudget / 2 / (sizeof(GLuint) * 3), 1024 ) * 3;
+    stream.indexFile = std::tmpfile();
+    if( stream.indexFile == nullptr ) return false;
+
+    _allocateBuffer( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLsizeiptr>((sizeof(glm::vec3)*2 + sizeof(glm::vec2) + sizeof(glm::vec4) * (hasColors ? 2 : 1)) * numVertices), nullptr );
+
+    // no streamed format provides tangents, zero their block one chunk at a time
+    const std::vector<glm::vec4> zeros( std::min<size_t>( stream.chunkVertices, numVertices ), glm::vec4(0.0f) );
+    const size_t tangentOffset = (sizeof(glm::vec3) * 2 + sizeof(glm::vec2)) * numVertices;
+    for( size_t v = 0; v < numVertices; v += zeros.size() ) {
+        const size_t count = std::min<size_t>( zeros.size(), numVertices - v );
+        _bufferSubData( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLintptr>(tangentOffset + sizeof(glm::vec4) * v), static_cast<GLsizeiptr>(sizeof(glm::vec4) * count), zeros.data() );
+    }
+    return true;
 }
 
-inline void CSCI441::ModelLoader::_bufferData() const {
-    glBindVertexArray( _vaod );
+//
+//  void _streamVertices(StreamingLoadState& stream, GLuint firstVertex, GLuint numVertices, vertices, normals, texCoords, colors)
+//
+//      Writes a chunk of decoded vertices into each attribute block of the
+//  vertex buffer and grows the bounds of the model to contain them.
+//
+inline void CSCI441::ModelLoader::_streamVertices( CSCI441_INTERNAL::StreamingLoadState& stream, const GLuint firstVertex, const GLuint numVertices,
+                                                   const glm::vec3* vertices, const glm::vec3* normals, const glm::vec2* texCoords, const glm::vec4* colors ) {
+    const size_t blockSize = stream.numVertices;
+    _bufferSubData( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLintptr>(sizeof(glm::vec3) * firstVertex), static_cast<GLsizeiptr>(sizeof(glm::vec3) * numVertices), vertices );
+    _bufferSubData( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLintptr>(sizeof(glm::vec3) * (blockSize + firstVertex)), static_cast<GLsizeiptr>(sizeof(glm::vec3) * numVertices), normals );
+    _bufferSubData( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLintptr>(sizeof(glm::vec3) * blockSize * 2 + sizeof(glm::vec2) * firstVertex), static_cast<GLsizeiptr>(sizeof(glm::vec2) * numVertices), texCoords );
+    if( stream.hasColors ) {
+        _bufferSubData( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLintptr>((sizeof(glm::vec3) * 2 + sizeof(glm::vec2) + sizeof(glm::vec4)) * blockSize + sizeof(glm::vec4) * firstVertex), static_cast<GLsizeiptr>(sizeof(glm::vec4) * numVertices), colors );
+    }
+
+    for( GLuint v = 0; v < numVertices; v++ ) {
+        stream.minimum = glm::min( stream.minimum, vertices[v] );
+        stream.maximum = glm::max( stream.maximum, vertices[v] );
+    }
+}
 
-    glBindBuffer( GL_ARRAY_BUFFER, _vbods[0] );
-    glBufferData( GL_ARRAY_BUFFER, static_cast<GLsizeiptr>((sizeof(glm::vec3)*2 + sizeof(glm::vec2) + sizeof(glm::vec4)) * _uniqueIndex), nullptr, GL_STATIC_DRAW );
-    glBufferSubData( GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(sizeof(glm::vec3) * _uniqueIndex), _vertices );
-    glBufferSubData( GL_ARRAY_BUFFER, static_cast<GLintptr>(sizeof(glm::vec3) * _uniqueIndex), static_cast<GLsizeiptr>(sizeof(glm::vec3) * _uniqueIndex), _normals );
-    glBufferSubData( GL_ARRAY_BUFFER, static_cast<GLintptr>(sizeof(glm::vec3) * _uniqueIndex * 2), static_cast<GLsizeiptr>(sizeof(glm::vec2) * _uniqueIndex), _texCoords );
-    glBufferSubData( GL_ARRAY_BUFFER, static_cast<GLintptr>(sizeof(glm::vec3) * _uniqueIndex * 2 + sizeof(glm::vec2) * _uniqueIndex), static_cast<GLsizeiptr>(sizeof(glm::vec4) * _uniqueIndex), _tangents );
+//
+//  bool _streamIndices(StreamingLoadState& stream, const GLuint* indices, size_t numIndices)
+//
+//      Appends a chunk of triangle indices to the spilled index file.
+//
+inline bool CSCI441::ModelLoader::_streamIndices( CSCI441_INTERNAL::StreamingLoadState& stream, const GLuint* indices, const size_t numIndices ) {
+    if( numIndices == 0 ) return true;
+    if( fwrite( indices, sizeof(GLuint), numIndices, stream.indexFile ) != numIndices ) return false;
+    stream.numIndices += numIndices;
+    return true;
+}
+
+//
+//  bool _endStreaming(StreamingLoadState& stream, bool INFO)
+//
+//      Uploads the spilled indices one chunk at a time with the narrowest type
+//  that can address every vertex, then points the vertex layout at the
+//  streamed attribute blocks.
+//
+inline bool CSCI441::ModelLoader::_endStreaming( CSCI441_INTERNAL::StreamingLoadState& stream, const bool INFO ) {
+    // loaders reject models with more indices than GLuint counts before getting here
+    if( stream.numIndices > std::numeric_limits<GLuint>::max() ) return false;
+    _uniqueIndex = stream.numVertices;
+    _numIndices = static_cast<GLuint>(stream.numIndices);
+    _indexType = _uniqueIndex <= 65536 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    const size_t indexSize = (_indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint));
+    _allocateBuffer( GL_ELEMENT_ARRAY_BUFFER, _vbods[1], static_cast<GLsizeiptr>(indexSize * stream.numIndices), nullptr );
+
+    rewind( stream.indexFile );
+    std::vector<GLuint> indices( std::min( stream.chunkIndices, stream.numIndices ) );
+    std::vector<GLushort> shortIndices( _indexType == GL_UNSIGNED_SHORT ? indices.size() : 0 );
+    for( size_t i = 0; i < stream.numIndices; i += indices.size() ) {
+        const size_t count = std::min( indices.size(), stream.numIndices - i );
+        if( fread( indices.data(), sizeof(GLuint), count, stream.indexFile ) != count ) return false;
+        if( _indexType == GL_UNSIGNED_SHORT ) {
+            std::copy( indices.begin(), indices.begin() + static_cast<std::ptrdiff_t>(count), shortIndices.begin() );
+            _bufferSubData( GL_ELEMENT_ARRAY_BUFFER, _vbods[1], static_cast<GLintptr>(indexSize * i), static_cast<GLsizeiptr>(indexSize * count), shortIndices.data() );
+        } else {
+            _bufferSubData( GL_ELEMENT_ARRAY_BUFFER, _vbods[1], static_cast<GLintptr>(indexSize * i), static_cast<GLsizeiptr>(indexSize * count), indices.data() );
+        }
+    }
+
+    _useSeparateVertexLayout( stream.hasColors );
+    if( stream.numVertices > 0 ) {
+        _boundingSphere = glm::vec4( (stream.minimum + stream.maximum) * 0.5f, glm::length( stream.maximum - stream.minimum ) * 0.5f );
+        _boundingBoxMin = stream.minimum;
+        _boundingBoxMax = stream.maximum;
+    }
+
+    if (INFO) {
+        const size_t vertexBytes = (sizeof(glm::vec3)*2 + sizeof(glm::vec2) + sizeof(glm::vec4) * (stream.hasColors ? 2 : 1)) * stream.numVertices;
+        CSCI441::LogUtils::log("[%s]: Streamed:  \t%.1f MB vertices\t%.1f MB indices\n", _logPrefix().c_str(),
+                               static_cast<double>(vertexBytes) / (1024.0 * 1024.0), static_cast<double>(indexSize * stream.numIndices) / (1024.0 * 1024.0) );
+        CSCI441::LogUtils::log("[%s]: Peak memory:\t%.1f MB\n", _logPrefix().c_str(), static_cast<double>(CSCI441_INTERNAL::peakResidentSetSize()) / (1024.0 * 1024.0) );
+    }
+    return true;
+}
 
-    glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, _vbods[1] );
-    glBufferData( GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(GLuint) * _numIndices), _indices, GL_STATIC_DRAW );
+//
+//  void _bufferInterleavedData(bool INFO)
+//
+//      Writes every attribute of a vertex next to each other so a vertex fetch
+//  reads one contiguous record.  Packed attributes store normals and tangents
+//  as signed normalized 2_10_10_10 values, texture coordinates as half floats,
+//  and colors as normalized bytes.  Quantization options further replace
+//  these encodings; the worst and average error each encoding introduces is
+//  measured as the buffer is filled.
+//
+inline void CSCI441::ModelLoader::_bufferInterleavedData( const bool INFO ) {
+    const bool pack = _packsVertexAttributes();
+    const bool quantizePositions = pack && _loadOptions.quantizePositions;
+    const bool octahedral = pack && _loadOptions.octahedralNormals;
+    const bool unorm16TexCoords = pack && _loadOptions.unorm16TexCoords;
+
+    GLsizei stride = 0;
+    const auto appendAttribute = [&stride](CSCI441_INTERNAL::VertexAttributeFormat& format, const GLint numComponents, const GLenum type, const GLboolean normalized, const GLsizei numBytes) {
+        format = { numComponents, type, normalized, 0, stride };
+        stride += numBytes;
+    };
+
+    _vertexLayout = CSCI441_INTERNAL::VertexLayout();
+    if( quantizePositions ) appendAttribute( _vertexLayout.position, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(GLushort) * 4 );
+    else                    appendAttribute( _vertexLayout.position, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3) );
+    if( pack ) {
+        if( octahedral ) {
+            appendAttribute( _vertexLayout.normal, 2, GL_SHORT, GL_TRUE, sizeof(GLshort) * 2 );
+            appendAttribute( _vertexLayout.tangent, 4, GL_SHORT, GL_TRUE, sizeof(GLshort) * 4 );
+        } else {
+            appendAttribute( _vertexLayout.normal, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(GLuint) );
+            appendAttribute( _vertexLayout.tangent, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(GLuint) );
+        }
+        if( unorm16TexCoords ) appendAttribute( _vertexLayout.texCoord, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(GLushort) * 2 );
+        else                   appendAttribute( _vertexLayout.texCoord, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(GLuint) );
+        if( _colors != nullptr ) appendAttribute( _vertexLayout.color, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(GLuint) );
+    } else {
+        appendAttribute( _vertexLayout.normal, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3) );
+        appendAttribute( _vertexLayout.texCoord, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2) );
+        appendAttribute( _vertexLayout.tangent, 4, GL_FLOAT, GL_FALSE, sizeof(glm::vec4) );
+        if( _colors != nullptr ) appendAttribute( _vertexLayout.color, 4, GL_FLOAT, GL_FALSE, sizeof(glm::vec4) );
+    }
+    for( auto* format : { &_vertexLayout.position, &_vertexLayout.normal, &_vertexLayout.texCoord, &_vertexLayout.tangent, &_vertexLayout.color } ) {
+        format->stride = stride;
+    }
+
+    // positions are quantized relative to the bounding box, the dequantization matrix maps [0,1]^3 back onto it
+    glm::vec3 boundsMin( 0.0f ), boundsSize( 1.0f );
+    if( quantizePositions && _uniqueIndex > 0 ) {
+        glm::vec3 boundsMax = boundsMin = _vertices[0];
+        for( GLuint i = 1; i < _uniqueIndex; i++ ) {
+            boundsMin = glm::min( boundsMin, _vertices[i] );
+            boundsMax = glm::max( boundsMax, _vertices[i] );
+        }
+        boundsSize = boundsMax - boundsMin;
+        for( GLuint axis = 0; axis < 3; axis++ ) {
+            if( boundsSize[axis] <= 0.0f ) boundsSize[axis] = 1.0f;
+        }
+    }
+    _positionDequantization = glm::mat4( 1.0f );
+    if( quantizePositions ) {
+        _positionDequantization[0][0] = boundsSize.x;
+        _positionDequantization[1][1] = boundsSize.y;
+        _positionDequantization[2][2] = boundsSize.z;
+        _positionDequantization[3] = glm::vec4( boundsMin, 1.0f );
+    }
+
+    // worst and summed error of each encoding, angles in degrees
+    GLfloat maxPositionError = 0.0f, maxNormalError = 0.0f, maxTangentError = 0.0f, maxTexCoordError = 0.0f;
+    double sumPositionError = 0.0, sumNormalError = 0.0, sumTangentError = 0.0, sumTexCoordError = 0.0;
+    GLuint numClampedTexCoords = 0;
+    const auto angleBetween = [](const glm::vec3 a, const glm::vec3 b) {
+        const GLfloat lengths = glm::length( a ) * glm::length( b );
+        if( lengths == 0.0f ) return 0.0f;
+        return glm::degrees( std::acos( glm::clamp( glm::dot( a, b ) / lengths, -1.0f, 1.0f ) ) );
+    };
+
+    const auto normalizeOrZero = [](const glm::vec3 direction) {
+        const GLfloat length = glm::length( direction );
+        return length > 0.0f ? direction / length : direction;
+    };
+
+    auto* vertexData = new unsigned char[static_cast<size_t>(stride) * _uniqueIndex];
+    for( GLuint i = 0; i < _uniqueIndex; i++ ) {
+        unsigned char* vertex = vertexData + static_cast<size_t>(stride) * i;
+        if( !pack ) {
+            memcpy( vertex + _vertexLayout.position.offset, &_vertices[i], sizeof(glm::vec3) );
+            memcpy( vertex + _vertexLayout.normal.offset, &_normals[i], sizeof(glm::vec3) );
+            memcpy( vertex + _vertexLayout.texCoord.offset, &_texCoords[i], sizeof(glm::vec2) );
+            memcpy( vertex + _vertexLayout.tangent.offset, &_tangents[i], sizeof(glm::vec4) );
+            if( _colors != nullptr ) memcpy( vertex + _vertexLayout.color.offset, &_colors[i], sizeof(glm::vec4) );
+            continue;
+        }
+
+        if( quantizePositions ) {
+            const glm::vec3 relative = (_vertices[i] - boundsMin) / boundsSize;
+            const uint64_t position = glm::packUnorm4x16( glm::vec4( relative, 0.0f ) );
+            memcpy( vertex + _vertexLayout.position.offset, &position, sizeof(position) );
+            const glm::vec3 decoded = boundsMin + glm::vec3( glm::unpackUnorm4x16( position ) ) * boundsSize;
+            const GLfloat error = glm::length( decoded - _vertices[i] );
+            maxPositionError = std::max( maxPositionError, error );
+            sumPositionError += error;
+        } else {
+            memcpy( vertex + _vertexLayout.position.offset, &_vertices[i], sizeof(glm::vec3) );
+        }
+
+        // packed normals and tangents must be unit length to fit the normalized range
+        const glm::vec3 normal = normalizeOrZero( _normals[i] );
+        const glm::vec3 tangent = normalizeOrZero( glm::vec3( _tangents[i] ) );
+        const GLfloat handedness = _tangents[i].w < 0.0f ? -1.0f : 1.0f;
+        glm::vec3 decodedNormal, decodedTangent;
+        if( octahedral ) {
+            const GLuint packedNormal = glm::packSnorm2x16( CSCI441_INTERNAL::octahedralEncode( normal ) );
+            const GLuint packedTangent[2] = { glm::packSnorm2x16( CSCI441_INTERNAL::octahedralEncode( tangent ) ), glm::packSnorm2x16( glm::vec2( handedness, 0.0f ) ) };
+            memcpy( vertex + _vertexLayout.normal.offset, &packedNormal, sizeof(packedNormal) );
+            memcpy( vertex + _vertexLayout.tangent.offset, packedTangent, sizeof(packedTangent) );
+            decodedNormal = CSCI441_INTERNAL::octahedralDecode( glm::unpackSnorm2x16( packedNormal ) );
+            decodedTangent = CSCI441_INTERNAL::octahedralDecode( glm::unpackSnorm2x16( packedTangent[0] ) );
+        } else {
+            const GLuint packedNormal = glm::packSnorm3x10_1x2( glm::vec4( normal, 0.0f ) );
+            const GLuint packedTangent = glm::packSnorm3x10_1x2( glm::vec4( tangent, handedness ) );
+            memcpy( vertex + _vertexLayout.normal.offset, &packedNormal, sizeof(packedNormal) );
+            memcpy( vertex + _vertexLayout.tangent.offset, &packedTangent, sizeof(packedTangent) );
+            decodedNormal = glm::vec3( glm::unpackSnorm3x10_1x2( packedNormal ) );
+            decodedTangent = glm::vec3( glm::unpackSnorm3x10_1x2( packedTangent ) );
+        }
+        const GLfloat normalError = angleBetween( normal, decodedNormal );
+        const GLfloat tangentError = angleBetween( tangent, decodedTangent );
+        maxNormalError = std::max( maxNormalError, normalError );
+        maxTangentError = std::max( maxTangentError, tangentError );
+        sumNormalError += normalError;
+        sumTangentError += tangentError;
+
+        GLuint texCoord;
+        glm::vec2 decodedTexCoord;
+        if( unorm16TexCoords ) {
+            if( glm::any( glm::lessThan( _texCoords[i], glm::vec2( 0.0f ) ) ) || glm::any( glm::greaterThan( _texCoords[i], glm::vec2( 1.0f ) ) ) ) numClampedTexCoords++;
+            texCoord = glm::packUnorm2x16( _texCoords[i] );
+            decodedTexCoord = glm::unpackUnorm2x16( texCoord );
+        } else {
+            texCoord = glm::packHalf2x16( _texCoords[i] );
+            decodedTexCoord = glm::unpackHalf2x16( texCoord );
+        }
+        memcpy( vertex + _vertexLayout.texCoord.offset, &texCoord, sizeof(texCoord) );
+        const GLfloat texCoordError = glm::length( decodedTexCoord - _texCoords[i] );
+        maxTexCoordError = std::max( maxTexCoordError, texCoordError );
+        sumTexCoordError += texCoordError;
+
+        if( _colors != nullptr ) {
+            const GLuint color = glm::packUnorm4x8( _colors[i] );
+            memcpy( vertex + _vertexLayout.color.offset, &color, sizeof(GLuint) );
+        }
+    }
+
+    _allocateBuffer( GL_ARRAY_BUFFER, _vbods[0], static_cast<GLsizeiptr>(static_cast<size_t>(stride) * _uniqueIndex), vertexData );
+    delete[] vertexData;
+
+    if( INFO && pack && _uniqueIndex > 0 ) {
+        const std::string prefix = _logPrefix();
+        const double numVertices = _uniqueIndex;
+        CSCI441::LogUtils::log("[%s]: Packed Vertex:\t%d bytes (%d bytes unpacked)\n", prefix.c_str(), stride, static_cast<int>(sizeof(glm::vec3)*2 + sizeof(glm::vec2) + sizeof(glm::vec4) * (_colors != nullptr ? 2 : 1)) );
+        if( quantizePositions )
+            CSCI441::LogUtils::log("[%s]: Position Error:\tmax %g\tmean %g\t(bounding box %g x %g x %g)\n", prefix.c_str(), maxPositionError, sumPositionError / numVertices, boundsSize.x, boundsSize.y, boundsSize.z );
+        CSCI441::LogUtils::log("[%s]: Normal Error:  \tmax %g deg\tmean %g deg\n", prefix.c_str(), maxNormalError, sumNormalError / numVertices );
+        CSCI441::LogUtils::log("[%s]: Tangent Error: \tmax %g deg\tmean %g deg\n", prefix.c_str(), maxTangentError, sumTangentError / numVertices );
+        CSCI441::LogUtils::log("[%s]: TexCoord Error:\tmax %g\tmean %g\n", prefix.c_str(), maxTexCoordError, sumTexCoordError / numVertices );
+        if( numClampedTexCoords > 0 )
+            CSCI441::LogUtils::log("[%s]: [WARN]: %u texture coordinates lie outside [0, 1] and were clamped\n", prefix.c_str(), numClampedTexCoords );
+    }
 }
 
 //
@@ -1901,6 +4811,15 @@ inline void CSCI441::ModelLoader::_moveFromSrc(ModelLoader& src) {
 	_tangents = src._tangents;
 	src._tangents = nullptr;
 
+	_colors = src._colors;
+	src._colors = nullptr;
+
+	_vertexLayout = src._vertexLayout;
+	src._vertexLayout = CSCI441_INTERNAL::VertexLayout();
+
+	_positionDequantization = src._positionDequantization;
+	src._positionDequantization = glm::mat4( 1.0f );
+
 	_indices = src._indices;
 	src._indices = nullptr;
 
@@ -1910,14 +4829,28 @@ inline void CSCI441::ModelLoader::_moveFromSrc(ModelLoader& src) {
 	_numIndices = src._numIndices;
 	src._numIndices = 0;
 
+	_indexType = src._indexType;
+	src._indexType = GL_UNSIGNED_INT;
+
 	_vbods[0] = src._vbods[0];
 	_vbods[1] = src._vbods[1];
 	src._vbods[0] = 0;
 	src._vbods[1] = 0;
 
+	_instanceModelMatrixLocation = src._instanceModelMatrixLocation;
+	_instanceColorLocation = src._instanceColorLocation;
+	_instanceStorageBlockBinding = src._instanceStorageBlockBinding;
+
 	_vaod = src._vaod;
 	src._vaod = 0;
 
+	_geometryArena = src._geometryArena;
+	src._geometryArena = nullptr;
+	_arenaAllocation = src._arenaAllocation;
+	src._arenaAllocation = GeometryArena::Allocation();
+	_pendingArenaUpload = src._pendingArenaUpload;
+	src._pendingArenaUpload = false;
+
 	_filename = std::move(src._filename);
 	src._filename = "";
 
@@ -1925,9 +4858,54 @@ inline void CSCI441::ModelLoader::_moveFromSrc(ModelLoader& src) {
 
 	_materials = std::move(src._materials);
 	_materialIndexStartStop = std::move(src._materialIndexStartStop);
+	_dependentFiles = std::move(src._dependentFiles);
+
+	_drawCounts = std::move(src._drawCounts);
+	_drawOffsets = std::move(src._drawOffsets);
+	_drawBaseVertices = std::move(src._drawBaseVertices);
+	_materialBufferd = src._materialBufferd;
+	src._materialBufferd = 0;
+	_materialRecordStride = src._materialRecordStride;
+	_drawListGroups = std::move(src._drawListGroups);
+
+	_deferUpload = src._deferUpload;
+	src._deferUpload = false;
+	_pendingBufferUploads = std::move(src._pendingBufferUploads);
+	_pendingTextures = std::move(src._pendingTextures);
+	_asyncLoad = std::move(src._asyncLoad);
+	_loadOptions = src._loadOptions;
+
+	_meshlets = std::move(src._meshlets);
+	_materialMeshletStartStop = std::move(src._materialMeshletStartStop);
+
+	_lodIndices = std::move(src._lodIndices);
+	_lodMaterialIndexStartStop = std::move(src._lodMaterialIndexStartStop);
+	_lodErrors = std::move(src._lodErrors);
+	_boundingSphere = src._boundingSphere;
+	src._boundingSphere = glm::vec4( 0.0f );
+
+	_boundingBoxMin = src._boundingBoxMin;
+	_boundingBoxMax = src._boundingBoxMax;
+	src._boundingBoxMin = glm::vec3( 0.0f );
+	src._boundingBoxMax = glm::vec3( 0.0f );
+
+	_peakResidentSetSize = src._peakResidentSetSize;
+	src._peakResidentSetSize = 0;
+
+	_loadStats = std::move(src._loadStats);
+	src._loadStats = LoadStats();
 }
 
 inline void CSCI441::ModelLoader::_cleanupSelf() {
+	// a load still parsing in the background must finish before its arrays are freed
+	if( _asyncLoad && _asyncLoad->worker.joinable() ) {
+		_asyncLoad->worker.join();
+	}
+	_asyncLoad.reset();
+	_pendingBufferUploads.clear();
+	_pendingTextures.clear();
+	_deferUpload = false;
+
 	delete[] _vertices;
 	_vertices = nullptr;
 
@@ -1940,6 +4918,9 @@ inline void CSCI441::ModelLoader::_cleanupSelf() {
 	delete[] _texCoords;
 	_texCoords = nullptr;
 
+	delete[] _colors;
+	_colors = nullptr;
+
 	delete[] _indices;
 	_indices = nullptr;
 
@@ -1950,10 +4931,21 @@ inline void CSCI441::ModelLoader::_cleanupSelf() {
 	glDeleteVertexArrays( 1, &_vaod );
 	_vaod = 0;
 
+	_releaseGeometryArena();
+
+	glDeleteBuffers( 1, &_materialBufferd );
+	_materialBufferd = 0;
+	_materialRecordStride = static_cast<GLsizeiptr>(sizeof(CSCI441_INTERNAL::MaterialRecord));
+
 	_hasVertexTexCoords = false;
 	_hasVertexNormals = false;
+	_vertexLayout = CSCI441_INTERNAL::VertexLayout();
+	_positionDequantization = glm::mat4( 1.0f );
 	_uniqueIndex = 0;
 	_numIndices = 0;
+	_indexType = GL_UNSIGNED_INT;
+	_peakResidentSetSize = 0;
+	_loadStats = LoadStats();
 	_filename = "";
 
 	for( const auto& [name, material] : _materials ) {
@@ -1962,6 +4954,22 @@ inline void CSCI441::ModelLoader::_cleanupSelf() {
 	_materials.clear();
 
 	_materialIndexStartStop.clear();
+	_dependentFiles.clear();
+
+	_drawCounts.clear();
+	_drawOffsets.clear();
+	_drawBaseVertices.clear();
+	_drawListGroups.clear();
+
+	_meshlets.clear();
+	_materialMeshletStartStop.clear();
+
+	_lodIndices.clear();
+	_lodMaterialIndexStartStop.clear();
+	_lodErrors.clear();
+	_boundingSphere = glm::vec4( 0.0f );
+	_boundingBoxMin = glm::vec3( 0.0f );
+	_boundingBoxMax = glm::vec3( 0.0f );
 }
 
 inline unsigned char* CSCI441_INTERNAL::createTransparentTexture( const unsigned char * imageData, const unsigned char *imageMask, const int texWidth, const int texHeight, const int texChannels, const int maskChannels ) {
@@ -0,0 +1,3196 @@
+/**
+ * @file ModelLoader_types.hpp
+ * @brief Internal file access and parsing types used by the ModelLoader
+ * @author Dr. Jeffrey Paone
+ *
+ * @copyright MIT License Copyright (c) 2026 Dr. Jeffrey Paone
+ *
+ *	These functions, classes, and constants help minimize common
+ *	code that needs to be written.
+ */
+
+#ifndef CSCI441_MODEL_LOADER_TYPES_HPP
+#define CSCI441_MODEL_LOADER_TYPES_HPP
+
+#ifdef CSCI441_USE_GLEW
+    #include <GL/glew.h>
+#else
+    #include <glad/gl.h>
+#endif
+
+#include "modelMaterial.hpp"
+
+#include <glm/ext/scalar_constants.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/geometric.hpp>
+#include <glm/trigonometric.hpp>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/resource.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CSCI441 {
+    class GeometryArena;
+    class ModelLoader;
+}
+
+namespace CSCI441_INTERNAL {
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // file access
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief read-only view of an entire file mapped into the address space of the process
+     * @note the operating system pages the file in on demand, so no copy of the file contents is made
+     */
+    class MappedFile final {
+    public:
+        /**
+         * @brief creates an empty mapping
+         */
+        MappedFile() = default;
+        /**
+         * @brief unmaps the file if one is open
+         */
+        ~MappedFile();
+
+        /**
+         * @brief do not allow mappings to be copied
+         */
+        MappedFile(const MappedFile&) = delete;
+        /**
+         * @brief do not allow mappings to be copied
+         */
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief maps the entire contents of a file for reading
+         * @param filename file to open
+         * @return true if the file was opened and mapped, false otherwise
+         * @note an empty file is successfully opened with a size of zero
+         */
+        bool open(const char* filename);
+        /**
+         * @brief unmaps the file and closes any handles associated with it
+         */
+        void close();
+
+        /**
+         * @brief returns if a file is currently mapped
+         * @return true if open() succeeded and close() has not been called
+         */
+        [[nodiscard]] bool isOpen() const noexcept { return _isOpen; }
+        /**
+         * @brief pointer to the first byte of the file
+         * @return start of file contents, nullptr if the file is empty or not open
+         */
+        [[nodiscard]] const char* data() const noexcept { return _data; }
+        /**
+         * @brief number of bytes in the file
+         * @return size of the file
+         */
+        [[nodiscard]] size_t size() const noexcept { return _size; }
+        /**
+         * @brief releases the pages of the mapping wholly inside [begin, end) from the resident set of the process
+         * @param begin byte offset of the first byte that will not be read again
+         * @param end byte offset one past the last byte that will not be read again
+         * @note the pages are read back from the file if they are accessed again
+         */
+        void discard(size_t begin, size_t end) const noexcept;
+
+    private:
+        const char* _data = nullptr;
+        size_t _size = 0;
+        bool _isOpen = false;
+#ifdef _WIN32
+        HANDLE _fileHandle = INVALID_HANDLE_VALUE;
+        HANDLE _mappingHandle = nullptr;
+#endif
+    };
+
+    /**
+     * @brief looks up when a file was last modified
+     * @param filename file to query
+     * @param modificationTime set to the last modification time in nanoseconds since the epoch, at the resolution the
+     * file system records
+     * @return true if the file exists and its modification time was read
+     */
+    bool fileModificationTime(const char* filename, int64_t& modificationTime) noexcept;
+    /**
+     * @brief looks up the size of a file
+     * @param filename file to query
+     * @param size set to the size of the file in bytes
+     * @return true if the file exists and its size was read
+     */
+    bool fileSize(const char* filename, size_t& size) noexcept;
+
+    /**
+     * @brief extension appended to a model filename to name the JSON file its load statistics are saved to
+     */
+    constexpr const char* LOAD_STATS_EXTENSION = ".stats.json";
+    /**
+     * @brief time elapsed since a point in time
+     * @param start point in time to measure from
+     * @return elapsed time in milliseconds
+     */
+    double millisecondsSince(std::chrono::steady_clock::time_point start) noexcept;
+    /**
+     * @brief adds the time spent in a scope to a running total when the scope exits
+     */
+    struct ScopedTimer {
+        /**
+         * @brief starts timing
+         * @param total running total in milliseconds to add the elapsed time to
+         */
+        explicit ScopedTimer(double& total) : total(total), start(std::chrono::steady_clock::now()) {}
+        /**
+         * @brief adds the elapsed time to the running total
+         */
+        ~ScopedTimer() { total += millisecondsSince(start); }
+        /**
+         * @brief do not allow timers to be copied
+         */
+        ScopedTimer(const ScopedTimer&) = delete;
+        /**
+         * @brief do not allow timers to be copied
+         */
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        /**
+         * @brief running total in milliseconds
+         */
+        double& total;
+        /**
+         * @brief time the scope was entered
+         */
+        std::chrono::steady_clock::time_point start;
+    };
+
+    /**
+     * @brief restarts tracking the peak resident set size of the process
+     * @note only supported on Linux, elsewhere the peak continues to cover the lifetime of the process
+     */
+    void resetPeakResidentSetSize() noexcept;
+    /**
+     * @brief largest amount of physical memory the process has used since the peak was last reset
+     * @return peak resident set size in bytes, 0 if it could not be queried
+     */
+    size_t peakResidentSetSize() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // text parsing
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief forward-only cursor over a block of text that hands out whitespace
+     * delimited tokens as views into the underlying buffer
+     * @note no memory is allocated while walking the buffer
+     */
+    struct TextCursor {
+        /**
+         * @brief current read position
+         */
+        const char* current;
+        /**
+         * @brief one past the last readable character
+         */
+        const char* end;
+
+        /**
+         * @brief creates a cursor spanning [begin, end)
+         * @param begin first character to read
+         * @param end one past the last character to read
+         */
+        TextCursor(const char* begin, const char* end) : current(begin), end(end) {}
+
+        /**
+         * @brief returns if the entire buffer has been consumed
+         * @return true if no characters remain
+         */
+        [[nodiscard]] bool atEnd() const noexcept { return current >= end; }
+        /**
+         * @brief advances past spaces and tabs on the current line
+         */
+        void skipBlanks() noexcept;
+        /**
+         * @brief advances to the first character of the next line
+         */
+        void skipLine() noexcept;
+        /**
+         * @brief returns the next token on the current line
+         * @return view of the token, empty if the end of the line has been reached
+         */
+        std::string_view nextToken() noexcept;
+        /**
+         * @brief returns the remainder of the current line with surrounding whitespace removed
+         * @return view of the remaining text on the line
+         */
+        std::string_view restOfLine() noexcept;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // vertex layout
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief how a single vertex attribute is stored within a vertex buffer
+     */
+    struct VertexAttributeFormat {
+        /**
+         * @brief number of components, zero if the attribute is not present in the buffer
+         */
+        GLint numComponents = 0;
+        /**
+         * @brief data type of each component
+         */
+        GLenum type = GL_FLOAT;
+        /**
+         * @brief if integer components are normalized when fetched
+         */
+        GLboolean normalized = GL_FALSE;
+        /**
+         * @brief byte distance between consecutive vertices, zero if tightly packed
+         */
+        GLsizei stride = 0;
+        /**
+         * @brief byte offset of the first vertex's attribute
+         */
+        GLintptr offset = 0;
+    };
+
+    /**
+     * @brief placement of every attribute a model buffers
+     */
+    struct VertexLayout {
+        /**
+         * @brief vertex position
+         */
+        VertexAttributeFormat position;
+        /**
+         * @brief vertex normal
+         */
+        VertexAttributeFormat normal;
+        /**
+         * @brief vertex texture coordinate
+         */
+        VertexAttributeFormat texCoord;
+        /**
+         * @brief vertex tangent
+         */
+        VertexAttributeFormat tangent;
+        /**
+         * @brief vertex color
+         */
+        VertexAttributeFormat color;
+    };
+
+    /**
+     * @brief maps a unit direction onto the octahedron unfolded into [-1, 1] x [-1, 1]
+     * @param direction unit length direction to encode
+     * @return octahedral coordinates of the direction
+     */
+    glm::vec2 octahedralEncode(glm::vec3 direction) noexcept;
+    /**
+     * @brief maps octahedral coordinates back to a unit direction
+     * @param encoded octahedral coordinates
+     * @return unit length direction
+     */
+    glm::vec3 octahedralDecode(glm::vec2 encoded) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // vertex deduplication
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief open addressing hash table mapping a (vertex, texture coordinate, normal)
+     * index triple to the unique vertex index it was assigned
+     * @note keys are stored packed inline, so lookups and insertions do not allocate
+     * and no strings are built
+     */
+    class VertexIndexTable final {
+    public:
+        /**
+         * @brief creates an empty table
+         * @param expectedSize number of unique triples expected, used to size the table up front
+         */
+        explicit VertexIndexTable(size_t expectedSize = 0);
+
+        /**
+         * @brief looks up a triple and assigns it an index if it has not been seen before
+         * @param vertexIndex one-based position index, must be non-zero
+         * @param texCoordIndex one-based texture coordinate index, zero if not present
+         * @param normalIndex one-based normal index, zero if not present
+         * @param newIndex index to assign if the triple is not yet in the table
+         * @return the index associated with the triple and true if it was just inserted
+         */
+        std::pair<GLuint, bool> insert(GLuint vertexIndex, GLuint texCoordIndex, GLuint normalIndex, GLuint newIndex);
+
+        /**
+         * @brief number of unique triples stored in the table
+         * @return number of entries
+         */
+        [[nodiscard]] size_t size() const noexcept { return _size; }
+        /**
+         * @brief removes all entries and releases the table storage
+         */
+        void clear();
+
+    private:
+        /**
+         * @brief a packed key and its value, a vertex index of zero marks an empty slot
+         */
+        struct Entry {
+            GLuint vertexIndex = 0;
+            GLuint texCoordIndex = 0;
+            GLuint normalIndex = 0;
+            GLuint index = 0;
+        };
+        std::vector<Entry> _entries;
+        size_t _size = 0;
+
+        static size_t _hash(GLuint vertexIndex, GLuint texCoordIndex, GLuint normalIndex) noexcept;
+        void _rehash(size_t capacity);
+    };
+
+    /**
+     * @brief open addressing spatial hash of vertices keyed on their position, normal, texture coordinate, and color
+     * @note used to weld vertices that were emitted once per triangle corner back into shared vertices.  With an
+     * epsilon of zero positions must match exactly.  Otherwise positions are hashed into a grid of epsilon sized cells
+     * and a vertex welds to the first vertex in its own or a neighboring cell that is within epsilon along every axis.
+     */
+    class VertexWeldTable final {
+    public:
+        /**
+         * @brief creates an empty table
+         * @param expectedSize number of vertices expected, used to size the table up front
+         * @param epsilon largest distance along each axis between positions that are welded
+         */
+        explicit VertexWeldTable(size_t expectedSize = 0, GLfloat epsilon = 0.0f);
+
+        /**
+         * @brief looks up a vertex and assigns it an index if a matching vertex has not been seen before
+         * @param position vertex position
+         * @param normal vertex normal
+         * @param texCoord vertex texture coordinate
+         * @param color vertex color
+         * @param newIndex index to assign if the vertex is not yet in the table
+         * @return the index associated with the vertex and true if it was just inserted
+         * @note the normal, texture coordinate, and color must match exactly
+         */
+        std::pair<GLuint, bool> insert(const glm::vec3& position, const glm::vec3& normal, const glm::vec2& texCoord, const glm::vec4& color, GLuint newIndex);
+
+        /**
+         * @brief number of unique vertices stored in the table
+         * @return number of entries
+         */
+        [[nodiscard]] size_t size() const noexcept { return _size; }
+
+    private:
+        /**
+         * @brief marks an empty slot
+         */
+        static constexpr GLuint EMPTY = 0xFFFFFFFF;
+        /**
+         * @brief a vertex and the index it was assigned
+         */
+        struct Entry {
+            glm::vec3 position;
+            glm::vec3 normal;
+            glm::vec2 texCoord;
+            glm::vec4 color;
+            int64_t cell[3];
+            GLuint index = EMPTY;
+        };
+        std::vector<Entry> _entries;
+        size_t _size = 0;
+        GLfloat _epsilon;
+
+        void _cellOf(const glm::vec3& position, int64_t cell[3]) const noexcept;
+        [[nodiscard]] size_t _slotOf(const Entry& entry) const noexcept;
+        static size_t _hash(const glm::vec3& position) noexcept;
+        static size_t _hashCell(const int64_t cell[3]) noexcept;
+        void _rehash(size_t capacity);
+    };
+
+    /**
+     * @brief finds the triangles of a triangle list that can be removed without changing what is drawn
+     * @param indices triangle list
+     * @param numIndices number of indices, a multiple of three
+     * @param positions vertex positions the indices refer to
+     * @param keep set to one entry per triangle, false if the triangle is redundant
+     * @param numDegenerate set to the number of triangles that repeat a vertex or have zero area
+     * @param numDuplicate set to the number of triangles with the same vertices and winding as an earlier triangle
+     */
+    void findRedundantTriangles(const GLuint* indices, size_t numIndices, const glm::vec3* positions, std::vector<bool>& keep, GLuint& numDegenerate, GLuint& numDuplicate);
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // attribute generation
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief fewest triangles or vertices worth handing to another thread while generating attributes
+     */
+    constexpr size_t ATTRIBUTE_GENERATION_MIN_ITEMS_PER_THREAD = 1 << 15;
+
+    /**
+     * @brief splits [0, count) into contiguous ranges and runs them on as many threads as are worthwhile
+     * @param count number of items
+     * @param minItemsPerThread fewest items given to each thread
+     * @param body called once per range with the first and one past the last item of the range
+     * @note the calling thread runs the first range, the call returns once every range is complete
+     */
+    void parallelFor(size_t count, size_t minItemsPerThread, const std::function<void(size_t, size_t)>& body);
+
+    /**
+     * @brief computes smooth normals at the triangle corners of an indexed triangle mesh
+     * @param positions vertex positions
+     * @param numVertices number of vertices
+     * @param indices triangle list indices
+     * @param numIndices number of indices
+     * @param creaseAngle largest angle in radians between two faces that are smoothed across
+     * @param cornerNormals resized to numIndices, set to the normal at each triangle corner
+     * @note corners are smoothed with every triangle at the same position, even when its vertex has a different
+     * texture coordinate, so seams stay invisible.  The triangles around a position are split into crease groups,
+     * joining two triangles that share an edge when their faces meet within the crease angle, and each corner takes
+     * the normal of its group, so the corners of one vertex differ where a hard edge passes through it.
+     * Each triangle contributes its face normal weighted by the angle of its corner at the vertex, which keeps the
+     * result independent of how a surface is tessellated.
+     */
+    void generateSmoothNormals(const glm::vec3* positions, GLuint numVertices, const GLuint* indices, size_t numIndices, GLfloat creaseAngle, std::vector<glm::vec3>& cornerNormals);
+
+    /**
+     * @brief computes per vertex tangents from the texture coordinate gradients of an indexed triangle mesh
+     * @param positions vertex positions
+     * @param normals vertex normals
+     * @param texCoords vertex texture coordinates
+     * @param numVertices number of vertices
+     * @param indices triangle list indices
+     * @param numIndices number of indices
+     * @param tangents set to the tangent of each vertex, w holds the handedness of the bitangent
+     * @note follows MikkTSpace in weighting each triangle by the angle of its corner and orthogonalizing the result
+     * against the vertex normal, the bitangent is cross(normal, tangent.xyz) * tangent.w.  Vertices without usable
+     * texture coordinates receive an arbitrary tangent perpendicular to their normal.
+     */
+    void generateTangents(const glm::vec3* positions, const glm::vec3* normals, const glm::vec2* texCoords, GLuint numVertices, const GLuint* indices, size_t numIndices, glm::vec4* tangents);
+
+    /**
+     * @brief lists the corners of an indexed triangle mesh grouped by a key of the vertex at each corner
+     * @param vertexKeys key of each vertex, less than numKeys
+     * @param numKeys number of distinct keys
+     * @param indices triangle list indices
+     * @param numIndices number of indices
+     * @param offsets resized to numKeys + 1, the corners with key k are corners[offsets[k]] through corners[offsets[k+1]-1]
+     * @param corners resized to numIndices, filled with corner numbers in increasing order within each key
+     */
+    void groupCornersByKey(const GLuint* vertexKeys, GLuint numKeys, const GLuint* indices, size_t numIndices, std::vector<size_t>& offsets, std::vector<GLuint>& corners);
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // mesh optimization
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief vertex cache efficiency of a triangle list
+     */
+    struct VertexCacheStatistics {
+        /**
+         * @brief average cache miss ratio, vertices transformed per triangle (0.5 is ideal, 3.0 is worst)
+         */
+        GLfloat acmr = 0.0f;
+        /**
+         * @brief average transform to vertex ratio, vertices transformed per vertex referenced (1.0 is ideal)
+         */
+        GLfloat atvr = 0.0f;
+    };
+
+    /**
+     * @brief simulates a FIFO post-transform cache over a triangle list
+     * @param indices triangle list
+     * @param numIndices number of indices in the list
+     * @param numVertices number of vertices the list indexes
+     * @param cacheSize number of entries in the simulated cache
+     * @return miss ratios of the list
+     */
+    VertexCacheStatistics analyzeVertexCache(const GLuint* indices, size_t numIndices, GLuint numVertices, GLuint cacheSize = 16);
+
+    /**
+     * @brief reorders the triangles of a triangle list for post-transform cache reuse
+     * @param indices triangle list, reordered in place
+     * @param numIndices number of indices in the list
+     * @param numVertices number of vertices the list indexes
+     * @note implements Tom Forsyth's linear-speed vertex cache optimization
+     */
+    void optimizeVertexCache(GLuint* indices, size_t numIndices, GLuint numVertices);
+
+    /**
+     * @brief reorders clusters of a cache optimized triangle list so outward facing clusters draw first
+     * @param indices triangle list already optimized with optimizeVertexCache(), reordered in place
+     * @param numIndices number of indices in the list
+     * @param positions vertex positions the list indexes
+     * @param numVertices number of vertices the list indexes
+     * @note clusters are the runs between points where the simulated cache misses every vertex of a
+     * triangle, so the cache efficiency within each cluster is preserved
+     */
+    void optimizeOverdraw(GLuint* indices, size_t numIndices, const glm::vec3* positions, GLuint numVertices);
+
+    /**
+     * @brief computes the order vertices are first used in by a triangle list
+     * @param indices triangle list, rewritten to use the new vertex order
+     * @param numIndices number of indices in the list
+     * @param numVertices number of vertices the list indexes
+     * @return new position of each vertex, unreferenced vertices are moved after all referenced ones
+     */
+    std::vector<GLuint> optimizeVertexFetch(GLuint* indices, size_t numIndices, GLuint numVertices);
+
+    /**
+     * @brief contiguous cluster of triangles within the index buffer with bounds for culling
+     */
+    struct Meshlet {
+        /**
+         * @brief first index of the meshlet within the index array
+         */
+        GLuint indexStart = 0;
+        /**
+         * @brief number of indices in the meshlet, three per triangle
+         */
+        GLuint numIndices = 0;
+        /**
+         * @brief number of unique vertices the meshlet references
+         */
+        GLuint numVertices = 0;
+        /**
+         * @brief center of the sphere bounding the meshlet
+         */
+        glm::vec3 center = {0.0f, 0.0f, 0.0f};
+        /**
+         * @brief radius of the sphere bounding the meshlet
+         */
+        GLfloat radius = 0.0f;
+        /**
+         * @brief average facing direction of the meshlet's triangles
+         */
+        glm::vec3 coneAxis = {0.0f, 0.0f, 0.0f};
+        /**
+         * @brief sine of the angle between the cone axis and the normal furthest from it
+         * @note the meshlet is entirely back facing when dot(center - eye, coneAxis) >= coneCutoff * length(center - eye) + radius,
+         * a cutoff of 1 can never be culled
+         */
+        GLfloat coneCutoff = 1.0f;
+    };
+
+    /**
+     * @brief splits a triangle list into meshlets, reordering triangles so each meshlet is contiguous
+     * @param indices triangle list, reordered in place
+     * @param numIndices number of indices in the list
+     * @param positions vertex positions the list indexes
+     * @param numVertices number of vertices the list indexes
+     * @param maxVertices most unique vertices a meshlet may reference
+     * @param maxTriangles most triangles a meshlet may contain
+     * @param indexOffset offset added to the index start of each meshlet
+     * @param meshlets meshlets are appended to the end of this list
+     * @note meshlets are grown from a seed triangle by adding the neighboring triangle that introduces the fewest new vertices
+     */
+    void buildMeshlets(GLuint* indices, size_t numIndices, const glm::vec3* positions, GLuint numVertices,
+                       GLuint maxVertices, GLuint maxTriangles, GLuint indexOffset, std::vector<Meshlet>& meshlets);
+
+    /**
+     * @brief quadric error metric, the sum of squared distances to a set of weighted planes
+     */
+    struct Quadric {
+        /**
+         * @brief upper triangle of the symmetric 3x3 matrix
+         */
+        double a00 = 0.0, a01 = 0.0, a02 = 0.0, a11 = 0.0, a12 = 0.0, a22 = 0.0;
+        /**
+         * @brief linear term
+         */
+        double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+        /**
+         * @brief constant term
+         */
+        double c = 0.0;
+        /**
+         * @brief total weight of the planes
+         */
+        double weight = 0.0;
+
+        /**
+         * @brief creates the quadric of the plane dot(normal, p) + distance = 0
+         * @param normal unit plane normal
+         * @param distance plane offset
+         * @param weight importance of the plane
+         * @return quadric measuring squared distance to the plane
+         */
+        static Quadric fromPlane(const glm::vec3& normal, GLfloat distance, double weight);
+        /**
+         * @brief accumulates another quadric
+         * @param OTHER quadric to add
+         * @return this quadric
+         */
+        Quadric& operator+=(const Quadric& OTHER);
+        /**
+         * @brief weighted sum of squared distances from a point to the planes
+         * @param p point to evaluate
+         * @return error at the point
+         */
+        [[nodiscard]] double evaluate(const glm::vec3& p) const;
+    };
+
+    /**
+     * @brief simplifies a triangle list by collapsing edges onto existing vertices
+     * @note vertices at the same position form one collapse unit so UV and normal seams stay closed, positions shared
+     * by triangles of different groups (materials) are locked, and open borders only collapse along themselves
+     */
+    class MeshSimplifier final {
+    public:
+        /**
+         * @brief prepares a triangle list for simplification
+         * @param positions vertex positions the list indexes
+         * @param numVertices number of vertices the list indexes
+         * @param indices triangle list
+         * @param numIndices number of indices in the list
+         * @param triangleGroups group of each triangle, positions used by more than one group are never moved
+         */
+        MeshSimplifier(const glm::vec3* positions, GLuint numVertices, const GLuint* indices, size_t numIndices, const GLuint* triangleGroups);
+
+        /**
+         * @brief collapses the cheapest edges until at most the target number of triangles remain
+         * @param targetTriangles triangle count to reduce to
+         * @return false if no further edge could be collapsed
+         */
+        bool simplify(size_t targetTriangles);
+
+        /**
+         * @brief current triangle list, indexing the original vertices
+         * @return triangle list
+         */
+        [[nodiscard]] const std::vector<GLuint>& indices() const noexcept { return _indices; }
+        /**
+         * @brief group of each triangle in the current list
+         * @return triangle groups
+         */
+        [[nodiscard]] const std::vector<GLuint>& triangleGroups() const noexcept { return _triangleGroups; }
+        /**
+         * @brief largest distance error introduced by a collapse so far
+         * @return error in object space units
+         */
+        [[nodiscard]] GLfloat error() const noexcept { return _error; }
+
+    private:
+        /**
+         * @brief marks a position that is never moved
+         */
+        static constexpr GLuint LOCKED = 0xFFFFFFFF;
+        /**
+         * @brief checks a collapse and finds the vertex each vertex at the source position collapses onto
+         * @param from position collapsed away
+         * @param to position collapsed onto
+         * @param targets target vertex of each vertex at the source position
+         * @return true if the collapse keeps seams closed and does not flip a triangle
+         */
+        bool _collapseTargets(GLuint from, GLuint to, std::vector<GLuint>& targets) const;
+        /**
+         * @brief rebuilds the triangles around each vertex after triangles were removed
+         */
+        void _buildAdjacency();
+
+        const glm::vec3* _positions;
+        std::vector<GLuint> _indices;
+        std::vector<GLuint> _triangleGroups;
+        // vertices grouped by position
+        std::vector<GLuint> _positionOfVertex;
+        std::vector<GLuint> _positionVertexOffsets;
+        std::vector<GLuint> _positionVertices;
+        std::vector<Quadric> _quadrics;
+        std::vector<GLuint> _positionGroup;
+        // triangles using each vertex
+        std::vector<GLuint> _adjacencyOffsets;
+        std::vector<GLuint> _adjacency;
+        GLfloat _error = 0.0f;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // obj types
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief material parameters of one draw as laid out in the std140 material uniform block
+     */
+    struct MaterialRecord {
+        /**
+         * @brief ambient color
+         */
+        glm::vec4 ambient;
+        /**
+         * @brief diffuse color
+         */
+        glm::vec4 diffuse;
+        /**
+         * @brief specular color
+         */
+        glm::vec4 specular;
+        /**
+         * @brief specular exponent
+         */
+        GLfloat shininess;
+        /**
+         * @brief pads the record to a multiple of 16 bytes
+         */
+        GLfloat padding[3];
+    };
+    static_assert(sizeof(MaterialRecord) == 64, "MaterialRecord must match the std140 layout");
+
+    /**
+     * @brief consecutive draws of a draw list that share a diffuse texture
+     */
+    struct DrawListGroup {
+        /**
+         * @brief diffuse texture of the draws, ModelMaterial::NO_TEXTURE if they have none
+         */
+        GLuint texture = 0;
+        /**
+         * @brief index of the first draw in the group
+         */
+        GLsizei firstDraw = 0;
+        /**
+         * @brief number of draws in the group
+         */
+        GLsizei numDraws = 0;
+        /**
+         * @brief byte offset of the material record of the first draw, a multiple of the uniform buffer offset alignment
+         */
+        GLintptr recordOffset = 0;
+        /**
+         * @brief number of bytes from recordOffset to the end of the material buffer
+         */
+        GLsizeiptr recordSize = 0;
+    };
+
+    /**
+     * @brief one draw as read by glMultiDrawElementsIndirect() from the draw indirect buffer
+     */
+    struct DrawElementsIndirectCommand {
+        /**
+         * @brief number of indices to draw
+         */
+        GLuint count;
+        /**
+         * @brief number of instances to draw
+         */
+        GLuint instanceCount;
+        /**
+         * @brief first index to draw, in indices rather than bytes
+         */
+        GLuint firstIndex;
+        /**
+         * @brief value added to every index
+         */
+        GLint baseVertex;
+        /**
+         * @brief first instance record the draw reads
+         */
+        GLuint baseInstance;
+    };
+    static_assert(sizeof(DrawElementsIndirectCommand) == 20, "DrawElementsIndirectCommand must match the layout glMultiDrawElementsIndirect() reads");
+
+    /**
+     * @brief attribute indices of a single face vertex as read from the file
+     */
+    struct OBJFaceVertex {
+        /**
+         * @brief bit set in relativeMask if the vertex index is relative to the start of the chunk
+         */
+        static constexpr GLubyte RELATIVE_VERTEX = 0x1;
+        /**
+         * @brief bit set in relativeMask if the texture coordinate index is relative to the start of the chunk
+         */
+        static constexpr GLubyte RELATIVE_TEX_COORD = 0x2;
+        /**
+         * @brief bit set in relativeMask if the normal index is relative to the start of the chunk
+         */
+        static constexpr GLubyte RELATIVE_NORMAL = 0x4;
+        /**
+         * @brief bit set in presentMask if the face vertex names a texture coordinate
+         */
+        static constexpr GLubyte HAS_TEX_COORD = 0x1;
+        /**
+         * @brief bit set in presentMask if the face vertex names a normal
+         */
+        static constexpr GLubyte HAS_NORMAL = 0x2;
+
+        /**
+         * @brief one-based vertex index, absolute or relative to the attributes preceding the chunk
+         */
+        GLint vertexIndex = 0;
+        /**
+         * @brief one-based texture coordinate index, absolute or relative to the attributes preceding the chunk
+         * @note a relative index may be zero or negative until the chunk offset is added, check presentMask
+         */
+        GLint texCoordIndex = 0;
+        /**
+         * @brief one-based normal index, absolute or relative to the attributes preceding the chunk
+         * @note a relative index may be zero or negative until the chunk offset is added, check presentMask
+         */
+        GLint normalIndex = 0;
+        /**
+         * @brief which of the indices must be offset by the number of attributes preceding the chunk
+         */
+        GLubyte relativeMask = 0;
+        /**
+         * @brief which of the optional indices the face vertex names
+         */
+        GLubyte presentMask = 0;
+    };
+
+    /**
+     * @brief a non-geometry line of an OBJ file that must be processed in file order
+     */
+    struct OBJDirective {
+        /**
+         * @brief kind of line encountered
+         */
+        enum class TYPE { MTLLIB, USEMTL, IGNORED };
+        /**
+         * @brief kind of line encountered
+         */
+        TYPE type;
+        /**
+         * @brief number of faces in the chunk that precede this line
+         */
+        size_t faceIndex;
+        /**
+         * @brief argument of the line (filename, material name) or the full ignored line
+         */
+        std::string_view text;
+    };
+
+    /**
+     * @brief everything parsed from a contiguous range of lines of an OBJ file
+     * @note chunks are filled independently and merged in file order afterward
+     */
+    struct OBJChunk {
+        /**
+         * @brief first character of the chunk
+         */
+        const char* begin = nullptr;
+        /**
+         * @brief one past the last character of the chunk
+         */
+        const char* end = nullptr;
+
+        /**
+         * @brief vertex positions in file order
+         */
+        std::vector<glm::vec3> vertices;
+        /**
+         * @brief vertex normals in file order
+         */
+        std::vector<glm::vec3> normals;
+        /**
+         * @brief vertex texture coordinates in file order
+         */
+        std::vector<glm::vec2> texCoords;
+        /**
+         * @brief vertices of every face stored back to back
+         */
+        std::vector<OBJFaceVertex> faceVertices;
+        /**
+         * @brief number of vertices of each face
+         */
+        std::vector<GLuint> faceSizes;
+        /**
+         * @brief material and ignored lines in file order
+         */
+        std::vector<OBJDirective> directives;
+
+        /**
+         * @brief number of object names declared
+         */
+        GLuint numObjects = 0;
+        /**
+         * @brief number of polygon groups declared
+         */
+        GLuint numGroups = 0;
+        /**
+         * @brief smallest vertex position in each dimension
+         */
+        glm::vec3 minDimension = {999999.f, 999999.f, 999999.f};
+        /**
+         * @brief largest vertex position in each dimension
+         */
+        glm::vec3 maxDimension = { -999999.f, -999999.f, -999999.f };
+        /**
+         * @brief set if a face vertex could not be parsed
+         */
+        bool malformed = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // ply types
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief encoding of the body of a PLY file
+     */
+    enum class PLY_FORMAT { ASCII, BINARY_LITTLE_ENDIAN, BINARY_BIG_ENDIAN };
+
+    /**
+     * @brief a single property declared on a PLY element
+     */
+    struct PLYProperty {
+        /**
+         * @brief scalar types a PLY property may be stored as
+         */
+        enum class TYPE { INT8, UINT8, INT16, UINT16, INT32, UINT32, FLOAT32, FLOAT64, UNKNOWN };
+
+        /**
+         * @brief name of the property
+         */
+        std::string name;
+        /**
+         * @brief type of the property, or of each list entry for list properties
+         */
+        TYPE type = TYPE::UNKNOWN;
+        /**
+         * @brief true if the property is a variable length list
+         */
+        bool isList = false;
+        /**
+         * @brief type of the list length that precedes a list property
+         */
+        TYPE countType = TYPE::UNKNOWN;
+        /**
+         * @brief byte offset of the property within a binary record of fixed size
+         */
+        size_t offset = 0;
+
+        /**
+         * @brief converts a PLY type name (both the int8 and char style names) into a type
+         * @param typeName name of the type
+         * @return matching type, UNKNOWN if the name is not recognized
+         */
+        static TYPE typeFromName(std::string_view typeName) noexcept;
+        /**
+         * @brief number of bytes a type occupies in a binary file
+         * @param type type to query
+         * @return size of the type in bytes
+         */
+        static size_t sizeOf(TYPE type) noexcept;
+        /**
+         * @brief largest value an integer type can hold, used to normalize colors
+         * @param type type to query
+         * @return maximum integer value, or one for floating point types
+         */
+        static double normalizationScale(TYPE type) noexcept;
+    };
+
+    /**
+     * @brief an element declared in a PLY header and its properties
+     */
+    struct PLYElement {
+        /**
+         * @brief name of the element
+         */
+        std::string name;
+        /**
+         * @brief number of records of this element in the body
+         */
+        size_t count = 0;
+        /**
+         * @brief properties of each record in declaration order
+         */
+        std::vector<PLYProperty> properties;
+        /**
+         * @brief number of bytes of one binary record, zero if a list property makes the size variable
+         */
+        size_t recordSize = 0;
+    };
+
+    /**
+     * @brief reads PLY property values from either an ASCII or binary body
+     */
+    class PLYReader final {
+    public:
+        /**
+         * @brief creates a reader over [begin, end)
+         * @param begin first byte of the body
+         * @param end one past the last byte of the body
+         * @param format encoding of the body
+         */
+        PLYReader(const char* begin, const char* end, PLY_FORMAT format) noexcept;
+
+        /**
+         * @brief reads the next value
+         * @param type type the value is stored as
+         * @param value set to the value read
+         * @return false if the body ended or the value could not be parsed
+         */
+        bool read(PLYProperty::TYPE type, double& value) noexcept;
+        /**
+         * @brief skips over the next value of a property, including every entry of a list
+         * @param property property to skip
+         * @return false if the body ended before the property was skipped
+         */
+        bool skip(const PLYProperty& property) noexcept;
+        /**
+         * @brief skips a number of binary records of fixed size
+         * @param numBytes number of bytes to skip
+         * @return false if fewer bytes remain in the body
+         */
+        bool skipBytes(size_t numBytes) noexcept;
+
+        /**
+         * @brief current read position
+         * @return pointer into the body
+         */
+        [[nodiscard]] const char* position() const noexcept { return _current; }
+        /**
+         * @brief number of bytes left in the body
+         * @return bytes remaining
+         */
+        [[nodiscard]] size_t remaining() const noexcept { return static_cast<size_t>(_end - _current); }
+        /**
+         * @brief true if binary values are stored in the opposite byte order of the host
+         * @return if values must have their bytes swapped when decoded
+         */
+        [[nodiscard]] bool swapsBytes() const noexcept { return _swapBytes; }
+
+        /**
+         * @brief decodes a single binary value
+         * @param bytes location of the value
+         * @param type type the value is stored as
+         * @param swapBytes true if the value is stored in the opposite byte order of the host
+         * @return the decoded value
+         */
+        static double decodeBinary(const char* bytes, PLYProperty::TYPE type, bool swapBytes) noexcept;
+
+    private:
+        const char* _current;
+        const char* _end;
+        PLY_FORMAT _format;
+        bool _swapBytes;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // texture cache
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief hashes a block of bytes with 64-bit FNV-1a
+     * @param data bytes to hash
+     * @param size number of bytes
+     * @param seed hash to continue from, chains the hash of several blocks
+     * @return hash of the bytes
+     */
+    [[nodiscard]] uint64_t hashBytes(const char* data, size_t size, uint64_t seed = 0xcbf29ce484222325ull) noexcept;
+
+    /**
+     * @brief fixed set of worker threads running queued tasks in submission order
+     */
+    class ThreadPool final {
+    public:
+        /**
+         * @brief starts the worker threads
+         * @param numThreads number of workers, at least one is started
+         */
+        explicit ThreadPool(unsigned numThreads);
+        /**
+         * @brief discards tasks that have not started and joins the workers
+         */
+        ~ThreadPool();
+
+        /**
+         * @brief do not allow pools to be copied
+         */
+        ThreadPool(const ThreadPool&) = delete;
+        /**
+         * @brief do not allow pools to be copied
+         */
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief queues a task to run on the next free worker
+         * @param task task to run
+         */
+        void submit(std::function<void()> task);
+
+        /**
+         * @brief process-wide pool that decodes texture images, one worker per hardware thread
+         * @return the texture decode pool, started on first use
+         */
+        static ThreadPool& textureDecodePool();
+
+    private:
+        void _run();
+
+        std::vector<std::thread> _workers;
+        std::deque< std::function<void()> > _tasks;
+        std::mutex _mutex;
+        std::condition_variable _tasksAvailable;
+        bool _stopping = false;
+    };
+
+    /**
+     * @brief image decoded from file, ready to upload as a texture
+     */
+    struct DecodedImage {
+        /**
+         * @brief decoded pixels, rows stored bottom to top
+         */
+        std::vector<unsigned char> pixels;
+        /**
+         * @brief image width in pixels
+         */
+        GLsizei width = 0;
+        /**
+         * @brief image height in pixels
+         */
+        GLsizei height = 0;
+        /**
+         * @brief pixel format of the tightly packed rows, GL_RGB for grey and RGB images or GL_RGBA
+         * for images with an alpha channel or mask
+         */
+        GLint format = GL_RGB;
+        /**
+         * @brief time spent decoding the image
+         */
+        double decodeMilliseconds = 0.0;
+    };
+
+    /**
+     * @brief identifies an image and the alpha mask combined with it by their contents
+     */
+    struct TextureCacheKey {
+        /**
+         * @brief hash of the image bytes chained with the mask bytes
+         */
+        uint64_t hash = 0;
+        /**
+         * @brief size in bytes of the image file
+         */
+        uint64_t imageSize = 0;
+        /**
+         * @brief size in bytes of the mask file, 0 without a mask
+         */
+        uint64_t maskSize = 0;
+
+        /**
+         * @brief keys are equal if their hashes and sizes are
+         * @param other key to compare to
+         * @return true if the keys are equal
+         */
+        bool operator==(const TextureCacheKey& other) const noexcept { return hash == other.hash && imageSize == other.imageSize && maskSize == other.maskSize; }
+    };
+
+    /**
+     * @brief hashes a TextureCacheKey for an unordered container
+     */
+    struct TextureCacheKeyHash {
+        /**
+         * @brief hashes a key
+         * @param key key to hash
+         * @return the content hash
+         */
+        size_t operator()(const TextureCacheKey& key) const noexcept { return static_cast<size_t>(key.hash); }
+    };
+
+    /**
+     * @brief texture shared by every model whose material names images with the same contents
+     */
+    struct TextureCacheEntry {
+        /**
+         * @brief encoded bytes of the image followed by those of its mask
+         * @note compared on every lookup, so images whose keys collide never share a texture
+         */
+        std::vector<char> contents;
+        /**
+         * @brief image being decoded, released once the texture is uploaded
+         * @note holds nullptr if the image could not be decoded
+         */
+        std::shared_future< std::shared_ptr<const DecodedImage> > image;
+        /**
+         * @brief texture handle, 0 until the image has been uploaded
+         */
+        GLuint handle = 0;
+    };
+
+    /**
+     * @brief process-wide textures keyed by the contents of the images they were decoded from
+     * @note safe to use from multiple threads, entries are only read or written while mutex() is held
+     */
+    class TextureCache final {
+    public:
+        /**
+         * @brief the cache shared by every model in the process
+         * @return process-wide texture cache
+         */
+        static TextureCache& instance();
+
+        /**
+         * @brief guards every entry of the cache
+         * @return mutex to hold while using the cache or its entries
+         */
+        std::mutex& mutex() noexcept { return _mutex; }
+        /**
+         * @brief looks up the texture for an image, adding an empty entry if the image has not been seen
+         * @param key content hash and sizes of the image and any alpha mask combined with it
+         * @param imageData key.imageSize encoded bytes of the image
+         * @param maskData key.maskSize encoded bytes of the mask, may be nullptr without a mask
+         * @return the entry for the image and true if it was just added and still needs to be decoded
+         * @note an entry is only returned if its bytes match, so a hash collision adds a separate entry
+         * @note mutex() must be held
+         */
+        std::pair<std::shared_ptr<TextureCacheEntry>, bool> findOrInsert(const TextureCacheKey& key, const char* imageData, const char* maskData);
+        /**
+         * @brief forgets every entry
+         * @return handles of the textures that had been uploaded
+         * @note mutex() must be held
+         */
+        std::vector<GLuint> clear();
+
+    private:
+        std::mutex _mutex;
+        std::unordered_map< TextureCacheKey, std::vector< std::shared_ptr<TextureCacheEntry> >, TextureCacheKeyHash > _entries;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // asynchronous loading
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief most bytes copied into a buffer by one step of an asynchronous upload
+     */
+    constexpr size_t ASYNC_UPLOAD_CHUNK_SIZE = 1 << 20;
+
+    /**
+     * @brief buffer data prepared off the GL thread, waiting to be uploaded
+     */
+    struct PendingBufferUpload {
+        /**
+         * @brief target to bind the buffer to
+         */
+        GLenum target = GL_ARRAY_BUFFER;
+        /**
+         * @brief buffer to upload to
+         */
+        GLuint buffer = 0;
+        /**
+         * @brief size to allocate the buffer storage with, 0 if the storage already exists
+         */
+        GLsizeiptr allocationSize = 0;
+        /**
+         * @brief byte offset into the buffer to copy the data to
+         */
+        GLintptr offset = 0;
+        /**
+         * @brief bytes to copy into the buffer
+         */
+        std::vector<char> data;
+        /**
+         * @brief bytes of data copied so far
+         */
+        size_t bytesUploaded = 0;
+        /**
+         * @brief set once the buffer storage has been allocated
+         */
+        bool allocated = false;
+    };
+
+    /**
+     * @brief cached texture waiting to be assigned to the materials of a model
+     */
+    struct PendingTexture {
+        /**
+         * @brief materials that use the texture as their diffuse map
+         */
+        std::vector<ModelMaterial*> materials;
+        /**
+         * @brief shared texture, may still be decoding
+         */
+        std::shared_ptr<TextureCacheEntry> entry;
+        /**
+         * @brief true if this model queued the decode of the image rather than finding it in the cache
+         */
+        bool isNewImage = false;
+    };
+
+    /**
+     * @brief loader options in effect for one load, copied from the ModelLoader settings when the load starts
+     * so that changing a setting never affects a load already in progress
+     */
+    struct LoadOptions {
+        /**
+         * @brief generate normals for models without them
+         */
+        bool autoGenNormals = false;
+        /**
+         * @brief largest angle in radians between faces that generated normals are smoothed across
+         */
+        GLfloat normalCreaseAngle = glm::radians( 60.0f );
+        /**
+         * @brief generate tangents
+         */
+        bool autoGenTangents = false;
+        /**
+         * @brief weld vertices within weldEpsilon
+         */
+        bool weldVertices = false;
+        /**
+         * @brief distance vertices are welded within
+         */
+        GLfloat weldEpsilon = 0.0f;
+        /**
+         * @brief buffer vertices interleaved
+         */
+        bool interleaveVertices = false;
+        /**
+         * @brief buffer vertices packed
+         */
+        bool packVertexAttributes = false;
+        /**
+         * @brief quantize packed positions to 16 bits
+         */
+        bool quantizePositions = false;
+        /**
+         * @brief encode packed normals and tangents octahedrally
+         */
+        bool octahedralNormals = false;
+        /**
+         * @brief store packed texture coordinates as normalized 16-bit values
+         */
+        bool unorm16TexCoords = false;
+        /**
+         * @brief reorder triangles and vertices for the vertex cache
+         */
+        bool optimizeVertexCache = false;
+        /**
+         * @brief sort triangle clusters to reduce overdraw
+         */
+        bool optimizeOverdraw = false;
+        /**
+         * @brief split material ranges into meshlets
+         */
+        bool buildMeshlets = false;
+        /**
+         * @brief most vertices a meshlet references
+         */
+        GLuint meshletMaxVertices = 64;
+        /**
+         * @brief most triangles a meshlet holds
+         */
+        GLuint meshletMaxTriangles = 124;
+        /**
+         * @brief generate levels of detail
+         */
+        bool buildLevelsOfDetail = false;
+        /**
+         * @brief number of levels of detail, including the full model
+         */
+        GLuint numLevelsOfDetail = 4;
+        /**
+         * @brief fraction of triangles each level keeps of the level before it
+         */
+        GLfloat levelOfDetailReduction = 0.5f;
+        /**
+         * @brief stream PLY and binary STL files into their buffers
+         */
+        bool streamLoad = false;
+        /**
+         * @brief staging memory a streamed load may use
+         */
+        size_t streamMemoryBudget = 256 << 20;
+        /**
+         * @brief arena to upload the model into, null to give the model its own buffers
+         */
+        CSCI441::GeometryArena* geometryArena = nullptr;
+    };
+
+    /**
+     * @brief progress of a model loading in the background
+     */
+    struct AsyncLoadState {
+        /**
+         * @brief thread parsing the model
+         */
+        std::thread worker;
+        /**
+         * @brief loader the worker parses into, only touched by the worker until parsed is set
+         * @note owned here rather than parsing into the loader itself so the loader may be moved while the worker runs.
+         * Its options are the snapshot taken when the load started.
+         */
+        std::unique_ptr<CSCI441::ModelLoader> staging;
+        /**
+         * @brief set by the worker once parsing has finished
+         */
+        std::atomic<bool> parsed{false};
+        /**
+         * @brief whether parsing succeeded, valid once parsed is set
+         */
+        bool succeeded = false;
+        /**
+         * @brief fulfilled once the model is ready to draw
+         */
+        std::promise<bool> result;
+        /**
+         * @brief next buffer upload to continue
+         */
+        size_t nextBufferUpload = 0;
+        /**
+         * @brief next texture to upload
+         */
+        size_t nextTexture = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // streaming
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief bytes of staging memory each streamed vertex uses: position, normal, texture coordinate, and color
+     */
+    constexpr size_t STREAMING_BYTES_PER_VERTEX = sizeof(glm::vec3) * 2 + sizeof(glm::vec2) + sizeof(glm::vec4);
+
+    /**
+     * @brief progress of a model being written to its buffers as the file is read
+     * @note vertices are written straight into the vertex buffer while indices are spilled to a
+     * temporary file until the index type, and so the size of the index buffer, is known
+     */
+    struct StreamingLoadState {
+        /**
+         * @brief creates an empty streaming state
+         */
+        StreamingLoadState() = default;
+        /**
+         * @brief closes the spilled index file
+         */
+        ~StreamingLoadState();
+        /**
+         * @brief do not allow the spilled index file to be copied
+         */
+        StreamingLoadState(const StreamingLoadState&) = delete;
+        /**
+         * @brief do not allow the spilled index file to be copied
+         */
+        StreamingLoadState& operator=(const StreamingLoadState&) = delete;
+
+        /**
+         * @brief number of vertices the vertex buffer holds
+         */
+        GLuint numVertices = 0;
+        /**
+         * @brief whether the vertex buffer holds a block of colors
+         */
+        bool hasColors = false;
+        /**
+         * @brief most vertices decoded before they are written to the vertex buffer
+         */
+        size_t chunkVertices = 0;
+        /**
+         * @brief most indices decoded before they are spilled to the index file, a multiple of three
+         */
+        size_t chunkIndices = 0;
+        /**
+         * @brief temporary file the indices are spilled to
+         */
+        FILE* indexFile = nullptr;
+        /**
+         * @brief number of indices spilled so far
+         */
+        size_t numIndices = 0;
+        /**
+         * @brief smallest position streamed so far
+         */
+        glm::vec3 minimum = glm::vec3( std::numeric_limits<GLfloat>::max() );
+        /**
+         * @brief largest position streamed so far
+         */
+        glm::vec3 maximum = glm::vec3( std::numeric_limits<GLfloat>::lowest() );
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    // mesh cache types
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief extension of a mesh cache file, appended to the name of the model file it caches
+     */
+    constexpr const char* MESH_CACHE_EXTENSION = ".c441mesh";
+    /**
+     * @brief identifies a mesh cache file
+     */
+    constexpr char MESH_CACHE_MAGIC[8] = {'C', '4', '4', '1', 'M', 'S', 'H', '\0'};
+    /**
+     * @brief version of the mesh cache layout, caches of any other version are not loaded
+     */
+    constexpr uint32_t MESH_CACHE_VERSION = 6;
+    /**
+     * @brief written in host byte order so caches from a host of the other byte order are rejected
+     */
+    constexpr uint32_t MESH_CACHE_BYTE_ORDER_MARK = 0x01020304;
+    /**
+     * @brief alignment of each block within a mesh cache file
+     */
+    constexpr uint64_t MESH_CACHE_ALIGNMENT = 64;
+
+    /**
+     * @brief fixed size header at the start of a mesh cache file
+     * @note the vertex block holds positions, normals, texture coordinates, tangents, and optionally
+     * colors back to back in the same order as the model's vertex buffer, so it is uploaded with a single copy
+     */
+    struct MeshCacheHeader {
+        /**
+         * @brief attribute flags
+         */
+        enum : uint32_t { HAS_NORMALS = 1, HAS_TEX_COORDS = 2, HAS_COLORS = 4 };
+        /**
+         * @brief loader options that were enabled when the cached model was loaded
+         */
+        enum : uint32_t { AUTO_GEN_NORMALS = 1, AUTO_GEN_TANGENTS = 2, WELD_VERTICES = 4, OPTIMIZE_VERTEX_CACHE = 8, OPTIMIZE_OVERDRAW = 16 };
+
+        /**
+         * @brief must equal MESH_CACHE_MAGIC
+         */
+        char magic[8];
+        /**
+         * @brief must equal MESH_CACHE_VERSION
+         */
+        uint32_t version;
+        /**
+         * @brief must equal MESH_CACHE_BYTE_ORDER_MARK
+         */
+        uint32_t byteOrderMark;
+        /**
+         * @brief format of the model file the cache was created from
+         */
+        uint32_t modelType;
+        /**
+         * @brief attributes present on the model
+         */
+        uint32_t attributeFlags;
+        /**
+         * @brief loader options in effect when the model was loaded
+         */
+        uint32_t loadOptions;
+        /**
+         * @brief number of vertices
+         */
+        uint32_t numVertices;
+        /**
+         * @brief number of indices
+         */
+        uint32_t numIndices;
+        /**
+         * @brief number of entries in the material table
+         */
+        uint32_t numMaterials;
+        /**
+         * @brief number of materials with index ranges
+         */
+        uint32_t numMaterialRanges;
+        /**
+         * @brief epsilon vertices were welded within, 0 when vertices were not welded
+         */
+        float weldEpsilon;
+        /**
+         * @brief crease angle in radians normals were generated with, 0 when normals were not generated
+         */
+        float normalCreaseAngle;
+        /**
+         * @brief byte offset of the vertex block
+         */
+        uint64_t vertexDataOffset;
+        /**
+         * @brief byte size of the vertex block
+         */
+        uint64_t vertexDataSize;
+        /**
+         * @brief byte offset of the index block
+         */
+        uint64_t indexDataOffset;
+        /**
+         * @brief byte offset of the material table followed by the material index ranges
+         */
+        uint64_t materialDataOffset;
+        /**
+         * @brief byte size of the material table and index ranges
+         */
+        uint64_t materialDataSize;
+        /**
+         * @brief total size of the cache file
+         */
+        uint64_t fileSize;
+        /**
+         * @brief size in bytes of the model file the cache was created from
+         */
+        uint64_t sourceFileSize;
+        /**
+         * @brief modification time in nanoseconds since the epoch of the model file the cache was created from
+         */
+        int64_t sourceModificationTime;
+    };
+
+    /**
+     * @brief fixed size portion of a cached material, followed by its diffuse and alpha texture filenames
+     */
+    struct MeshCacheMaterial {
+        /**
+         * @brief ambient color
+         */
+        GLfloat ambient[4];
+        /**
+         * @brief diffuse color
+         */
+        GLfloat diffuse[4];
+        /**
+         * @brief specular color
+         */
+        GLfloat specular[4];
+        /**
+         * @brief emissive color
+         */
+        GLfloat emissive[4];
+        /**
+         * @brief specular exponent
+         */
+        GLfloat shininess;
+    };
+
+    /**
+     * @brief bounds checked reader over a block of binary data
+     */
+    struct BinaryCursor {
+        /**
+         * @brief current read position
+         */
+        const char* current;
+        /**
+         * @brief one past the last readable byte
+         */
+        const char* end;
+
+        /**
+         * @brief copies the next bytes out of the block
+         * @param destination location to copy to
+         * @param numBytes number of bytes to copy
+         * @return false if fewer bytes remain
+         */
+        bool read(void* destination, size_t numBytes) noexcept;
+        /**
+         * @brief reads a string stored as a 32-bit length followed by its characters
+         * @param value set to the string read
+         * @return false if the block ended before the string did
+         */
+        bool readString(std::string& value);
+    };
+
+    /**
+     * @brief parses a floating point value from the start of a token
+     * @param token text to parse
+     * @param value set to the parsed value, or zero if no number could be parsed
+     * @return true if a number was parsed
+     * @note uses std::from_chars when the standard library supports floating point conversion, otherwise falls back to strtof
+     */
+    bool parseFloat(std::string_view token, GLfloat& value) noexcept;
+    /**
+     * @brief parses a signed integer value from the start of a token
+     * @param token text to parse
+     * @param value set to the parsed value, or zero if no number could be parsed
+     * @return true if a number was parsed
+     */
+    bool parseInt(std::string_view token, GLint& value) noexcept;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+inline CSCI441_INTERNAL::MappedFile::~MappedFile() {
+    close();
+}
+
+inline bool CSCI441_INTERNAL::MappedFile::open(const char* filename) {
+    close();
+#ifdef _WIN32
+    _fileHandle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if( _fileHandle == INVALID_HANDLE_VALUE ) return false;
+
+    LARGE_INTEGER fileSize;
+    if( !GetFileSizeEx(_fileHandle, &fileSize) ) {
+        close();
+        return false;
+    }
+    _size = static_cast<size_t>(fileSize.QuadPart);
+
+    if( _size > 0 ) {
+        _mappingHandle = CreateFileMappingA(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if( _mappingHandle == nullptr ) {
+            close();
+            return false;
+        }
+        _data = static_cast<const char*>( MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0) );
+        if( _data == nullptr ) {
+            close();
+            return false;
+        }
+    }
+#else
+    const int fileDescriptor = ::open(filename, O_RDONLY);
+    if( fileDescriptor < 0 ) return false;
+
+    struct stat fileStats{};
+    if( fstat(fileDescriptor, &fileStats) != 0 || !S_ISREG(fileStats.st_mode) ) {
+        ::close(fileDescriptor);
+        return false;
+    }
+    _size = static_cast<size_t>(fileStats.st_size);
+
+    if( _size > 0 ) {
+        void* mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if( mapping == MAP_FAILED ) {
+            ::close(fileDescriptor);
+            _size = 0;
+            return false;
+        }
+        // files are parsed front to back, let the kernel read ahead aggressively
+        madvise(mapping, _size, MADV_SEQUENTIAL);
+        _data = static_cast<const char*>(mapping);
+    }
+    // the mapping remains valid after the descriptor is closed
+    ::close(fileDescriptor);
+#endif
+    _isOpen = true;
+    return true;
+}
+
+inline void CSCI441_INTERNAL::MappedFile::close() {
+#ifdef _WIN32
+    if( _data != nullptr ) UnmapViewOfFile(_data);
+    if( _mappingHandle != nullptr ) CloseHandle(_mappingHandle);
+    if( _fileHandle != INVALID_HANDLE_VALUE ) CloseHandle(_fileHandle);
+    _mappingHandle = nullptr;
+    _fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if( _data != nullptr ) munmap(const_cast<char*>(_data), _size);
+#endif
+    _data = nullptr;
+    _size = 0;
+    _isOpen = false;
+}
+
+inline void CSCI441_INTERNAL::MappedFile::discard(const size_t begin, const size_t end) const noexcept {
+    if( _data == nullptr ) return;
+#ifdef _WIN32
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    const size_t pageSize = systemInfo.dwPageSize;
+#else
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    // only whole pages can be released, the mapping itself starts on a page boundary
+    const size_t firstPage = (begin + pageSize - 1) / pageSize * pageSize;
+    const size_t lastPage = std::min(end, _size) / pageSize * pageSize;
+    if( lastPage <= firstPage ) return;
+#ifdef _WIN32
+    // unlocking pages that are not locked removes them from the working set
+    VirtualUnlock(const_cast<char*>(_data + firstPage), lastPage - firstPage);
+#else
+    madvise(const_cast<char*>(_data + firstPage), lastPage - firstPage, MADV_DONTNEED);
+#endif
+}
+
+inline bool CSCI441_INTERNAL::fileModificationTime(const char* filename, int64_t& modificationTime) noexcept {
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA fileAttributes;
+    if( !GetFileAttributesExA(filename, GetFileExInfoStandard, &fileAttributes) ) return false;
+    ULARGE_INTEGER writeTime;
+    writeTime.LowPart = fileAttributes.ftLastWriteTime.dwLowDateTime;
+    writeTime.HighPart = fileAttributes.ftLastWriteTime.dwHighDateTime;
+    // file times count 100ns intervals since 1601
+    modificationTime = (static_cast<int64_t>(writeTime.QuadPart) - 116444736000000000LL) * 100;
+#else
+    struct stat fileStats{};
+    if( stat(filename, &fileStats) != 0 ) return false;
+#ifdef __APPLE__
+    const timespec& writeTime = fileStats.st_mtimespec;
+#else
+    const timespec& writeTime = fileStats.st_mtim;
+#endif
+    modificationTime = static_cast<int64_t>(writeTime.tv_sec) * 1000000000LL + static_cast<int64_t>(writeTime.tv_nsec);
+#endif
+    return true;
+}
+
+inline bool CSCI441_INTERNAL::fileSize(const char* filename, size_t& size) noexcept {
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA fileAttributes;
+    if( !GetFileAttributesExA(filename, GetFileExInfoStandard, &fileAttributes) ) return false;
+    size = static_cast<size_t>( (static_cast<uint64_t>(fileAttributes.nFileSizeHigh) << 32) | fileAttributes.nFileSizeLow );
+#else
+    struct stat fileStats{};
+    if( stat(filename, &fileStats) != 0 ) return false;
+    size = static_cast<size_t>(fileStats.st_size);
+#endif
+    return true;
+}
+
+inline double CSCI441_INTERNAL::millisecondsSince(const std::chrono::steady_clock::time_point start) noexcept {
+    return std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start ).count();
+}
+
+inline void CSCI441_INTERNAL::resetPeakResidentSetSize() noexcept {
+#ifdef __linux__
+    // writing 5 to clear_refs resets the VmHWM high water mark to the current resident set
+    if( FILE* clearRefs = fopen("/proc/self/clear_refs", "w") ) {
+        fputs("5", clearRefs);
+        fclose(clearRefs);
+    }
+#endif
+}
+
+inline size_t CSCI441_INTERNAL::peakResidentSetSize() noexcept {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS memoryCounters;
+    if( !GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters)) ) return 0;
+    return static_cast<size_t>(memoryCounters.PeakWorkingSetSize);
+#elif defined(__linux__)
+    FILE* status = fopen("/proc/self/status", "r");
+    if( status == nullptr ) return 0;
+    char line[256];
+    size_t peakKilobytes = 0;
+    while( fgets(line, sizeof(line), status) != nullptr ) {
+        if( strncmp(line, "VmHWM:", 6) == 0 ) {
+            peakKilobytes = static_cast<size_t>( strtoull(line + 6, nullptr, 10) );
+            break;
+        }
+    }
+    fclose(status);
+    return peakKilobytes * 1024;
+#else
+    struct rusage usage{};
+    if( getrusage(RUSAGE_SELF, &usage) != 0 ) return 0;
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+inline glm::vec2 CSCI441_INTERNAL::octahedralEncode(const glm::vec3 direction) noexcept {
+    const GLfloat l1Norm = std::fabs(direction.x) + std::fabs(direction.y) + std::fabs(direction.z);
+    if( l1Norm == 0.0f ) return { 0.0f, 0.0f };
+    const glm::vec3 octant = direction / l1Norm;
+    if( octant.z >= 0.0f ) return { octant.x, octant.y };
+    // fold the lower hemisphere over the diagonals of the square
+    return { (1.0f - std::fabs(octant.y)) * (octant.x >= 0.0f ? 1.0f : -1.0f),
+             (1.0f - std::fabs(octant.x)) * (octant.y >= 0.0f ? 1.0f : -1.0f) };
+}
+
+inline glm::vec3 CSCI441_INTERNAL::octahedralDecode(const glm::vec2 encoded) noexcept {
+    glm::vec3 direction( encoded.x, encoded.y, 1.0f - std::fabs(encoded.x) - std::fabs(encoded.y) );
+    if( direction.z < 0.0f ) {
+        direction.x = (1.0f - std::fabs(encoded.y)) * (encoded.x >= 0.0f ? 1.0f : -1.0f);
+        direction.y = (1.0f - std::fabs(encoded.x)) * (encoded.y >= 0.0f ? 1.0f : -1.0f);
+    }
+    const GLfloat length = std::sqrt( direction.x * direction.x + direction.y * direction.y + direction.z * direction.z );
+    return direction / length;
+}
+
+inline void CSCI441_INTERNAL::TextCursor::skipBlanks() noexcept {
+    while( current < end && (*current == ' ' || *current == '\t') ) ++current;
+}
+
+inline void CSCI441_INTERNAL::TextCursor::skipLine() noexcept {
+    if( current >= end ) return;
+    const auto newLine = static_cast<const char*>( memchr(current, '\n', static_cast<size_t>(end - current)) );
+    current = (newLine != nullptr ? newLine + 1 : end);
+}
+
+inline std::string_view CSCI441_INTERNAL::TextCursor::nextToken() noexcept {
+    skipBlanks();
+    const char* tokenStart = current;
+    while( current < end && *current != ' ' && *current != '\t' && *current != '\n' && *current != '\r' ) ++current;
+    return { tokenStart, static_cast<size_t>(current - tokenStart) };
+}
+
+inline std::string_view CSCI441_INTERNAL::TextCursor::restOfLine() noexcept {
+    skipBlanks();
+    const char* lineStart = current;
+    while( current < end && *current != '\n' ) ++current;
+    const char* lineEnd = current;
+    while( lineEnd > lineStart && (lineEnd[-1] == ' ' || lineEnd[-1] == '\t' || lineEnd[-1] == '\r') ) --lineEnd;
+    return { lineStart, static_cast<size_t>(lineEnd - lineStart) };
+}
+
+inline CSCI441_INTERNAL::VertexIndexTable::VertexIndexTable(const size_t expectedSize) {
+    // keep the load factor at or below one half
+    size_t capacity = 16;
+    while( capacity < expectedSize * 2 ) capacity <<= 1;
+    _entries.resize(capacity);
+}
+
+inline std::pair<GLuint, bool> CSCI441_INTERNAL::VertexIndexTable::insert(const GLuint vertexIndex, const GLuint texCoordIndex, const GLuint normalIndex, const GLuint newIndex) {
+    if( (_size + 1) * 10 > _entries.size() * 7 ) _rehash(_entries.size() * 2);
+
+    const size_t mask = _entries.size() - 1;
+    for( size_t slot = _hash(vertexIndex, texCoordIndex, normalIndex) & mask; ; slot = (slot + 1) & mask ) {
+        Entry& entry = _entries[slot];
+        if( entry.vertexIndex == 0 ) {
+            entry = { vertexIndex, texCoordIndex, normalIndex, newIndex };
+            _size++;
+            return { newIndex, true };
+        }
+        if( entry.vertexIndex == vertexIndex && entry.texCoordIndex == texCoordIndex && entry.normalIndex == normalIndex ) {
+            return { entry.index, false };
+        }
+    }
+}
+
+inline void CSCI441_INTERNAL::VertexIndexTable::clear() {
+    std::vector<Entry>(16).swap(_entries);
+    _size = 0;
+}
+
+inline size_t CSCI441_INTERNAL::VertexIndexTable::_hash(const GLuint vertexIndex, const GLuint texCoordIndex, const GLuint normalIndex) noexcept {
+    // multiply-xorshift mix of the 96-bit key, consecutive indices land far apart
+    uint64_t key = (static_cast<uint64_t>(vertexIndex) << 32) | texCoordIndex;
+    key ^= static_cast<uint64_t>(normalIndex) * 0x9E3779B97F4A7C15ull;
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDull;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ull;
+    key ^= key >> 33;
+    return static_cast<size_t>(key);
+}
+
+inline void CSCI441_INTERNAL::VertexIndexTable::_rehash(const size_t capacity) {
+    std::vector<Entry> oldEntries(capacity);
+    oldEntries.swap(_entries);
+
+    const size_t mask = _entries.size() - 1;
+    for( const Entry& entry : oldEntries ) {
+        if( entry.vertexIndex == 0 ) continue;
+        size_t slot = _hash(entry.vertexIndex, entry.texCoordIndex, entry.normalIndex) & mask;
+        while( _entries[slot].vertexIndex != 0 ) slot = (slot + 1) & mask;
+        _entries[slot] = entry;
+    }
+}
+
+inline CSCI441_INTERNAL::VertexWeldTable::VertexWeldTable(const size_t expectedSize, const GLfloat epsilon) : _epsilon(epsilon) {
+    size_t capacity = 16;
+    while( capacity < expectedSize * 2 ) capacity <<= 1;
+    _entries.resize(capacity);
+}
+
+inline std::pair<GLuint, bool> CSCI441_INTERNAL::VertexWeldTable::insert(const glm::vec3& position, const glm::vec3& normal, const glm::vec2& texCoord, const glm::vec4& color, const GLuint newIndex) {
+    if( (_size + 1) * 10 > _entries.size() * 7 ) _rehash(_entries.size() * 2);
+
+    const size_t mask = _entries.size() - 1;
+    Entry newEntry{ position, normal, texCoord, color, {0, 0, 0}, newIndex };
+
+    if( _epsilon <= 0.0f ) {
+        size_t slot = _hash(position) & mask;
+        for( ; _entries[slot].index != EMPTY; slot = (slot + 1) & mask ) {
+            const Entry& entry = _entries[slot];
+            if( entry.position == position && entry.normal == normal && entry.texCoord == texCoord && entry.color == color ) {
+                return { entry.index, false };
+            }
+        }
+        _entries[slot] = newEntry;
+        _size++;
+        return { newIndex, true };
+    }
+
+    // a match within epsilon can only lie in the cell of the position or one of its 26 neighbors
+    _cellOf(position, newEntry.cell);
+    for( int64_t dz = -1; dz <= 1; dz++ ) {
+        for( int64_t dy = -1; dy <= 1; dy++ ) {
+            for( int64_t dx = -1; dx <= 1; dx++ ) {
+                const int64_t neighbor[3] = { newEntry.cell[0] + dx, newEntry.cell[1] + dy, newEntry.cell[2] + dz };
+                for( size_t slot = _hashCell(neighbor) & mask; _entries[slot].index != EMPTY; slot = (slot + 1) & mask ) {
+                    const Entry& entry = _entries[slot];
+                    if( entry.cell[0] != neighbor[0] || entry.cell[1] != neighbor[1] || entry.cell[2] != neighbor[2] ) continue;
+                    const glm::vec3 offset = glm::abs( entry.position - position );
+                    if( offset.x <= _epsilon && offset.y <= _epsilon && offset.z <= _epsilon
+                        && entry.normal == normal && entry.texCoord == texCoord && entry.color == color ) {
+                        return { entry.index, false };
+                    }
+                }
+            }
+        }
+    }
+
+    size_t slot = _hashCell(newEntry.cell) & mask;
+    while( _entries[slot].index != EMPTY ) slot = (slot + 1) & mask;
+    _entries[slot] = newEntry;
+    _size++;
+    return { newIndex, true };
+}
+
+inline void CSCI441_INTERNAL::VertexWeldTable::_cellOf(const glm::vec3& position, int64_t cell[3]) const noexcept {
+    for( int axis = 0; axis < 3; axis++ ) {
+        cell[axis] = static_cast<int64_t>( std::floor( static_cast<double>(position[axis]) / _epsilon ) );
+    }
+}
+
+inline size_t CSCI441_INTERNAL::VertexWeldTable::_slotOf(const Entry& entry) const noexcept {
+    return _epsilon <= 0.0f ? _hash(entry.position) : _hashCell(entry.cell);
+}
+
+inline size_t CSCI441_INTERNAL::VertexWeldTable::_hash(const glm::vec3& position) noexcept {
+    // hash the bit patterns, adding zero folds -0.0 onto 0.0 so they compare and hash alike
+    uint32_t bits[3];
+    const glm::vec3 folded = position + glm::vec3(0.0f);
+    memcpy(bits, &folded[0], sizeof(bits));
+    uint64_t key = (static_cast<uint64_t>(bits[0]) << 32) | bits[1];
+    key ^= static_cast<uint64_t>(bits[2]) * 0x9E3779B97F4A7C15ull;
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDull;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ull;
+    key ^= key >> 33;
+    return static_cast<size_t>(key);
+}
+
+inline size_t CSCI441_INTERNAL::VertexWeldTable::_hashCell(const int64_t cell[3]) noexcept {
+    uint64_t key = static_cast<uint64_t>(cell[0]) * 0x9E3779B97F4A7C15ull;
+    key ^= static_cast<uint64_t>(cell[1]) * 0xC2B2AE3D27D4EB4Full;
+    key ^= static_cast<uint64_t>(cell[2]) * 0x165667B19E3779F9ull;
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDull;
+    key ^= key >> 33;
+    return static_cast<size_t>(key);
+}
+
+inline void CSCI441_INTERNAL::VertexWeldTable::_rehash(const size_t capacity) {
+    std::vector<Entry> oldEntries(capacity);
+    oldEntries.swap(_entries);
+
+    const size_t mask = _entries.size() - 1;
+    for( const Entry& entry : oldEntries ) {
+        if( entry.index == EMPTY ) continue;
+        size_t slot = _slotOf(entry) & mask;
+        while( _entries[slot].index != EMPTY ) slot = (slot + 1) & mask;
+        _entries[slot] = entry;
+    }
+}
+
+inline void CSCI441_INTERNAL::findRedundantTriangles(const GLuint* indices, const size_t numIndices, const glm::vec3* positions, std::vector<bool>& keep, GLuint& numDegenerate, GLuint& numDuplicate) {
+    const size_t numTriangles = numIndices / 3;
+    keep.assign(numTriangles, true);
+    numDegenerate = numDuplicate = 0;
+
+    // triangles are keyed on their vertices rotated to start at the smallest index, which preserves the winding
+    VertexIndexTable seenTriangles(numTriangles);
+    for( size_t t = 0; t < numTriangles; t++ ) {
+        const GLuint a = indices[3*t], b = indices[3*t + 1], c = indices[3*t + 2];
+        if( a == b || b == c || a == c
+            || glm::cross( positions[b] - positions[a], positions[c] - positions[a] ) == glm::vec3(0.0f) ) {
+            keep[t] = false;
+            numDegenerate++;
+            continue;
+        }
+
+        GLuint rotated[3] = { a, b, c };
+        const int first = (b < a && b < c) ? 1 : ((c < a && c < b) ? 2 : 0);
+        std::rotate( rotated, rotated + first, rotated + 3 );
+        // the table reserves a first key of zero for empty slots
+        if( !seenTriangles.insert( rotated[0] + 1, rotated[1], rotated[2], static_cast<GLuint>(t) ).second ) {
+            keep[t] = false;
+            numDuplicate++;
+        }
+    }
+}
+
+inline void CSCI441_INTERNAL::parallelFor(const size_t count, const size_t minItemsPerThread, const std::function<void(size_t, size_t)>& body) {
+    const size_t hardwareThreads = std::max( 1u, std::thread::hardware_concurrency() );
+    const size_t numThreads = std::min( hardwareThreads, count / std::max<size_t>( minItemsPerThread, 1 ) + 1 );
+    const size_t rangeSize = (count + numThreads - 1) / numThreads;
+
+    std::vector<std::thread> workers;
+    for( size_t i = 1; i < numThreads; i++ ) {
+        const size_t begin = std::min( count, rangeSize * i );
+        const size_t end = std::min( count, begin + rangeSize );
+        if( begin < end ) workers.emplace_back( body, begin, end );
+    }
+    body( 0, std::min( count, rangeSize ) );
+    for( auto& worker : workers ) {
+        worker.join();
+    }
+}
+
+inline void CSCI441_INTERNAL::groupCornersByKey(const GLuint* vertexKeys, const GLuint numKeys, const GLuint* indices, const size_t numIndices, std::vector<size_t>& offsets, std::vector<GLuint>& corners) {
+    offsets.assign( static_cast<size_t>(numKeys) + 1, 0 );
+    for( size_t i = 0; i < numIndices; i++ ) {
+        offsets[ vertexKeys[ indices[i] ] + 1 ]++;
+    }
+    for( GLuint k = 0; k < numKeys; k++ ) {
+        offsets[k + 1] += offsets[k];
+    }
+    std::vector<size_t> next( offsets.begin(), offsets.end() - 1 );
+    corners.resize( numIndices );
+    for( size_t i = 0; i < numIndices; i++ ) {
+        corners[ next[ vertexKeys[ indices[i] ] ]++ ] = static_cast<GLuint>(i);
+    }
+}
+
+inline void CSCI441_INTERNAL::generateSmoothNormals(const glm::vec3* positions, const GLuint numVertices, const GLuint* indices, const size_t numIndices, const GLfloat creaseAngle, std::vector<glm::vec3>& cornerNormals) {
+    const size_t numTriangles = numIndices / 3;
+
+    // vertices split only by texture coordinate share the normal of their position
+    // sorting copies of the positions keeps the comparisons in cache
+    std::vector< std::pair<glm::vec3, GLuint> > order( numVertices );
+    for( GLuint i = 0; i < numVertices; i++ ) order[i] = { positions[i], i };
+    std::sort( order.begin(), order.end(), [](const std::pair<glm::vec3, GLuint>& a, const std::pair<glm::vec3, GLuint>& b) {
+        if( a.first.x != b.first.x ) return a.first.x < b.first.x;
+        if( a.first.y != b.first.y ) return a.first.y < b.first.y;
+        return a.first.z < b.first.z;
+    } );
+    std::vector<GLuint> positionClass( numVertices );
+    GLuint numClasses = 0;
+    for( GLuint i = 0; i < numVertices; i++ ) {
+        if( i > 0 && order[i].first != order[i - 1].first ) numClasses++;
+        positionClass[ order[i].second ] = numClasses;
+    }
+    if( numVertices > 0 ) numClasses++;
+
+    // each corner contributes the unit face normal scaled by its angle
+    std::vector<glm::vec3> weightedNormals( numTriangles * 3 ), faceNormals( numTriangles );
+    parallelFor( numTriangles, ATTRIBUTE_GENERATION_MIN_ITEMS_PER_THREAD, [&](const size_t begin, const size_t end) {
+        for( size_t t = begin; t < end; t++ ) {
+            const glm::vec3 p[3] = { positions[ indices[t*3] ], positions[ indices[t*3 + 1] ], positions[ indices[t*3 + 2] ] };
+            const glm::vec3 faceNormal = glm::cross( p[1] - p[0], p[2] - p[0] );
+            const GLfloat faceLength = glm::length( faceNormal );
+            faceNormals[t] = faceLength > 0.0f ? faceNormal / faceLength : glm::vec3( 0.0f );
+            for( GLuint c = 0; c < 3; c++ ) {
+                const glm::vec3 e1 = p[(c + 1) % 3] - p[c];
+                const glm::vec3 e2 = p[(c + 2) % 3] - p[c];
+                const GLfloat lengths = glm::length( e1 ) * glm::length( e2 );
+                const GLfloat angle = lengths > 0.0f ? std::acos( glm::clamp( glm::dot( e1, e2 ) / lengths, -1.0f, 1.0f ) ) : 0.0f;
+                weightedNormals[t*3 + c] = faceNormals[t] * angle;
+            }
+        }
+    } );
+
+    // gather the corners of every position rather than scatter into it so no two threads write the same normal
+    std::vector<size_t> offsets;
+    std::vector<GLuint> corners;
+    groupCornersByKey( positionClass.data(), numClasses, indices, numTriangles * 3, offsets, corners );
+    const GLfloat minCosine = std::cos( glm::clamp( creaseAngle, 0.0f, glm::pi<GLfloat>() ) );
+    const bool smoothsEverything = creaseAngle >= glm::pi<GLfloat>();
+    cornerNormals.assign( numIndices, glm::vec3( 0.0f ) );
+    parallelFor( numClasses, ATTRIBUTE_GENERATION_MIN_ITEMS_PER_THREAD, [&](const size_t begin, const size_t end) {
+        // the corners around one position are split into crease groups, each a fan of triangles joined across
+        // shared edges whose faces meet within the crease angle, so the work is linear in the valence
+        std::vector< std::pair<GLuint, GLuint> > edges;
+        std::vector<GLuint> groups;
+        std::vector<glm::vec3> groupSums;
+        const auto findGroup = [&groups](GLuint corner) {
+            while( groups[corner] != corner ) {
+                groups[corner] = groups[ groups[corner] ];
+                corner = groups[corner];
+            }
+            return corner;
+        };
+
+        for( size_t k = begin; k < end; k++ ) {
+            const size_t first = offsets[k];
+            const auto valence = static_cast<GLuint>(offsets[k + 1] - first);
+            glm::vec3 positionSum( 0.0f );
+            for( size_t i = first; i < offsets[k + 1]; i++ ) {
+                positionSum += weightedNormals[ corners[i] ];
+            }
+            const GLfloat positionLength = glm::length( positionSum );
+            const glm::vec3 positionNormal = positionLength > 0.0f ? positionSum / positionLength : glm::vec3( 0.0f );
+            if( smoothsEverything ) {
+                for( size_t i = first; i < offsets[k + 1]; i++ ) cornerNormals[ corners[i] ] = positionNormal;
+                continue;
+            }
+
+            // each corner has an edge to the positions of the other two corners of its triangle
+            edges.clear();
+            for( GLuint c = 0; c < valence; c++ ) {
+                const GLuint corner = corners[first + c], triangle = corner / 3;
+                edges.emplace_back( positionClass[ indices[triangle*3 + (corner + 1) % 3] ], c );
+                edges.emplace_back( positionClass[ indices[triangle*3 + (corner + 2) % 3] ], c );
+            }
+            std::sort( edges.begin(), edges.end() );
+
+            groups.resize( valence );
+            for( GLuint c = 0; c < valence; c++ ) groups[c] = c;
+            for( size_t runStart = 0, runEnd; runStart < edges.size(); runStart = runEnd ) {
+                runEnd = runStart + 1;
+                while( runEnd < edges.size() && edges[runEnd].first == edges[runStart].first ) runEnd++;
+                // an edge is almost always shared by two triangles, only non-manifold edges have longer runs,
+                // degenerate triangles join nothing so they cannot bridge a crease
+                for( size_t a = runStart; a < runEnd; a++ ) {
+                    const glm::vec3& faceA = faceNormals[ corners[first + edges[a].second] / 3 ];
+                    if( faceA == glm::vec3( 0.0f ) ) continue;
+                    for( size_t b = a + 1; b < runEnd; b++ ) {
+                        const glm::vec3& faceB = faceNormals[ corners[first + edges[b].second] / 3 ];
+                        if( faceB != glm::vec3( 0.0f ) && glm::dot( faceA, faceB ) >= minCosine ) groups[ findGroup( edges[a].second ) ] = findGroup( edges[b].second );
+                    }
+                }
+            }
+
+            groupSums.assign( valence, glm::vec3( 0.0f ) );
+            for( GLuint c = 0; c < valence; c++ ) {
+                groupSums[ findGroup( c ) ] += weightedNormals[ corners[first + c] ];
+            }
+            for( GLuint c = 0; c < valence; c++ ) {
+                // degenerate triangles have no face to crease against and take the normal of the position
+                const glm::vec3& faceNormal = faceNormals[ corners[first + c] / 3 ];
+                if( faceNormal == glm::vec3( 0.0f ) ) {
+                    cornerNormals[ corners[first + c] ] = positionNormal;
+                    continue;
+                }
+                const glm::vec3& sum = groupSums[ findGroup( c ) ];
+                const GLfloat length = glm::length( sum );
+                cornerNormals[ corners[first + c] ] = length > 0.0f ? sum / length : faceNormal;
+            }
+        }
+    } );
+}
+
+inline void CSCI441_INTERNAL::generateTangents(const glm::vec3* positions, const glm::vec3* normals, const glm::vec2* texCoords, const GLuint numVertices, const GLuint* indices, const size_t numIndices, glm::vec4* tangents) {
+    const size_t numTriangles = numIndices / 3;
+
+    // tangent and bitangent of each corner, weighted by its angle
+    std::vector<glm::vec3> cornerTangents( numTriangles * 3 ), cornerBitangents( numTriangles * 3 );
+    parallelFor( numTriangles, ATTRIBUTE_GENERATION_MIN_ITEMS_PER_THREAD, [&](const size_t begin, const size_t end) {
+        for( size_t t = begin; t < end; t++ ) {
+            const GLuint v[3] = { indices[t*3], indices[t*3 + 1], indices[t*3 + 2] };
+            const glm::vec3 e1 = positions[v[1]] - positions[v[0]];
+            const glm::vec3 e2 = positions[v[2]] - positions[v[0]];
+            const glm::vec2 duv1 = texCoords[v[1]] - texCoords[v[0]];
+            const glm::vec2 duv2 = texCoords[v[2]] - texCoords[v[0]];
+            const GLfloat determinant = duv1.x * duv2.y - duv2.x * duv1.y;
+
+            // triangles with no texture coordinate area have no defined tangent and contribute nothing
+            glm::vec3 tangent( 0.0f ), bitangent( 0.0f );
+            if( std::fabs( determinant ) > 1e-12f ) {
+                tangent = (e1 * duv2.y - e2 * duv1.y) / determinant;
+                bitangent = (e2 * duv1.x - e1 * duv2.x) / determinant;
+                const GLfloat tangentLength = glm::length( tangent ), bitangentLength = glm::length( bitangent );
+                tangent = tangentLength > 0.0f ? tangent / tangentLength : glm::vec3( 0.0f );
+                bitangent = bitangentLength > 0.0f ? bitangent / bitangentLength : glm::vec3( 0.0f );
+            }
+            for( GLuint c = 0; c < 3; c++ ) {
+                const glm::vec3 a = positions[ v[(c + 1) % 3] ] - positions[ v[c] ];
+                const glm::vec3 b = positions[ v[(c + 2) % 3] ] - positions[ v[c] ];
+                const GLfloat lengths = glm::length( a ) * glm::length( b );
+                const GLfloat angle = lengths > 0.0f ? std::acos( glm::clamp( glm::dot( a, b ) / lengths, -1.0f, 1.0f ) ) : 0.0f;
+                cornerTangents[t*3 + c] = tangent * angle;
+                cornerBitangents[t*3 + c] = bitangent * angle;
+            }
+        }
+    } );
+
+    std::vector<GLuint> vertexKeys( numVertices );
+    for( GLuint i = 0; i < numVertices; i++ ) vertexKeys[i] = i;
+    std::vector<size_t> offsets;
+    std::vector<GLuint> corners;
+    groupCornersByKey( vertexKeys.data(), numVertices, indices, numTriangles * 3, offsets, corners );
+
+    parallelFor( numVertices, ATTRIBUTE_GENERATION_MIN_ITEMS_PER_THREAD, [&](const size_t begin, const size_t end) {
+        for( size_t v = begin; v < end; v++ ) {
+            glm::vec3 tangent( 0.0f ), bitangent( 0.0f );
+            for( size_t i = offsets[v]; i < offsets[v + 1]; i++ ) {
+                tangent += cornerTangents[ corners[i] ];
+                bitangent += cornerBitangents[ corners[i] ];
+            }
+
+            // Gram-Schmidt against the normal, falling back to any perpendicular direction
+            const GLfloat normalLength = glm::length( normals[v] );
+            const glm::vec3 normal = normalLength > 0.0f ? normals[v] / normalLength : glm::vec3( 0.0f, 0.0f, 1.0f );
+            tangent -= normal * glm::dot( normal, tangent );
+            GLfloat length = glm::length( tangent );
+            if( length <= 1e-6f ) {
+                const glm::vec3 axis = std::fabs( normal.x ) < 0.9f ? glm::vec3( 1.0f, 0.0f, 0.0f ) : glm::vec3( 0.0f, 1.0f, 0.0f );
+                tangent = axis - normal * glm::dot( normal, axis );
+                length = glm::length( tangent );
+            }
+            tangent = length > 0.0f ? tangent / length : glm::vec3( 1.0f, 0.0f, 0.0f );
+
+            const GLfloat handedness = glm::dot( glm::cross( normal, tangent ), bitangent ) < 0.0f ? -1.0f : 1.0f;
+            tangents[v] = glm::vec4( tangent, handedness );
+        }
+    } );
+}
+
+inline CSCI441_INTERNAL::VertexCacheStatistics CSCI441_INTERNAL::analyzeVertexCache(const GLuint* indices, const size_t numIndices, const GLuint numVertices, const GLuint cacheSize) {
+    VertexCacheStatistics statistics;
+    if( numIndices < 3 ) return statistics;
+
+    // a vertex is cached if fewer than cacheSize misses happened since it was last loaded
+    std::vector<GLuint> loadedAt(numVertices, 0);
+    GLuint timestamp = cacheSize + 1;
+    size_t numMisses = 0, numReferenced = 0;
+    for( size_t i = 0; i < numIndices; i++ ) {
+        const GLuint vertex = indices[i];
+        if( loadedAt[vertex] == 0 ) numReferenced++;
+        if( timestamp - loadedAt[vertex] > cacheSize ) {
+            loadedAt[vertex] = timestamp++;
+            numMisses++;
+        }
+    }
+
+    statistics.acmr = static_cast<GLfloat>(numMisses) / static_cast<GLfloat>(numIndices / 3);
+    statistics.atvr = static_cast<GLfloat>(numMisses) / static_cast<GLfloat>(numReferenced);
+    return statistics;
+}
+
+inline void CSCI441_INTERNAL::optimizeVertexCache(GLuint* indices, const size_t numIndices, const GLuint numVertices) {
+    constexpr int CACHE_SIZE = 32;
+    constexpr GLfloat CACHE_DECAY_POWER = 1.5f;
+    constexpr GLfloat LAST_TRIANGLE_SCORE = 0.75f;
+    constexpr GLfloat VALENCE_BOOST_SCALE = 2.0f;
+    constexpr GLfloat VALENCE_BOOST_POWER = 0.5f;
+
+    const size_t numTriangles = numIndices / 3;
+    if( numTriangles < 2 ) return;
+
+    const auto vertexScore = [](const int cachePosition, const GLuint remainingValence) {
+        if( remainingValence == 0 ) return -1.0f;
+        GLfloat score = 0.0f;
+        if( cachePosition >= 0 ) {
+            // the vertices of the last triangle are scored lower so the strip does not fold back on itself
+            if( cachePosition < 3 ) score = LAST_TRIANGLE_SCORE;
+            else score = std::pow( 1.0f - static_cast<GLfloat>(cachePosition - 3) / static_cast<GLfloat>(CACHE_SIZE - 3), CACHE_DECAY_POWER );
+        }
+        // favor vertices with few triangles left so they are finished off instead of stranded
+        return score + VALENCE_BOOST_SCALE * std::pow( static_cast<GLfloat>(remainingValence), -VALENCE_BOOST_POWER );
+    };
+
+    // triangles adjacent to each vertex, packed by vertex
+    std::vector<GLuint> valence(numVertices, 0);
+    for( size_t i = 0; i < numTriangles * 3; i++ ) valence[indices[i]]++;
+    std::vector<size_t> adjacencyOffset(static_cast<size_t>(numVertices) + 1, 0);
+    for( GLuint v = 0; v < numVertices; v++ ) adjacencyOffset[v + 1] = adjacencyOffset[v] + valence[v];
+    std::vector<GLuint> adjacency(numTriangles * 3);
+    {
+        std::vector<size_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+        for( size_t t = 0; t < numTriangles; t++ ) {
+            for( size_t c = 0; c < 3; c++ ) adjacency[fill[indices[t * 3 + c]]++] = static_cast<GLuint>(t);
+        }
+    }
+
+    std::vector<int> cachePosition(numVertices, -1);
+    std::vector<GLfloat> vertexScores(numVertices);
+    for( GLuint v = 0; v < numVertices; v++ ) vertexScores[v] = vertexScore( -1, valence[v] );
+    std::vector<GLfloat> triangleScores(numTriangles);
+    for( size_t t = 0; t < numTriangles; t++ ) {
+        triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+    }
+    std::vector<bool> emitted(numTriangles, false);
+
+    std::vector<GLuint> output;
+    output.reserve(numTriangles * 3);
+    std::vector<GLuint> cache, nextCache;
+    cache.reserve(CACHE_SIZE + 3);
+    nextCache.reserve(CACHE_SIZE + 3);
+
+    size_t scanCursor = 0;
+    size_t bestTriangle = 0;
+    GLfloat bestScore = triangleScores[0];
+    for( size_t t = 1; t < numTriangles; t++ ) {
+        if( triangleScores[t] > bestScore ) { bestScore = triangleScores[t]; bestTriangle = t; }
+    }
+
+    for( size_t emittedCount = 0; emittedCount < numTriangles; emittedCount++ ) {
+        if( bestScore < 0.0f ) {
+            // nothing adjacent to the cache remains, continue with the next triangle in file order
+            while( emitted[scanCursor] ) scanCursor++;
+            bestTriangle = scanCursor;
+        }
+
+        const GLuint* corners = indices + bestTriangle * 3;
+        emitted[bestTriangle] = true;
+        output.insert(output.end(), corners, corners + 3);
+
+        // remove the triangle from the adjacency of its vertices
+        for( size_t c = 0; c < 3; c++ ) {
+            const GLuint vertex = corners[c];
+            GLuint* begin = adjacency.data() + adjacencyOffset[vertex];
+            GLuint* end = begin + valence[vertex];
+            GLuint* found = std::find(begin, end, static_cast<GLuint>(bestTriangle));
+            if( found != end ) {
+                *found = *(end - 1);
+                valence[vertex]--;
+            }
+        }
+
+        // the emitted triangle moves to the front of the LRU cache
+        nextCache.assign(corners, corners + 3);
+        for( const GLuint vertex : cache ) {
+            if( vertex != corners[0] && vertex != corners[1] && vertex != corners[2] ) nextCache.push_back(vertex);
+        }
+        for( size_t i = 0; i < nextCache.size(); i++ ) {
+            cachePosition[nextCache[i]] = (i < static_cast<size_t>(CACHE_SIZE)) ? static_cast<int>(i) : -1;
+        }
+        std::swap(cache, nextCache);
+
+        // rescore every vertex whose cache position changed and the triangles using them
+        bestScore = -1.0f;
+        for( size_t i = 0; i < cache.size(); i++ ) {
+            const GLuint vertex = cache[i];
+            const GLfloat newScore = vertexScore( cachePosition[vertex], valence[vertex] );
+            const GLfloat delta = newScore - vertexScores[vertex];
+            vertexScores[vertex] = newScore;
+            for( size_t a = 0; a < valence[vertex]; a++ ) {
+                const GLuint triangle = adjacency[adjacencyOffset[vertex] + a];
+                triangleScores[triangle] += delta;
+                if( triangleScores[triangle] > bestScore ) {
+                    bestScore = triangleScores[triangle];
+                    bestTriangle = triangle;
+                }
+            }
+        }
+        if( cache.size() > static_cast<size_t>(CACHE_SIZE) ) cache.resize(CACHE_SIZE);
+    }
+
+    std::copy(output.begin(), output.end(), indices);
+}
+
+inline void CSCI441_INTERNAL::optimizeOverdraw(GLuint* indices, const size_t numIndices, const glm::vec3* positions, const GLuint numVertices) {
+    constexpr GLuint CACHE_SIZE = 16;
+    const size_t numTriangles = numIndices / 3;
+    if( numTriangles < 2 ) return;
+
+    // a triangle missing on all three vertices starts a new cluster
+    std::vector<size_t> clusterStarts;
+    std::vector<GLuint> loadedAt(numVertices, 0);
+    GLuint timestamp = CACHE_SIZE + 1;
+    for( size_t t = 0; t < numTriangles; t++ ) {
+        GLuint numMisses = 0;
+        for( size_t c = 0; c < 3; c++ ) {
+            const GLuint vertex = indices[t * 3 + c];
+            if( timestamp - loadedAt[vertex] > CACHE_SIZE ) {
+                loadedAt[vertex] = timestamp++;
+                numMisses++;
+            }
+        }
+        if( t == 0 || numMisses == 3 ) clusterStarts.push_back(t);
+    }
+    if( clusterStarts.size() < 2 ) return;
+
+    glm::vec3 meshCentroid(0.0f);
+    GLfloat meshArea = 0.0f;
+    std::vector<glm::vec3> clusterCentroids(clusterStarts.size(), glm::vec3(0.0f));
+    std::vector<glm::vec3> clusterNormals(clusterStarts.size(), glm::vec3(0.0f));
+    std::vector<GLfloat> clusterAreas(clusterStarts.size(), 0.0f);
+    for( size_t cluster = 0; cluster < clusterStarts.size(); cluster++ ) {
+        const size_t end = cluster + 1 < clusterStarts.size() ? clusterStarts[cluster + 1] : numTriangles;
+        for( size_t t = clusterStarts[cluster]; t < end; t++ ) {
+            const glm::vec3& a = positions[indices[t * 3]];
+            const glm::vec3& b = positions[indices[t * 3 + 1]];
+            const glm::vec3& c = positions[indices[t * 3 + 2]];
+            const glm::vec3 areaNormal = glm::cross(b - a, c - a);
+            const GLfloat area = glm::length(areaNormal);
+            const glm::vec3 centroid = (a + b + c) / 3.0f;
+            clusterCentroids[cluster] += centroid * area;
+            clusterNormals[cluster] += areaNormal;
+            clusterAreas[cluster] += area;
+            meshCentroid += centroid * area;
+            meshArea += area;
+        }
+    }
+    if( meshArea > 0.0f ) meshCentroid /= meshArea;
+
+    // clusters facing away from the center occlude the rest of the mesh, draw them first
+    std::vector<GLfloat> sortKeys(clusterStarts.size(), 0.0f);
+    for( size_t cluster = 0; cluster < clusterStarts.size(); cluster++ ) {
+        if( clusterAreas[cluster] <= 0.0f ) continue;
+        const glm::vec3 centroid = clusterCentroids[cluster] / clusterAreas[cluster];
+        const GLfloat normalLength = glm::length(clusterNormals[cluster]);
+        if( normalLength > 0.0f ) sortKeys[cluster] = glm::dot(centroid - meshCentroid, clusterNormals[cluster] / normalLength);
+    }
+    std::vector<size_t> order(clusterStarts.size());
+    for( size_t i = 0; i < order.size(); i++ ) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&sortKeys](const size_t lhs, const size_t rhs) { return sortKeys[lhs] > sortKeys[rhs]; });
+
+    std::vector<GLuint> output;
+    output.reserve(numTriangles * 3);
+    for( const size_t cluster : order ) {
+        const size_t end = cluster + 1 < clusterStarts.size() ? clusterStarts[cluster + 1] : numTriangles;
+        output.insert(output.end(), indices + clusterStarts[cluster] * 3, indices + end * 3);
+    }
+    std::copy(output.begin(), output.end(), indices);
+}
+
+inline std::vector<GLuint> CSCI441_INTERNAL::optimizeVertexFetch(GLuint* indices, const size_t numIndices, const GLuint numVertices) {
+    constexpr GLuint UNUSED = 0xFFFFFFFF;
+    std::vector<GLuint> remap(numVertices, UNUSED);
+    GLuint nextVertex = 0;
+    for( size_t i = 0; i < numIndices; i++ ) {
+        if( remap[indices[i]] == UNUSED ) remap[indices[i]] = nextVertex++;
+        indices[i] = remap[indices[i]];
+    }
+    for( GLuint v = 0; v < numVertices; v++ ) {
+        if( remap[v] == UNUSED ) remap[v] = nextVertex++;
+    }
+    return remap;
+}
+
+inline void CSCI441_INTERNAL::buildMeshlets(GLuint* indices, const size_t numIndices, const glm::vec3* positions, const GLuint numVertices,
+                                            const GLuint maxVertices, const GLuint maxTriangles, const GLuint indexOffset, std::vector<Meshlet>& meshlets) {
+    const size_t numTriangles = numIndices / 3;
+    if( numTriangles == 0 || maxVertices < 3 || maxTriangles == 0 ) return;
+
+    // triangles using each vertex, packed into one array
+    std::vector<GLuint> adjacencyOffsets(numVertices + 1, 0);
+    for( size_t i = 0; i < numTriangles * 3; i++ ) adjacencyOffsets[indices[i] + 1]++;
+    for( GLuint v = 0; v < numVertices; v++ ) adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    std::vector<GLuint> adjacency(numTriangles * 3);
+    std::vector<GLuint> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for( size_t t = 0; t < numTriangles; t++ ) {
+        for( int c = 0; c < 3; c++ ) adjacency[ fill[ indices[t*3 + c] ]++ ] = static_cast<GLuint>(t);
+    }
+
+    constexpr GLuint UNUSED = 0xFFFFFFFF;
+    std::vector<GLuint> vertexMeshlet(numVertices, UNUSED);
+    std::vector<bool> emitted(numTriangles, false);
+    std::vector<GLuint> output;
+    output.reserve(numTriangles * 3);
+    std::vector<GLuint> candidates;
+    std::vector<GLuint> meshletVertices;
+    std::vector<glm::vec3> faceNormals;
+    size_t scanCursor = 0;
+
+    for( GLuint meshletId = 0; output.size() < numTriangles * 3; meshletId++ ) {
+        const size_t meshletStart = output.size();
+        candidates.clear();
+        meshletVertices.clear();
+
+        const auto newVertexCount = [&](const size_t t) {
+            return static_cast<GLuint>( (vertexMeshlet[indices[t*3]] != meshletId)
+                                      + (vertexMeshlet[indices[t*3 + 1]] != meshletId)
+                                      + (vertexMeshlet[indices[t*3 + 2]] != meshletId) );
+        };
+        const auto nextUnemitted = [&]() {
+            while( scanCursor < numTriangles && emitted[scanCursor] ) scanCursor++;
+            return scanCursor;
+        };
+
+        size_t next = nextUnemitted();
+        for( GLuint numTriangleInMeshlet = 0; ; ) {
+            for( int c = 0; c < 3; c++ ) {
+                const GLuint vertex = indices[next*3 + c];
+                if( vertexMeshlet[vertex] != meshletId ) {
+                    vertexMeshlet[vertex] = meshletId;
+                    meshletVertices.push_back(vertex);
+                    for( GLuint a = adjacencyOffsets[vertex]; a < adjacencyOffsets[vertex + 1]; a++ ) {
+                        if( !emitted[adjacency[a]] ) candidates.push_back(adjacency[a]);
+                    }
+                }
+                output.push_back(vertex);
+            }
+            emitted[next] = true;
+            if( ++numTriangleInMeshlet == maxTriangles ) break;
+
+            // prefer the neighbor adding the fewest vertices, then continue along the original order
+            size_t best = numTriangles;
+            GLuint bestNewVertices = 4;
+            for( size_t i = 0; i < candidates.size(); ) {
+                if( emitted[candidates[i]] ) {
+                    candidates[i] = candidates.back();
+                    candidates.pop_back();
+                    continue;
+                }
+                const GLuint newVertices = newVertexCount(candidates[i]);
+                if( newVertices < bestNewVertices && meshletVertices.size() + newVertices <= maxVertices ) {
+                    best = candidates[i];
+                    bestNewVertices = newVertices;
+                    if( newVertices == 0 ) break;
+                }
+                i++;
+            }
+            if( best == numTriangles ) {
+                best = nextUnemitted();
+                if( best == numTriangles || meshletVertices.size() + newVertexCount(best) > maxVertices ) break;
+            }
+            next = best;
+        }
+
+        Meshlet meshlet;
+        meshlet.indexStart = indexOffset + static_cast<GLuint>(meshletStart);
+        meshlet.numIndices = static_cast<GLuint>(output.size() - meshletStart);
+        meshlet.numVertices = static_cast<GLuint>(meshletVertices.size());
+
+        glm::vec3 minimum = positions[meshletVertices.front()], maximum = minimum;
+        for( const GLuint vertex : meshletVertices ) {
+            minimum = glm::min(minimum, positions[vertex]);
+            maximum = glm::max(maximum, positions[vertex]);
+        }
+        meshlet.center = (minimum + maximum) * 0.5f;
+        for( const GLuint vertex : meshletVertices ) {
+            meshlet.radius = std::max(meshlet.radius, glm::length(positions[vertex] - meshlet.center));
+        }
+
+        // normal cone around the average face normal, too wide a cone is never culled
+        faceNormals.clear();
+        glm::vec3 normalSum(0.0f);
+        for( size_t i = meshletStart; i < output.size(); i += 3 ) {
+            const glm::vec3 faceNormal = glm::cross(positions[output[i + 1]] - positions[output[i]], positions[output[i + 2]] - positions[output[i]]);
+            const GLfloat area = glm::length(faceNormal);
+            if( area > 0.0f ) {
+                faceNormals.push_back(faceNormal / area);
+                normalSum += faceNormals.back();
+            }
+        }
+        if( glm::length(normalSum) > 0.0f ) {
+            meshlet.coneAxis = glm::normalize(normalSum);
+            GLfloat minimumDot = 1.0f;
+            for( const glm::vec3& faceNormal : faceNormals ) {
+                minimumDot = std::min(minimumDot, glm::dot(meshlet.coneAxis, faceNormal));
+            }
+            meshlet.coneCutoff = minimumDot <= 0.1f ? 1.0f : std::sqrt(1.0f - minimumDot * minimumDot);
+        }
+        meshlets.push_back(meshlet);
+    }
+    std::copy(output.begin(), output.end(), indices);
+}
+
+inline CSCI441_INTERNAL::Quadric CSCI441_INTERNAL::Quadric::fromPlane(const glm::vec3& normal, const GLfloat distance, const double weight) {
+    Quadric quadric;
+    const double a = normal.x, b = normal.y, c = normal.z, d = distance;
+    quadric.a00 = weight * a * a; quadric.a01 = weight * a * b; quadric.a02 = weight * a * c;
+    quadric.a11 = weight * b * b; quadric.a12 = weight * b * c; quadric.a22 = weight * c * c;
+    quadric.b0 = weight * a * d;  quadric.b1 = weight * b * d;  quadric.b2 = weight * c * d;
+    quadric.c = weight * d * d;
+    quadric.weight = weight;
+    return quadric;
+}
+
+inline CSCI441_INTERNAL::Quadric& CSCI441_INTERNAL::Quadric::operator+=(const Quadric& OTHER) {
+    a00 += OTHER.a00; a01 += OTHER.a01; a02 += OTHER.a02;
+    a11 += OTHER.a11; a12 += OTHER.a12; a22 += OTHER.a22;
+    b0 += OTHER.b0; b1 += OTHER.b1; b2 += OTHER.b2;
+    c += OTHER.c;
+    weight += OTHER.weight;
+    return *this;
+}
+
+inline double CSCI441_INTERNAL::Quadric::evaluate(const glm::vec3& p) const {
+    const double x = p.x, y = p.y, z = p.z;
+    const double error = a00*x*x + a11*y*y + a22*z*z + 2.0*(a01*x*y + a02*x*z + a12*y*z)
+                       + 2.0*(b0*x + b1*y + b2*z) + c;
+    return std::max(error, 0.0);
+}
+
+inline CSCI441_INTERNAL::MeshSimplifier::MeshSimplifier(const glm::vec3* positions, const GLuint numVertices, const GLuint* indices, const size_t numIndices, const GLuint* triangleGroups)
+    : _positions(positions),
+      _indices(indices, indices + numIndices / 3 * 3),
+      _triangleGroups(triangleGroups, triangleGroups + numIndices / 3) {
+    // vertices split at seams share a position, collapse them together
+    std::vector<GLuint> sorted(numVertices);
+    for( GLuint v = 0; v < numVertices; v++ ) sorted[v] = v;
+    std::sort(sorted.begin(), sorted.end(), [positions](const GLuint lhs, const GLuint rhs) {
+        const glm::vec3& a = positions[lhs];
+        const glm::vec3& b = positions[rhs];
+        return a.x != b.x ? a.x < b.x : (a.y != b.y ? a.y < b.y : a.z < b.z);
+    });
+    _positionOfVertex.resize(numVertices);
+    for( GLuint i = 0; i < numVertices; i++ ) {
+        if( i == 0 || positions[sorted[i]] != positions[sorted[i - 1]] ) _positionVertexOffsets.push_back(i);
+        _positionOfVertex[sorted[i]] = static_cast<GLuint>(_positionVertexOffsets.size() - 1);
+    }
+    const auto numPositions = static_cast<GLuint>(_positionVertexOffsets.size());
+    _positionVertexOffsets.push_back(numVertices);
+    _positionVertices = std::move(sorted);
+
+    // accumulate the planes of the triangles around each position and lock positions shared between groups
+    _quadrics.resize(numPositions);
+    _positionGroup.assign(numPositions, LOCKED - 1);
+    const size_t numTriangles = _indices.size() / 3;
+    std::vector<uint64_t> edges;
+    edges.reserve(numTriangles * 3);
+    for( size_t t = 0; t < numTriangles; t++ ) {
+        const glm::vec3& p0 = positions[_indices[t*3]];
+        const glm::vec3 faceNormal = glm::cross(positions[_indices[t*3 + 1]] - p0, positions[_indices[t*3 + 2]] - p0);
+        const GLfloat area = glm::length(faceNormal);
+        const Quadric quadric = area > 0.0f ? Quadric::fromPlane(faceNormal / area, -glm::dot(faceNormal / area, p0), area * 0.5) : Quadric();
+        for( int c = 0; c < 3; c++ ) {
+            const GLuint position = _positionOfVertex[_indices[t*3 + c]];
+            _quadrics[position] += quadric;
+            if( _positionGroup[position] == LOCKED - 1 ) _positionGroup[position] = _triangleGroups[t];
+            else if( _positionGroup[position] != _triangleGroups[t] ) _positionGroup[position] = LOCKED;
+
+            const GLuint a = position, b = _positionOfVertex[_indices[t*3 + (c + 1) % 3]];
+            edges.push_back( (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b) );
+        }
+    }
+
+    // open borders are held in place by planes perpendicular to the border through each border edge
+    std::vector<uint64_t> sortedEdges = edges;
+    std::sort(sortedEdges.begin(), sortedEdges.end());
+    for( size_t t = 0; t < numTriangles; t++ ) {
+        for( int c = 0; c < 3; c++ ) {
+            const uint64_t edge = edges[t*3 + c];
+            const auto range = std::equal_range(sortedEdges.begin(), sortedEdges.end(), edge);
+            if( range.second - range.first != 1 ) continue;
+
+            const glm::vec3& p0 = positions[_indices[t*3 + c]];
+            const glm::vec3& p1 = positions[_indices[t*3 + (c + 1) % 3]];
+            const glm::vec3& p2 = positions[_indices[t*3 + (c + 2) % 3]];
+            const glm::vec3 borderNormal = glm::cross(glm::cross(p1 - p0, p2 - p0), p1 - p0);
+            const GLfloat length = glm::length(borderNormal);
+            if( length <= 0.0f ) continue;
+            const GLfloat edgeLength = glm::length(p1 - p0);
+            const Quadric quadric = Quadric::fromPlane(borderNormal / length, -glm::dot(borderNormal / length, p0), 10.0 * edgeLength * edgeLength);
+            _quadrics[_positionOfVertex[_indices[t*3 + c]]] += quadric;
+            _quadrics[_positionOfVertex[_indices[t*3 + (c + 1) % 3]]] += quadric;
+        }
+    }
+
+    _buildAdjacency();
+}
+
+inline void CSCI441_INTERNAL::MeshSimplifier::_buildAdjacency() {
+    _adjacencyOffsets.assign(_positionOfVertex.size() + 1, 0);
+    for( const GLuint vertex : _indices ) _adjacencyOffsets[vertex + 1]++;
+    for( size_t v = 0; v + 1 < _adjacencyOffsets.size(); v++ ) _adjacencyOffsets[v + 1] += _adjacencyOffsets[v];
+    _adjacency.resize(_indices.size());
+    std::vector<GLuint> fill(_adjacencyOffsets.begin(), _adjacencyOffsets.end() - 1);
+    for( size_t i = 0; i < _indices.size(); i++ ) _adjacency[ fill[_indices[i]]++ ] = static_cast<GLuint>(i / 3);
+}
+
+inline bool CSCI441_INTERNAL::MeshSimplifier::_collapseTargets(const GLuint from, const GLuint to, std::vector<GLuint>& targets) const {
+    constexpr GLuint NONE = 0xFFFFFFFF;
+    targets.clear();
+    bool used = false;
+    for( GLuint i = _positionVertexOffsets[from]; i < _positionVertexOffsets[from + 1]; i++ ) {
+        const GLuint vertex = _positionVertices[i];
+        GLuint target = NONE;
+        for( GLuint a = _adjacencyOffsets[vertex]; a < _adjacencyOffsets[vertex + 1]; a++ ) {
+            const GLuint* triangle = &_indices[_adjacency[a] * 3];
+            for( int c = 0; c < 3; c++ ) {
+                if( _positionOfVertex[triangle[c]] != to ) continue;
+                if( target != NONE && target != triangle[c] ) return false;
+                target = triangle[c];
+            }
+        }
+        // a vertex at the source position without triangles is left alone, one without an edge to the target would tear a seam
+        if( target == NONE && _adjacencyOffsets[vertex] != _adjacencyOffsets[vertex + 1] ) return false;
+        if( target != NONE ) used = true;
+        targets.push_back(target);
+
+        // triangles that stretch to the target must not flip over
+        for( GLuint a = _adjacencyOffsets[vertex]; a < _adjacencyOffsets[vertex + 1]; a++ ) {
+            const GLuint* triangle = &_indices[_adjacency[a] * 3];
+            int corner = 0;
+            bool touchesTarget = false;
+            for( int c = 0; c < 3; c++ ) {
+                if( triangle[c] == vertex ) corner = c;
+                if( _positionOfVertex[triangle[c]] == to ) touchesTarget = true;
+            }
+            if( touchesTarget ) continue;
+            const glm::vec3& p1 = _positions[triangle[(corner + 1) % 3]];
+            const glm::vec3& p2 = _positions[triangle[(corner + 2) % 3]];
+            const glm::vec3 before = glm::cross(p1 - _positions[vertex], p2 - _positions[vertex]);
+            const glm::vec3 after = glm::cross(p1 - _positions[target], p2 - _positions[target]);
+            if( glm::dot(before, after) <= 0.0f ) return false;
+        }
+    }
+    return used;
+}
+
+inline bool CSCI441_INTERNAL::MeshSimplifier::simplify(const size_t targetTriangles) {
+    struct Collapse {
+        double cost;
+        GLuint from, to;
+    };
+    std::vector<uint64_t> edges;
+    std::vector<Collapse> collapses;
+    std::vector<GLuint> targets;
+    std::vector<GLuint> remap(_positionOfVertex.size());
+    std::vector<bool> touched(_quadrics.size());
+
+    while( _indices.size() / 3 > targetTriangles ) {
+        // unique edges between positions and whether each lies on an open border
+        edges.clear();
+        for( size_t i = 0; i < _indices.size(); i += 3 ) {
+            for( int c = 0; c < 3; c++ ) {
+                const GLuint a = _positionOfVertex[_indices[i + c]], b = _positionOfVertex[_indices[i + (c + 1) % 3]];
+                edges.push_back( (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b) );
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        std::vector<bool> onBorder(_quadrics.size(), false);
+        for( size_t i = 0; i < edges.size(); ) {
+            size_t j = i + 1;
+            while( j < edges.size() && edges[j] == edges[i] ) j++;
+            if( j - i == 1 ) {
+                onBorder[edges[i] >> 32] = true;
+                onBorder[edges[i] & 0xFFFFFFFF] = true;
+            }
+            i = j;
+        }
+
+        collapses.clear();
+        for( size_t i = 0; i < edges.size(); ) {
+            size_t j = i + 1;
+            while( j < edges.size() && edges[j] == edges[i] ) j++;
+            const bool borderEdge = (j - i == 1);
+            const auto a = static_cast<GLuint>(edges[i] >> 32), b = static_cast<GLuint>(edges[i] & 0xFFFFFFFF);
+            i = j;
+            if( a == b ) continue;
+
+            Quadric quadric = _quadrics[a];
+            quadric += _quadrics[b];
+            const double normalization = quadric.weight > 0.0 ? quadric.weight : 1.0;
+            Collapse best{ -1.0, 0, 0 };
+            for( const auto& [from, to] : { std::make_pair(a, b), std::make_pair(b, a) } ) {
+                if( _positionGroup[from] == LOCKED ) continue;
+                if( onBorder[from] && !borderEdge ) continue;
+                const double cost = quadric.evaluate(_positions[ _positionVertices[_positionVertexOffsets[to]] ]) / normalization;
+                if( best.cost < 0.0 || cost < best.cost ) best = { cost, from, to };
+            }
+            if( best.cost >= 0.0 ) collapses.push_back(best);
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& lhs, const Collapse& rhs) { return lhs.cost < rhs.cost; });
+
+        // collapse the cheapest edges whose neighborhoods do not overlap
+        for( GLuint v = 0; v < remap.size(); v++ ) remap[v] = v;
+        std::fill(touched.begin(), touched.end(), false);
+        size_t numTriangles = _indices.size() / 3;
+        bool collapsed = false;
+        for( const Collapse& collapse : collapses ) {
+            if( numTriangles <= targetTriangles ) break;
+            if( touched[collapse.from] || touched[collapse.to] ) continue;
+            if( !_collapseTargets(collapse.from, collapse.to, targets) ) continue;
+
+            for( GLuint i = _positionVertexOffsets[collapse.from], k = 0; i < _positionVertexOffsets[collapse.from + 1]; i++, k++ ) {
+                const GLuint vertex = _positionVertices[i];
+                if( targets[k] != 0xFFFFFFFF ) remap[vertex] = targets[k];
+                for( GLuint a = _adjacencyOffsets[vertex]; a < _adjacencyOffsets[vertex + 1]; a++ ) {
+                    const GLuint* triangle = &_indices[_adjacency[a] * 3];
+                    bool removed = false;
+                    for( int c = 0; c < 3; c++ ) {
+                        touched[ _positionOfVertex[triangle[c]] ] = true;
+                        if( _positionOfVertex[triangle[c]] == collapse.to ) removed = true;
+                    }
+                    if( removed ) numTriangles--;
+                }
+            }
+            _quadrics[collapse.to] += _quadrics[collapse.from];
+            _error = std::max(_error, static_cast<GLfloat>(std::sqrt(collapse.cost)));
+            collapsed = true;
+        }
+        if( !collapsed ) return false;
+
+        // drop the triangles that collapsed to a line
+        size_t kept = 0;
+        for( size_t t = 0; t < _indices.size() / 3; t++ ) {
+            const GLuint i0 = remap[_indices[t*3]], i1 = remap[_indices[t*3 + 1]], i2 = remap[_indices[t*3 + 2]];
+            const GLuint p0 = _positionOfVertex[i0], p1 = _positionOfVertex[i1], p2 = _positionOfVertex[i2];
+            if( p0 == p1 || p1 == p2 || p0 == p2 ) continue;
+            _indices[kept*3] = i0;
+            _indices[kept*3 + 1] = i1;
+            _indices[kept*3 + 2] = i2;
+            _triangleGroups[kept++] = _triangleGroups[t];
+        }
+        _indices.resize(kept * 3);
+        _triangleGroups.resize(kept);
+        _buildAdjacency();
+    }
+    return true;
+}
+
+inline CSCI441_INTERNAL::PLYProperty::TYPE CSCI441_INTERNAL::PLYProperty::typeFromName(const std::string_view typeName) noexcept {
+    if( typeName == "char"   || typeName == "int8" )    return TYPE::INT8;
+    if( typeName == "uchar"  || typeName == "uint8" )   return TYPE::UINT8;
+    if( typeName == "short"  || typeName == "int16" )   return TYPE::INT16;
+    if( typeName == "ushort" || typeName == "uint16" )  return TYPE::UINT16;
+    if( typeName == "int"    || typeName == "int32" )   return TYPE::INT32;
+    if( typeName == "uint"   || typeName == "uint32" )  return TYPE::UINT32;
+    if( typeName == "float"  || typeName == "float32" ) return TYPE::FLOAT32;
+    if( typeName == "double" || typeName == "float64" ) return TYPE::FLOAT64;
+    return TYPE::UNKNOWN;
+}
+
+inline size_t CSCI441_INTERNAL::PLYProperty::sizeOf(const TYPE type) noexcept {
+    switch( type ) {
+        case TYPE::INT8:    case TYPE::UINT8:   return 1;
+        case TYPE::INT16:   case TYPE::UINT16:  return 2;
+        case TYPE::INT32:   case TYPE::UINT32:  case TYPE::FLOAT32: return 4;
+        case TYPE::FLOAT64: return 8;
+        default: return 0;
+    }
+}
+
+inline double CSCI441_INTERNAL::PLYProperty::normalizationScale(const TYPE type) noexcept {
+    switch( type ) {
+        case TYPE::INT8:    return 127.0;
+        case TYPE::UINT8:   return 255.0;
+        case TYPE::INT16:   return 32767.0;
+        case TYPE::UINT16:  return 65535.0;
+        case TYPE::INT32:   return 2147483647.0;
+        case TYPE::UINT32:  return 4294967295.0;
+        default: return 1.0;
+    }
+}
+
+inline CSCI441_INTERNAL::PLYReader::PLYReader(const char* begin, const char* end, const PLY_FORMAT format) noexcept
+    : _current(begin), _end(end), _format(format) {
+    const uint16_t byteOrderProbe = 1;
+    uint8_t lowByte;
+    memcpy(&lowByte, &byteOrderProbe, 1);
+    const bool hostIsLittleEndian = (lowByte == 1);
+    _swapBytes = (format == PLY_FORMAT::BINARY_LITTLE_ENDIAN && !hostIsLittleEndian)
+              || (format == PLY_FORMAT::BINARY_BIG_ENDIAN && hostIsLittleEndian);
+}
+
+inline bool CSCI441_INTERNAL::PLYReader::read(const PLYProperty::TYPE type, double& value) noexcept {
+    value = 0.0;
+    if( _format == PLY_FORMAT::ASCII ) {
+        // values are whitespace separated, records conventionally end each line but are not required to
+        while( _current < _end && (*_current == ' ' || *_current == '\t' || *_current == '\r' || *_current == '\n') ) ++_current;
+        const char* tokenStart = _current;
+        while( _current < _end && *_current != ' ' && *_current != '\t' && *_current != '\r' && *_current != '\n' ) ++_current;
+        const std::string_view token(tokenStart, static_cast<size_t>(_current - tokenStart));
+
+        if( type == PLYProperty::TYPE::FLOAT32 ) {
+            GLfloat floatValue;
+            const bool parsed = parseFloat(token, floatValue);
+            value = floatValue;
+            return parsed;
+        }
+        if( type == PLYProperty::TYPE::FLOAT64 || type == PLYProperty::TYPE::UINT32 ) {
+            // parsed at full width, strtod and strtoull require a null terminated string
+            char buffer[64];
+            if( token.empty() || token.size() >= sizeof(buffer) ) return false;
+            memcpy(buffer, token.data(), token.size());
+            buffer[token.size()] = '\0';
+            char* parseEnd = nullptr;
+            if( type == PLYProperty::TYPE::FLOAT64 ) {
+                value = strtod(buffer, &parseEnd);
+            } else {
+                if( buffer[0] == '-' ) return false;
+                const unsigned long long uintValue = strtoull(buffer, &parseEnd, 10);
+                if( uintValue > std::numeric_limits<uint32_t>::max() ) return false;
+                value = static_cast<double>(uintValue);
+            }
+            return parseEnd != buffer;
+        }
+        GLint intValue;
+        const bool parsed = parseInt(token, intValue);
+        value = intValue;
+        return parsed;
+    }
+
+    const size_t numBytes = PLYProperty::sizeOf(type);
+    if( numBytes == 0 || remaining() < numBytes ) return false;
+
+    value = decodeBinary(_current, type, _swapBytes);
+    _current += numBytes;
+    return true;
+}
+
+inline double CSCI441_INTERNAL::PLYReader::decodeBinary(const char* bytes, const PLYProperty::TYPE type, const bool swapBytes) noexcept {
+    const size_t numBytes = PLYProperty::sizeOf(type);
+
+    unsigned char ordered[8] = {0};
+    memcpy(ordered, bytes, numBytes);
+    if( swapBytes ) {
+        for( size_t i = 0; i < numBytes / 2; i++ ) {
+            const unsigned char swap = ordered[i];
+            ordered[i] = ordered[numBytes - 1 - i];
+            ordered[numBytes - 1 - i] = swap;
+        }
+    }
+
+    switch( type ) {
+        case PLYProperty::TYPE::INT8:    { int8_t   v; memcpy(&v, ordered, sizeof(v)); return v; }
+        case PLYProperty::TYPE::UINT8:   { uint8_t  v; memcpy(&v, ordered, sizeof(v)); return v; }
+        case PLYProperty::TYPE::INT16:   { int16_t  v; memcpy(&v, ordered, sizeof(v)); return v; }
+        case PLYProperty::TYPE::UINT16:  { uint16_t v; memcpy(&v, ordered, sizeof(v)); return v; }
+        case PLYProperty::TYPE::INT32:   { int32_t  v; memcpy(&v, ordered, sizeof(v)); return v; }
+        case PLYProperty::TYPE::UINT32:  { uint32_t v; memcpy(&v, ordered, sizeof(v)); return v; }
+        case PLYProperty::TYPE::FLOAT32: { float    v; memcpy(&v, ordered, sizeof(v)); return v; }
+        case PLYProperty::TYPE::FLOAT64: { double   v; memcpy(&v, ordered, sizeof(v)); return v; }
+        default: return 0.0;
+    }
+}
+
+inline bool CSCI441_INTERNAL::PLYReader::skip(const PLYProperty& property) noexcept {
+    double value;
+    if( !property.isList ) {
+        if( _format != PLY_FORMAT::ASCII ) return skipBytes( PLYProperty::sizeOf(property.type) );
+        return read(property.type, value);
+    }
+
+    double count;
+    if( !read(property.countType, count) ) return false;
+    if( _format != PLY_FORMAT::ASCII ) return skipBytes( static_cast<size_t>(count) * PLYProperty::sizeOf(property.type) );
+    for( size_t i = 0; i < static_cast<size_t>(count); i++ ) {
+        if( !read(property.type, value) ) return false;
+    }
+    return true;
+}
+
+inline bool CSCI441_INTERNAL::PLYReader::skipBytes(const size_t numBytes) noexcept {
+    if( remaining() < numBytes ) return false;
+    _current += numBytes;
+    return true;
+}
+
+inline bool CSCI441_INTERNAL::BinaryCursor::read(void* destination, const size_t numBytes) noexcept {
+    if( static_cast<size_t>(end - current) < numBytes ) return false;
+    memcpy(destination, current, numBytes);
+    current += numBytes;
+    return true;
+}
+
+inline bool CSCI441_INTERNAL::BinaryCursor::readString(std::string& value) {
+    uint32_t length;
+    if( !read(&length, sizeof(length)) || static_cast<size_t>(end - current) < length ) return false;
+    value.assign(current, length);
+    current += length;
+    return true;
+}
+
+inline bool CSCI441_INTERNAL::parseFloat(std::string_view token, GLfloat& value) noexcept {
+    value = 0.0f;
+    // from_chars does not accept an explicit positive sign
+    if( !token.empty() && token.front() == '+' ) token.remove_prefix(1);
+    if( token.empty() ) return false;
+#ifdef __cpp_lib_to_chars
+    const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+    return ec == std::errc() && ptr != token.data();
+#else
+    // strtof requires a null terminated string, numbers longer than the buffer are not meaningful as a float
+    char buffer[64];
+    const size_t length = token.size() < sizeof(buffer) - 1 ? token.size() : sizeof(buffer) - 1;
+    memcpy(buffer, token.data(), length);
+    buffer[length] = '\0';
+    char* parseEnd = nullptr;
+    value = strtof(buffer, &parseEnd);
+    return parseEnd != buffer;
+#endif
+}
+
+inline bool CSCI441_INTERNAL::parseInt(std::string_view token, GLint& value) noexcept {
+    value = 0;
+    if( !token.empty() && token.front() == '+' ) token.remove_prefix(1);
+    const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+    return ec == std::errc() && ptr != token.data();
+}
+
+inline uint64_t CSCI441_INTERNAL::hashBytes(const char* data, const size_t size, uint64_t seed) noexcept {
+    for( size_t i = 0; i < size; i++ ) {
+        seed ^= static_cast<unsigned char>(data[i]);
+        seed *= 0x100000001b3ull;
+    }
+    return seed;
+}
+
+inline CSCI441_INTERNAL::ThreadPool::ThreadPool(unsigned numThreads) {
+    if( numThreads == 0 ) numThreads = 1;
+    for( unsigned i = 0; i < numThreads; i++ ) {
+        _workers.emplace_back( &ThreadPool::_run, this );
+    }
+}
+
+inline CSCI441_INTERNAL::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        _tasks.clear();
+    }
+    _tasksAvailable.notify_all();
+    for( auto& worker : _workers ) {
+        worker.join();
+    }
+}
+
+inline void CSCI441_INTERNAL::ThreadPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.push_back( std::move(task) );
+    }
+    _tasksAvailable.notify_one();
+}
+
+inline CSCI441_INTERNAL::ThreadPool& CSCI441_INTERNAL::ThreadPool::textureDecodePool() {
+    static ThreadPool pool( std::thread::hardware_concurrency() );
+    return pool;
+}
+
+inline void CSCI441_INTERNAL::ThreadPool::_run() {
+    while( true ) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _tasksAvailable.wait( lock, [this]() { return _stopping || !_tasks.empty(); } );
+            if( _stopping ) return;
+            task = std::move( _tasks.front() );
+            _tasks.pop_front();
+        }
+        task();
+    }
+}
+
+inline CSCI441_INTERNAL::TextureCache& CSCI441_INTERNAL::TextureCache::instance() {
+    static TextureCache cache;
+    return cache;
+}
+
+inline std::pair<std::shared_ptr<CSCI441_INTERNAL::TextureCacheEntry>, bool> CSCI441_INTERNAL::TextureCache::findOrInsert(const TextureCacheKey& key, const char* imageData, const char* maskData) {
+    const auto imageSize = static_cast<size_t>(key.imageSize), maskSize = static_cast<size_t>(key.maskSize);
+    auto& entries = _entries[key];
+    for( const auto& entry : entries ) {
+        if( memcmp( entry->contents.data(), imageData, imageSize ) == 0
+            && (maskSize == 0 || memcmp( entry->contents.data() + imageSize, maskData, maskSize ) == 0) ) {
+            return { entry, false };
+        }
+    }
+
+    auto entry = std::make_shared<TextureCacheEntry>();
+    entry->contents.reserve( imageSize + maskSize );
+    entry->contents.insert( entry->contents.end(), imageData, imageData + imageSize );
+    if( maskSize > 0 ) entry->contents.insert( entry->contents.end(), maskData, maskData + maskSize );
+    entries.push_back( entry );
+    return { entry, true };
+}
+
+inline std::vector<GLuint> CSCI441_INTERNAL::TextureCache::clear() {
+    std::vector<GLuint> handles;
+    for( const auto& [key, entries] : _entries ) {
+        for( const auto& entry : entries ) {
+            if( entry->handle != 0 ) handles.push_back( entry->handle );
+        }
+    }
+    _entries.clear();
+    return handles;
+}
+
+inline CSCI441_INTERNAL::StreamingLoadState::~StreamingLoadState() {
+    if( indexFile != nullptr ) fclose(indexFile);
+}
+
+#endif // CSCI441_MODEL_LOADER_TYPES_HPP
@@ -72,6 +72,22 @@ namespace CSCI441 {
      */
     [[maybe_unused]] inline constexpr glm::vec3 Z_AXIS_NEG(  0.0f,  0.0f, -1.0f );
 
+    /**
+     * @brief record of a single instance within an instance buffer
+     * @note matches the std430 layout of <tt>struct Instance { mat4 modelMatrix; vec4 color; };</tt> so the same
+     * buffer can be read as per instance vertex attributes or as a shader storage buffer indexed by gl_InstanceID
+     */
+    struct InstanceData {
+        /**
+         * @brief transforms the object into world space
+         */
+        glm::mat4 modelMatrix;
+        /**
+         * @brief color of the instance
+         */
+        glm::vec4 color;
+    };
+
     /**
      * @namespace OpenGLUtils
      * @brief contains OpenGL Utility functions
@@ -134,6 +150,22 @@ namespace CSCI441_INTERNAL {
   void printOpenGLParam2f(const char *FORMAT, GLenum name );
   [[maybe_unused]] void printOpenGLParam3(const char *FORMAT, GLenum name );
   void printOpenGLParam4(const char *FORMAT, GLenum name );
+
+  /**
+   * @brief makes the records of an instance buffer available to the next instanced draw of the bound VAO
+   * @param instanceBuffer buffer of CSCI441::InstanceData records
+   * @param modelMatrixLocation first of the four consecutive attribute locations of the model matrix
+   * @param colorLocation attribute location of the instance color
+   * @param storageBlockBinding shader storage binding point to bind the buffer to when neither location is set
+   * @note attributes advance once per instance, when both locations are -1 the buffer is bound for shader storage instead
+   */
+  void bindInstanceAttributes(GLuint instanceBuffer, GLint modelMatrixLocation, GLint colorLocation, GLuint storageBlockBinding );
+  /**
+   * @brief disables the instance attributes of the bound VAO and returns them to advancing once per vertex
+   * @param modelMatrixLocation first of the four consecutive attribute locations of the model matrix
+   * @param colorLocation attribute location of the instance color
+   */
+  void releaseInstanceAttributes(GLint modelMatrixLocation, GLint colorLocation );
 }
 
 //**********************************************************************************
@@ -401,4 +433,42 @@ inline void CSCI441_INTERNAL::printOpenGLParam4(const char * const FORMAT, const
 	CSCI441::LogUtils::log(FORMAT, values[0], values[1], values[2], values[3] );
 }
 
+inline void CSCI441_INTERNAL::bindInstanceAttributes( const GLuint instanceBuffer, const GLint modelMatrixLocation, const GLint colorLocation, const GLuint storageBlockBinding ) {
+	if( modelMatrixLocation == -1 && colorLocation == -1 ) {
+		glBindBufferBase( GL_SHADER_STORAGE_BUFFER, storageBlockBinding, instanceBuffer );
+		return;
+	}
+
+	glBindBuffer( GL_ARRAY_BUFFER, instanceBuffer );
+	if( modelMatrixLocation != -1 ) {
+		// a mat4 attribute is fed one column per location
+		for( GLuint column = 0; column < 4; column++ ) {
+			const GLuint location = static_cast<GLuint>(modelMatrixLocation) + column;
+			glEnableVertexAttribArray( location );
+			glVertexAttribPointer( location, 4, GL_FLOAT, GL_FALSE, sizeof(CSCI441::InstanceData), reinterpret_cast<void *>(sizeof(glm::vec4) * column) );
+			glVertexAttribDivisor( location, 1 );
+		}
+	}
+	if( colorLocation != -1 ) {
+		glEnableVertexAttribArray( colorLocation );
+		glVertexAttribPointer( colorLocation, 4, GL_FLOAT, GL_FALSE, sizeof(CSCI441::InstanceData), reinterpret_cast<void *>(sizeof(glm::mat4)) );
+		glVertexAttribDivisor( colorLocation, 1 );
+	}
+}
+
+inline void CSCI441_INTERNAL::releaseInstanceAttributes( const GLint modelMatrixLocation, const GLint colorLocation ) {
+	// the VAO is shared with non-instanced draws, which may use these locations for per vertex data
+	if( modelMatrixLocation != -1 ) {
+		for( GLuint column = 0; column < 4; column++ ) {
+			const GLuint location = static_cast<GLuint>(modelMatrixLocation) + column;
+			glVertexAttribDivisor( location, 0 );
+			glDisableVertexAttribArray( location );
+		}
+	}
+	if( colorLocation != -1 ) {
+		glVertexAttribDivisor( colorLocation, 0 );
+		glDisableVertexAttribArray( colorLocation );
+	}
+}
+
 #endif // CSCI441_OPENGL_UTILS_H
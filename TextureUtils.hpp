@@ -30,6 +30,7 @@
 #endif
 #include <stb_image.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <string>
@@ -176,9 +177,17 @@ inline GLuint CSCI441::TextureUtils::loadAndRegisterTexture( const char *filenam
 inline GLuint CSCI441::TextureUtils::loadAndRegister2DTexture( const char *filename, const GLint minFilter, const GLint magFilter, const GLint wrapS, const GLint wrapT, const GLboolean flipOnY, const GLboolean printAllMessages, const GLboolean enableMipmaps, const GLboolean enableAniso ) {
     int imageWidth, imageHeight, imageChannels;
     GLuint texHandle = 0;
-    stbi_set_flip_vertically_on_load(flipOnY);
     unsigned char *data = stbi_load( filename, &imageWidth, &imageHeight, &imageChannels, 0);
 
+    // flip the rows here instead of through stbi_set_flip_vertically_on_load(), that setting
+    // is shared by every thread and ModelLoader decodes material textures on worker threads
+    if( data && flipOnY ) {
+        const size_t rowSize = static_cast<size_t>(imageWidth) * imageChannels;
+        for( int row = 0; row < imageHeight / 2; row++ ) {
+            std::swap_ranges( data + row * rowSize, data + (row + 1) * rowSize, data + (imageHeight - 1 - row) * rowSize );
+        }
+    }
+
 	if( !data ) {
         if( strstr(filename, ".ppm") != NULL ) {
             loadPPM(filename, imageWidth, imageHeight, data);
@@ -0,0 +1,230 @@
+// Times drawing the same model buffered with the separate, interleaved and
+// packed vertex layouts.  Runs without a window through EGL on the surfaceless
+// Mesa platform, rendering into a small framebuffer so vertex fetch and
+// shading dominate the frame time.
+//
+// usage: vertex_layout_bench [model file] [frames]
+// with no model file a UV sphere with positions, normals and texture
+// coordinates is generated, tangents are generated for every model.
+
+#define CSCI441_TEXTURE_UTILS_IMPLEMENTATION
+#include "../TextureUtils.hpp"
+#include "../ModelLoader.hpp"
+#include "../tests/headless_context.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+static constexpr GLsizei FRAMEBUFFER_SIZE = 256;
+static constexpr int DRAWS_PER_FRAME = 4;
+static constexpr int WARMUP_FRAMES = 3;
+
+static const char* VERTEX_SHADER = R"(
+#version 410 core
+layout(location = 0) in vec3 vPos;
+layout(location = 1) in vec3 vNormal;
+layout(location = 2) in vec2 vTexCoord;
+layout(location = 3) in vec4 vTangent;
+uniform mat4 mvpMatrix;
+out vec3 color;
+void main() {
+    gl_Position = mvpMatrix * vec4(vPos, 1.0);
+    color = abs(vNormal) * 0.5 + vec3(vTexCoord, 0.0) * 0.25 + abs(vTangent.xyz) * 0.25 * vTangent.w;
+}
+)";
+
+static const char* FRAGMENT_SHADER = R"(
+#version 410 core
+in vec3 color;
+out vec4 fragColorOut;
+void main() {
+    fragColorOut = vec4(color, 1.0);
+}
+)";
+
+static bool writeSphereOBJ( const char* filename, const int numSlices, const int numStacks ) {
+    FILE* file = fopen( filename, "w" );
+    if( file == nullptr ) return false;
+    for( int stack = 0; stack <= numStacks; stack++ ) {
+        const float phi = glm::pi<float>() * static_cast<float>(stack) / static_cast<float>(numStacks);
+        for( int slice = 0; slice <= numSlices; slice++ ) {
+            const float theta = glm::two_pi<float>() * static_cast<float>(slice) / static_cast<float>(numSlices);
+            const glm::vec3 normal( sinf(phi) * cosf(theta), cosf(phi), sinf(phi) * sinf(theta) );
+            fprintf( file, "v %f %f %f\nvn %f %f %f\nvt %f %f\n", normal.x, normal.y, normal.z, normal.x, normal.y, normal.z,
+                     static_cast<float>(slice) / static_cast<float>(numSlices), 1.0f - static_cast<float>(stack) / static_cast<float>(numStacks) );
+        }
+    }
+    for( int stack = 0; stack < numStacks; stack++ ) {
+        for( int slice = 0; slice < numSlices; slice++ ) {
+            const int a = stack * (numSlices + 1) + slice + 1, b = a + numSlices + 1;
+            fprintf( file, "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, a, b, b, b, b + 1, b + 1, b + 1, a + 1, a + 1, a + 1 );
+        }
+    }
+    return fclose( file ) == 0;
+}
+
+static GLuint compileProgram() {
+    const auto compile = []( const GLenum type, const char* source ) {
+        const GLuint shader = glCreateShader( type );
+        glShaderSource( shader, 1, &source, nullptr );
+        glCompileShader( shader );
+        GLint compiled = GL_FALSE;
+        glGetShaderiv( shader, GL_COMPILE_STATUS, &compiled );
+        if( compiled != GL_TRUE ) {
+            char infoLog[1024];
+            glGetShaderInfoLog( shader, sizeof(infoLog), nullptr, infoLog );
+            fprintf( stderr, "[ERROR]: Could not compile shader: %s\n", infoLog );
+        }
+        return shader;
+    };
+
+    const GLuint vertexShader = compile( GL_VERTEX_SHADER, VERTEX_SHADER );
+    const GLuint fragmentShader = compile( GL_FRAGMENT_SHADER, FRAGMENT_SHADER );
+    const GLuint program = glCreateProgram();
+    glAttachShader( program, vertexShader );
+    glAttachShader( program, fragmentShader );
+    glLinkProgram( program );
+    glDeleteShader( vertexShader );
+    glDeleteShader( fragmentShader );
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv( program, GL_LINK_STATUS, &linked );
+    if( linked != GL_TRUE ) {
+        fprintf( stderr, "[ERROR]: Could not link shader program\n" );
+        glDeleteProgram( program );
+        return 0;
+    }
+    return program;
+}
+
+struct LayoutResult {
+    GLint64 bufferBytes = 0;
+    double medianMilliseconds = 0.0;
+    double minMilliseconds = 0.0;
+};
+
+static bool timeLayout( const std::string& filename, const GLuint program, const GLint mvpLocation, const int numFrames,
+                        GLuint& numVertices, GLuint& numIndices, LayoutResult& result ) {
+    CSCI441::ModelLoader model;
+    if( !model.loadModelFile( filename, false, true ) ) return false;
+    numVertices = model.getNumberOfVertices();
+    numIndices = model.getNumberOfIndices();
+
+    // setAttributeLocations() leaves the model's vertex buffer bound
+    model.setAttributeLocations( 0, 1, 2, 3 );
+    glGetBufferParameteri64v( GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &result.bufferBytes );
+
+    const glm::mat4 projectionMatrix = glm::perspective( glm::radians(45.0f), 1.0f, 0.1f, 10.0f );
+    const glm::mat4 viewMatrix = glm::lookAt( glm::vec3(0.0f, 0.0f, 3.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f) );
+    const glm::vec3 center = (model.getBoundingBoxMin() + model.getBoundingBoxMax()) * 0.5f;
+    const float extent = std::max( glm::length( model.getBoundingBoxMax() - model.getBoundingBoxMin() ) * 0.5f, 1e-6f );
+
+    std::vector<double> frameMilliseconds;
+    for( int frame = 0; frame < WARMUP_FRAMES + numFrames; frame++ ) {
+        const auto start = std::chrono::steady_clock::now();
+        glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+        for( int drawIndex = 0; drawIndex < DRAWS_PER_FRAME; drawIndex++ ) {
+            const glm::mat4 modelMatrix = glm::rotate( glm::mat4(1.0f), glm::two_pi<float>() * static_cast<float>(drawIndex) / DRAWS_PER_FRAME, glm::vec3(0.0f, 1.0f, 0.0f) )
+                                        * glm::scale( glm::mat4(1.0f), glm::vec3(1.0f / extent) )
+                                        * glm::translate( glm::mat4(1.0f), -center );
+            const glm::mat4 mvpMatrix = projectionMatrix * viewMatrix * modelMatrix;
+            glUniformMatrix4fv( mvpLocation, 1, GL_FALSE, glm::value_ptr(mvpMatrix) );
+            model.draw( program );
+        }
+        glFinish();
+        if( frame >= WARMUP_FRAMES ) frameMilliseconds.push_back( CSCI441_INTERNAL::millisecondsSince( start ) );
+    }
+
+    std::sort( frameMilliseconds.begin(), frameMilliseconds.end() );
+    result.medianMilliseconds = frameMilliseconds[frameMilliseconds.size() / 2];
+    result.minMilliseconds = frameMilliseconds.front();
+    return glGetError() == GL_NO_ERROR;
+}
+
+int main( const int argc, char* argv[] ) {
+    if( !CSCI441_TESTS::createHeadlessContext() ) return 2;
+    printf( "[INFO]: OpenGL %s on %s\n", glGetString(GL_VERSION), glGetString(GL_RENDERER) );
+
+    std::string filename = argc > 1 ? argv[1] : "";
+    const int numFrames = argc > 2 ? std::max( 1, atoi(argv[2]) ) : 10;
+    const bool generated = filename.empty();
+    if( generated ) {
+        filename = "vertex_layout_bench.obj";
+        if( !writeSphereOBJ( filename.c_str(), 512, 256 ) ) {
+            fprintf( stderr, "[ERROR]: Could not write %s\n", filename.c_str() );
+            return 2;
+        }
+    }
+
+    GLuint framebuffer, renderbuffers[2];
+    glGenFramebuffers( 1, &framebuffer );
+    glGenRenderbuffers( 2, renderbuffers );
+    glBindRenderbuffer( GL_RENDERBUFFER, renderbuffers[0] );
+    glRenderbufferStorage( GL_RENDERBUFFER, GL_RGBA8, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE );
+    glBindRenderbuffer( GL_RENDERBUFFER, renderbuffers[1] );
+    glRenderbufferStorage( GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE );
+    glBindFramebuffer( GL_FRAMEBUFFER, framebuffer );
+    glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0] );
+    glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, renderbuffers[1] );
+    glViewport( 0, 0, FRAMEBUFFER_SIZE, FRAMEBUFFER_SIZE );
+    glEnable( GL_DEPTH_TEST );
+
+    const GLuint program = compileProgram();
+    if( program == 0 || glCheckFramebufferStatus( GL_FRAMEBUFFER ) != GL_FRAMEBUFFER_COMPLETE ) {
+        if( generated ) remove( filename.c_str() );
+        return 2;
+    }
+    glUseProgram( program );
+    const GLint mvpLocation = glGetUniformLocation( program, "mvpMatrix" );
+
+    CSCI441::ModelLoader::enableAutoGenerateTangents();
+
+    struct Layout {
+        const char* name;
+        bool interleaved;
+        bool packed;
+    };
+    const Layout layouts[] = {
+        { "separate",    false, false },
+        { "interleaved", true,  false },
+        { "packed",      true,  true  }
+    };
+
+    int failures = 0;
+    for( const auto& layout : layouts ) {
+        if( layout.interleaved ) CSCI441::ModelLoader::enableInterleavedVertexLayout();
+        else CSCI441::ModelLoader::disableInterleavedVertexLayout();
+        if( layout.packed ) CSCI441::ModelLoader::enablePackedVertexAttributes();
+        else CSCI441::ModelLoader::disablePackedVertexAttributes();
+
+        GLuint numVertices = 0, numIndices = 0;
+        LayoutResult result;
+        if( !timeLayout( filename, program, mvpLocation, numFrames, numVertices, numIndices, result ) ) {
+            fprintf( stderr, "[ERROR]: Could not time the %s layout\n", layout.name );
+            failures++;
+            continue;
+        }
+        if( &layout == layouts ) {
+            printf( "[INFO]: %u vertices, %u triangles, %d draws per frame, %d frames\n", numVertices, numIndices / 3, DRAWS_PER_FRAME, numFrames );
+            printf( "%-12s %14s %14s %14s %14s\n", "layout", "bytes/vertex", "median ms", "min ms", "Mverts/s" );
+        }
+        const double verticesPerFrame = static_cast<double>(numIndices) * DRAWS_PER_FRAME;
+        printf( "%-12s %14.1f %14.2f %14.2f %14.1f\n", layout.name,
+                static_cast<double>(result.bufferBytes) / std::max( numVertices, 1u ),
+                result.medianMilliseconds, result.minMilliseconds,
+                verticesPerFrame / (result.medianMilliseconds * 1000.0) );
+    }
+
+    glDeleteProgram( program );
+    glDeleteFramebuffers( 1, &framebuffer );
+    glDeleteRenderbuffers( 2, renderbuffers );
+    if( generated ) remove( filename.c_str() );
+    return failures == 0 ? 0 : 1;
+}
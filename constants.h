@@ -20,7 +20,7 @@ namespace CSCI441 {
     /**
      * @brief library minor version
      */
-    inline constexpr int VERSION_MINOR = 1;
+    inline constexpr int VERSION_MINOR = 2;
     /**
      * @brief library revision version
      */
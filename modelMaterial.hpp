@@ -22,9 +22,13 @@
 
 #include <glm/ext/vector_float4.hpp>
 
+#include <string>
+
 namespace CSCI441_INTERNAL {
 
   struct ModelMaterial {
+      static constexpr GLuint NO_TEXTURE = 0;
+
       glm::vec4 ambient;
       glm::vec4 diffuse;
       glm::vec4 specular;
@@ -33,6 +37,8 @@ namespace CSCI441_INTERNAL {
 
       GLuint map_Kd;
       [[maybe_unused]] GLuint map_d;
+      std::string map_KdFilename;
+      std::string map_dFilename;
 
       ModelMaterial() :
         ambient( 0.0f, 0.0f, 0.0f, 1.0f ),
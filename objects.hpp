@@ -331,6 +331,367 @@ namespace CSCI441 {
      * @note Torus is oriented in the XY-plane with the origin at its center
      */
     [[maybe_unused]] void drawWireTorus( GLfloat innerRadius, GLfloat outerRadius, GLint sides, GLint rings );
+
+    /**
+     * @brief Sets the attribute locations for the per instance model matrix and color read by the instanced draw functions
+     * @param modelMatrixLocation first of four consecutive locations of the mat4 model matrix attribute
+     * @param colorLocation location of the vec4 color attribute
+     * @param storageBlockBinding shader storage block binding to bind the instance buffer to instead when neither location is set
+     * @note Needs to be called after a shader program is being used and before drawing instanced geometry
+     * @note the instance buffer holds CSCI441::InstanceData records, with attributes set they advance once per instance,
+     * otherwise the shader reads them from a std430 storage block indexed by gl_InstanceID
+     * @note the number of draw calls an instanced object issues does not depend on the instance count, cubes and the
+     * teapot are a single call while objects built from strips issue one call per stack or ring
+     */
+    [[maybe_unused]] void setInstanceAttributeLocations( GLint modelMatrixLocation, GLint colorLocation = -1, GLuint storageBlockBinding = 0 );
+
+    /**
+     * @brief Draws instanceCount copies of a solid cone
+     * @param base radius of the base of the cone
+     * @param height height of the cone from the base to the tip
+     * @param stacks resolution of the number of steps rotated around the central axis of the cone
+     * @param slices resolution of the number of steps to take along the height
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre base must be greater than zero
+     * @pre height must be greater than zero
+     * @pre stacks must be greater than zero
+     * @pre slices must be greater than two
+     * @pre instanceCount must be greater than zero
+     * @note Cone is oriented along the y-axis with the origin along the base of the cone
+     */
+    [[maybe_unused]] void drawSolidConeInstanced( GLfloat base, GLfloat height, GLint stacks, GLint slices, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a wireframe cone
+     * @param base radius of the base of the cone
+     * @param height height of the cone from the base to the tip
+     * @param stacks resolution of the number of steps rotated around the central axis of the cone
+     * @param slices resolution of the number of steps to take along the height
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre base must be greater than zero
+     * @pre height must be greater than zero
+     * @pre stacks must be greater than zero
+     * @pre slices must be greater than two
+     * @pre instanceCount must be greater than zero
+     * @note Cone is oriented along the y-axis with the origin along the base of the cone
+     */
+    [[maybe_unused]] void drawWireConeInstanced( GLfloat base, GLfloat height, GLint stacks, GLint slices, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Calls through to drawSolidCubeIndexedInstanced()
+     * @param sideLength length of the edge of the cube
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre sideLength must be greater than zero
+     * @pre instanceCount must be greater than zero
+     */
+    [[maybe_unused]] void drawSolidCubeInstanced( GLfloat sideLength, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a solid cube with normals aligned with cube face
+     * @param sideLength length of the edge of the cube
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre sideLength must be greater than zero
+     * @pre instanceCount must be greater than zero
+     * @note The origin is at the cube's center of mass.  Cube is oriented with our XYZ axes
+     */
+    [[maybe_unused]] void drawSolidCubeFlatInstanced( GLfloat sideLength, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a solid cube
+     * @param sideLength length of the edge of the cube
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre sideLength must be greater than zero
+     * @pre instanceCount must be greater than zero
+     * @note The origin is at the cube's center of mass.  Cube is oriented with our XYZ axes
+     */
+    [[maybe_unused]] void drawSolidCubeIndexedInstanced( GLfloat sideLength, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a solid textured cube.  Calls through to drawSolidCubeFlatInstanced()
+     * @param sideLength length of the edge of the cube
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre sideLength must be greater than zero
+     * @pre instanceCount must be greater than zero
+     * @note The origin is at the cube's center of mass.  Cube is oriented with our XYZ axes
+     */
+    [[maybe_unused]] void drawSolidCubeTexturedInstanced( GLfloat sideLength, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a wireframe cube
+     * @param sideLength length of the edge of the cube
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre sideLength must be greater than zero
+     * @pre instanceCount must be greater than zero
+     * @note The origin is at the cube's center of mass.  Cube is oriented with our XYZ axes
+     */
+    [[maybe_unused]] void drawWireCubeInstanced( GLfloat sideLength, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a solid open-ended cylinder
+     * @param base radius of the base of the cylinder
+     * @param top radius of the top of the cylinder
+     * @param height height of the cylinder from the base to the top
+     * @param stacks resolution of the number of steps rotated around the central axis of the cylinder
+     * @param slices resolution of the number of steps to take along the height
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre either: (1) base is greater than zero and top is greater than or equal to zero or (2) base is greater than or equal to zero and top is greater than zero
+     * @pre height must be greater than zero
+     * @pre stacks must be greater than zero
+     * @pre slices must be greater than two
+     * @pre instanceCount must be greater than zero
+     * @note Cylinder is oriented along the y-axis with the origin along the base
+     */
+    [[maybe_unused]] void drawSolidCylinderInstanced( GLfloat base, GLfloat top, GLfloat height, GLint stacks, GLint slices, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a wireframe open-ended cylinder
+     * @param base radius of the base of the cylinder
+     * @param top radius of the top of the cylinder
+     * @param height height of the cylinder from the base to the top
+     * @param stacks resolution of the number of steps rotated around the central axis of the cylinder
+     * @param slices resolution of the number of steps to take along the height
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre either: (1) base is greater than zero and top is greater than or equal to zero or (2) base is greater than or equal to zero and top is greater than zero
+     * @pre height must be greater than zero
+     * @pre stacks must be greater than zero
+     * @pre slices must be greater than two
+     * @pre instanceCount must be greater than zero
+     * @note Cylinder is oriented along the y-axis with the origin along the base
+     */
+    [[maybe_unused]] void drawWireCylinderInstanced( GLfloat base, GLfloat top, GLfloat height, GLint stacks, GLint slices, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a solid disk
+     * @param inner equivalent to the width of the disk
+     * @param outer radius from the center of the disk to the center of the ring
+     * @param slices resolution of the number of steps rotated along the disk
+     * @param rings resolution of the number of steps to take along the disk width
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre inner is greater than or equal to zero
+     * @pre outer is greater than zero
+     * @pre outer is greater than inner
+     * @pre slices is greater than two
+     * @pre rings is greater than zero
+     * @pre instanceCount must be greater than zero
+     * @note Disk is drawn in the XY plane with the origin at its center
+     */
+    [[maybe_unused]] void drawSolidDiskInstanced( GLfloat inner, GLfloat outer, GLint slices, GLint rings, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a wireframe disk
+     * @param inner equivalent to the width of the disk
+     * @param outer radius from the center of the disk to the center of the ring
+     * @param slices resolution of the number of steps rotated along the disk
+     * @param rings resolution of the number of steps to take along the disk width
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre inner is greater than or equal to zero
+     * @pre outer is greater than zero
+     * @pre outer is greater than inner
+     * @pre slices is greater than two
+     * @pre rings is greater than zero
+     * @pre instanceCount must be greater than zero
+     * @note Disk is drawn in the XY plane with the origin at its center
+     */
+    [[maybe_unused]] void drawWireDiskInstanced( GLfloat inner, GLfloat outer, GLint slices, GLint rings, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws part of instanceCount solid disks
+     * @param inner equivalent to the width of the disk
+     * @param outer radius from the center of the disk to the center of the ring
+     * @param slices resolution of the number of steps rotated along the disk
+     * @param rings resolution of the number of steps to take along the disk width
+     * @param start angle in degrees to start the disk at
+     * @param sweep distance in degrees to rotate through
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre inner is greater than or equal to zero
+     * @pre outer is greater than zero
+     * @pre outer is greater than inner
+     * @pre slices is greater than two
+     * @pre rings is greater than zero
+     * @pre start is between [0, 360]
+     * @pre sweep is between [0, 360]
+     * @pre instanceCount must be greater than zero
+     * @note Disk is drawn in the XY plane with the origin at its center
+     */
+    [[maybe_unused]] void drawSolidPartialDiskInstanced( GLfloat inner, GLfloat outer, GLint slices, GLint rings, GLfloat start, GLfloat sweep, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws part of instanceCount wireframe disks
+     * @param inner equivalent to the width of the disk
+     * @param outer radius from the center of the disk to the center of the ring
+     * @param slices resolution of the number of steps rotated along the disk
+     * @param rings resolution of the number of steps to take along the disk width
+     * @param start angle in degrees to start the disk at
+     * @param sweep distance in degrees to rotate through
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre inner is greater than or equal to zero
+     * @pre outer is greater than zero
+     * @pre outer is greater than inner
+     * @pre slices is greater than two
+     * @pre rings is greater than zero
+     * @pre start is between [0, 360]
+     * @pre sweep is between [0, 360]
+     * @pre instanceCount must be greater than zero
+     * @note Disk is drawn in the XY plane with the origin at its center
+     */
+    [[maybe_unused]] void drawWirePartialDiskInstanced( GLfloat inner, GLfloat outer, GLint slices, GLint rings, GLfloat start, GLfloat sweep, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a solid sphere
+     * @param radius radius of the sphere
+     * @param stacks resolution of the number of steps to take along theta (rotate around Y-axis)
+     * @param slices resolution of the number of steps to take along phi (rotate around X- or Z-axis)
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre radius must be greater than 0
+     * @pre stacks must be greater than 2
+     * @pre slices must be greater than 2
+     * @pre instanceCount must be greater than zero
+     * @note Origin is at the center of the sphere
+     */
+    [[maybe_unused]] void drawSolidSphereInstanced( GLfloat radius, GLint stacks, GLint slices, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a wireframe sphere
+     * @param radius radius of the sphere
+     * @param stacks resolution of the number of steps to take along theta (rotate around Y-axis)
+     * @param slices resolution of the number of steps to take along phi (rotate around X- or Z-axis)
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre radius must be greater than 0
+     * @pre stacks must be greater than 2
+     * @pre slices must be greater than 2
+     * @pre instanceCount must be greater than zero
+     * @note Origin is at the center of the sphere
+     */
+    [[maybe_unused]] void drawWireSphereInstanced( GLfloat radius, GLint stacks, GLint slices, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a solid half sphere with a bottom
+     * @param radius radius of the sphere
+     * @param stacks resolution of the number of steps to take along theta (rotate around Y-axis)
+     * @param slices resolution of the number of steps to take along phi (rotate around X- or Z-axis)
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre radius must be greater than 0
+     * @pre stacks must be greater than 2
+     * @pre slices must be greater than 2
+     * @pre instanceCount must be greater than zero
+     * @note Origin is at the center of the sphere
+     */
+    [[maybe_unused]] void drawSolidHalfSphereInstanced( GLfloat radius, GLint stacks, GLint slices, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a wireframe half sphere with a bottom
+     * @param radius radius of the sphere
+     * @param stacks resolution of the number of steps to take along theta (rotate around Y-axis)
+     * @param slices resolution of the number of steps to take along phi (rotate around X- or Z-axis)
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre radius must be greater than 0
+     * @pre stacks must be greater than 2
+     * @pre slices must be greater than 2
+     * @pre instanceCount must be greater than zero
+     * @note Origin is at the center of the sphere
+     */
+    [[maybe_unused]] void drawWireHalfSphereInstanced( GLfloat radius, GLint stacks, GLint slices, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a solid dome
+     * @param radius radius of the dome
+     * @param stacks resolution of the number of steps to take along theta (rotate around Y-axis)
+     * @param slices resolution of the number of steps to take along phi (rotate around X- or Z-axis)
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre radius must be greater than 0
+     * @pre stacks must be greater than 2
+     * @pre slices must be greater than 2
+     * @pre instanceCount must be greater than zero
+     * @note Origin is at the center of the dome
+     */
+    [[maybe_unused]] void drawSolidDomeInstanced( GLfloat radius, GLint stacks, GLint slices, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a wireframe dome
+     * @param radius radius of the dome
+     * @param stacks resolution of the number of steps to take along theta (rotate around Y-axis)
+     * @param slices resolution of the number of steps to take along phi (rotate around X- or Z-axis)
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre radius must be greater than 0
+     * @pre stacks must be greater than 2
+     * @pre slices must be greater than 2
+     * @pre instanceCount must be greater than zero
+     * @note Origin is at the center of the dome
+     */
+    [[maybe_unused]] void drawWireDomeInstanced( GLfloat radius, GLint stacks, GLint slices, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a solid teapot
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre size must be greater than zero
+     * @pre instanceCount must be greater than zero
+     * @note Oriented with spout and handle running along X-axis, cap and bottom along Y-axis.  Origin is at the center of the teapot
+     */
+    [[maybe_unused]] void drawSolidTeapotInstanced( GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a wireframe teapot
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre size must be greater than zero
+     * @pre instanceCount must be greater than zero
+     * @note Oriented with spout and handle running along X-axis, cap and bottom along Y-axis.  Origin is at the center of the teapot
+     */
+    [[maybe_unused]] void drawWireTeapotInstanced( GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a solid torus
+     * @param innerRadius equivalent to the width of the torus ring
+     * @param outerRadius radius from the center of the torus to the center of the ring
+     * @param sides resolution of steps to take around the band of the ring
+     * @param rings resolution of steps to take around the torus
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre innerRadius must be greater than zero
+     * @pre outerRadius must be greater than zero
+     * @pre sides must be greater than two
+     * @pre rings must be greater than two
+     * @pre instanceCount must be greater than zero
+     * @note Torus is oriented in the XY-plane with the origin at its center
+     */
+    [[maybe_unused]] void drawSolidTorusInstanced( GLfloat innerRadius, GLfloat outerRadius, GLint sides, GLint rings, GLsizei instanceCount, GLuint instanceBuffer );
+
+    /**
+     * @brief Draws instanceCount copies of a wireframe torus
+     * @param innerRadius equivalent to the width of the torus ring
+     * @param outerRadius radius from the center of the torus to the center of the ring
+     * @param sides resolution of steps to take around the band of the ring
+     * @param rings resolution of steps to take around the torus
+     * @param instanceCount number of instances to draw
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     * @pre innerRadius must be greater than zero
+     * @pre outerRadius must be greater than zero
+     * @pre sides must be greater than two
+     * @pre rings must be greater than two
+     * @pre instanceCount must be greater than zero
+     * @note Torus is oriented in the XY-plane with the origin at its center
+     */
+    [[maybe_unused]] void drawWireTorusInstanced( GLfloat innerRadius, GLfloat outerRadius, GLint sides, GLint rings, GLsizei instanceCount, GLuint instanceBuffer );
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -664,4 +1025,421 @@ inline void CSCI441::drawWireTorus(
     CSCI441_INTERNAL::drawTorus( innerRadius, outerRadius, sides, rings, GL_LINE );
 }
 
+[[maybe_unused]]
+inline void CSCI441::setInstanceAttributeLocations(
+    const GLint modelMatrixLocation,
+    const GLint colorLocation,
+    const GLuint storageBlockBinding
+) {
+    CSCI441_INTERNAL::_instanceModelMatrixLocation = modelMatrixLocation;
+    CSCI441_INTERNAL::_instanceColorLocation = colorLocation;
+    CSCI441_INTERNAL::_instanceStorageBlockBinding = storageBlockBinding;
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidConeInstanced(
+    const GLfloat base,
+    const GLfloat height,
+    const GLint stacks,
+    const GLint slices,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( base > 0.0f );
+    assert( height > 0.0f );
+    assert( stacks > 0 );
+    assert( slices > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawCylinder( base, 0.0f, height, stacks, slices, GL_FILL );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawWireConeInstanced(
+    const GLfloat base,
+    const GLfloat height,
+    const GLint stacks,
+    const GLint slices,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( base > 0.0f );
+    assert( height > 0.0f );
+    assert( stacks > 0 );
+    assert( slices > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawCylinder( base, 0.0f, height, stacks, slices, GL_LINE );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidCubeInstanced(
+    const GLfloat sideLength,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    drawSolidCubeIndexedInstanced(sideLength, instanceCount, instanceBuffer);
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidCubeFlatInstanced(
+    const GLfloat sideLength,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( sideLength > 0.0f );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawCubeFlat( sideLength, GL_FILL );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidCubeIndexedInstanced(
+    const GLfloat sideLength,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( sideLength > 0.0f );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawCube( sideLength, GL_FILL );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidCubeTexturedInstanced(
+    const GLfloat sideLength,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    drawSolidCubeFlatInstanced(sideLength, instanceCount, instanceBuffer);
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawWireCubeInstanced(
+    const GLfloat sideLength,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( sideLength > 0.0f );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawCube( sideLength, GL_LINE );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidCylinderInstanced(
+    const GLfloat base,
+    const GLfloat top,
+    const GLfloat height,
+    const GLint stacks,
+    const GLint slices,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( (base >= 0.0f && top > 0.0f) || (base > 0.0f && top >= 0.0f) );
+    assert( height > 0.0f );
+    assert( stacks > 0 );
+    assert( slices > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawCylinder( base, top, height, stacks, slices, GL_FILL );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawWireCylinderInstanced(
+    const GLfloat base,
+    const GLfloat top,
+    const GLfloat height,
+    const GLint stacks,
+    const GLint slices,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( (base >= 0.0f && top > 0.0f) || (base > 0.0f && top >= 0.0f) );
+    assert( height > 0.0f );
+    assert( stacks > 0 );
+    assert( slices > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawCylinder( base, top, height, stacks, slices, GL_LINE );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidDiskInstanced(
+    const GLfloat inner,
+    const GLfloat outer,
+    const GLint slices,
+    const GLint rings,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( inner >= 0.0f );
+    assert( outer > 0.0f );
+    assert( outer > inner );
+    assert( slices > 2 );
+    assert( rings > 0 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawPartialDisk( inner, outer, slices, rings, 0, glm::two_pi<GLfloat>(), GL_FILL );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawWireDiskInstanced(
+    const GLfloat inner,
+    const GLfloat outer,
+    const GLint slices,
+    const GLint rings,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( inner >= 0.0f );
+    assert( outer > 0.0f );
+    assert( outer > inner );
+    assert( slices > 2 );
+    assert( rings > 0 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawPartialDisk( inner, outer, slices, rings, 0, glm::two_pi<GLfloat>(), GL_LINE );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidPartialDiskInstanced(
+    const GLfloat inner,
+    const GLfloat outer,
+    const GLint slices,
+    const GLint rings,
+    const GLfloat start,
+    const GLfloat sweep,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( inner >= 0.0f );
+    assert( outer > 0.0f );
+    assert( outer > inner );
+    assert( slices > 2 );
+    assert( rings > 0 );
+    assert( start >= 0.0f && start <= 360.0f );
+    assert( sweep >= 0.0f && sweep <= 360.0f );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawPartialDisk( inner, outer, slices, rings, start * glm::pi<float>() / 180.0f, sweep * glm::pi<float>() / 180.0f, GL_FILL );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawWirePartialDiskInstanced(
+    const GLfloat inner,
+    const GLfloat outer,
+    const GLint slices,
+    const GLint rings,
+    const GLfloat start,
+    const GLfloat sweep,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( inner >= 0.0f );
+    assert( outer > 0.0f );
+    assert( outer > inner );
+    assert( slices > 2 );
+    assert( rings > 0 );
+    assert( start >= 0.0f && start <= 360.0f );
+    assert( sweep >= 0.0f && sweep <= 360.0f );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawPartialDisk( inner, outer, slices, rings, start * glm::pi<float>() / 180.0f, sweep * glm::pi<float>() / 180.0f, GL_LINE );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidSphereInstanced(
+    const GLfloat radius,
+    const GLint stacks,
+    const GLint slices,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( radius > 0.0f );
+    assert( stacks > 1 );
+    assert( slices > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawSphere( radius, stacks, slices, GL_FILL );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawWireSphereInstanced(
+    const GLfloat radius,
+    const GLint stacks,
+    const GLint slices,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( radius > 0.0f );
+    assert( stacks > 1);
+    assert( slices > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawSphere( radius, stacks, slices, GL_LINE );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidHalfSphereInstanced(
+    const GLfloat radius,
+    const GLint stacks,
+    const GLint slices,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( radius > 0.0f );
+    assert( stacks > 1 );
+    assert( slices > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawHalfSphere( radius, stacks, slices, GL_FILL );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawWireHalfSphereInstanced(
+    const GLfloat radius,
+    const GLint stacks,
+    const GLint slices,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( radius > 0.0f );
+    assert( stacks > 1);
+    assert( slices > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawHalfSphere( radius, stacks, slices, GL_LINE );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidDomeInstanced(
+    const GLfloat radius,
+    const GLint stacks,
+    const GLint slices,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( radius > 0.0f );
+    assert( stacks > 1 );
+    assert( slices > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawDome( radius, stacks, slices, GL_FILL );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawWireDomeInstanced(
+    const GLfloat radius,
+    const GLint stacks,
+    const GLint slices,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( radius > 0.0f );
+    assert( stacks > 1);
+    assert( slices > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawDome( radius, stacks, slices, GL_LINE );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidTeapotInstanced(
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawTeapot(GL_FILL);
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawWireTeapotInstanced(
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawTeapot(GL_LINE);
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawSolidTorusInstanced(
+    const GLfloat innerRadius,
+    const GLfloat outerRadius,
+    const GLint sides,
+    const GLint rings,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( innerRadius > 0.0f );
+    assert( outerRadius > 0.0f );
+    assert( sides > 2 );
+    assert( rings > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawTorus( innerRadius, outerRadius, sides, rings, GL_FILL );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
+[[maybe_unused]]
+inline void CSCI441::drawWireTorusInstanced(
+    const GLfloat innerRadius,
+    const GLfloat outerRadius,
+    const GLint sides,
+    const GLint rings,
+    const GLsizei instanceCount,
+    const GLuint instanceBuffer
+) {
+    assert( innerRadius > 0.0f );
+    assert( outerRadius > 0.0f );
+    assert( sides > 2 );
+    assert( rings > 2 );
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::setInstances( instanceCount, instanceBuffer );
+    CSCI441_INTERNAL::drawTorus( innerRadius, outerRadius, sides, rings, GL_LINE );
+    CSCI441_INTERNAL::setInstances( 0, 0 );
+}
+
 #endif // __CSCI441_OBJECTS_HPP__
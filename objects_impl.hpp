@@ -146,6 +146,57 @@ namespace CSCI441_INTERNAL {
      */
     inline GLint _tangentAttributeLocation = -1;
 
+    /**
+     * @brief first of the four consecutive locations of the per instance model matrix attribute within the shader being rendered with
+     */
+    inline GLint _instanceModelMatrixLocation = -1;
+    /**
+     * @brief location of the per instance color attribute within the shader being rendered with
+     */
+    inline GLint _instanceColorLocation = -1;
+    /**
+     * @brief shader storage block binding the instance buffer is bound to when no instance attribute locations are set
+     */
+    inline GLuint _instanceStorageBlockBinding = 0;
+    /**
+     * @brief number of instances the next draw will render, zero when not drawing instanced
+     */
+    inline GLsizei _instanceCount = 0;
+    /**
+     * @brief buffer of CSCI441::InstanceData the next instanced draw reads from
+     */
+    inline GLuint _instanceBuffer = 0;
+
+    /**
+     * @brief sets the instances the following draw renders
+     * @param instanceCount number of instances to draw, zero to draw a single non-instanced object
+     * @param instanceBuffer buffer of CSCI441::InstanceData with at least instanceCount entries
+     */
+    void setInstances( GLsizei instanceCount, GLuint instanceBuffer );
+    /**
+     * @brief binds the per instance attributes to the currently bound VAO if drawing instanced
+     */
+    void bindInstances();
+    /**
+     * @brief restores the currently bound VAO to per vertex attributes if drawing instanced
+     */
+    void releaseInstances();
+    /**
+     * @brief issues glDrawArrays or glDrawArraysInstanced depending on the current instance count
+     * @param mode primitive type to draw
+     * @param first starting index in the enabled arrays
+     * @param count number of vertices to draw
+     */
+    void drawArrays( GLenum mode, GLint first, GLsizei count );
+    /**
+     * @brief issues glDrawElements or glDrawElementsInstanced depending on the current instance count
+     * @param mode primitive type to draw
+     * @param count number of elements to draw
+     * @param type type of the values in the index buffer
+     * @param indices offset into the bound index buffer
+     */
+    void drawElements( GLenum mode, GLsizei count, GLenum type, const void* indices );
+
     /**
      * @brief creates the VAO + VBO using 36 vertices
      * @param sideLength
@@ -379,6 +430,39 @@ inline void CSCI441_INTERNAL::deleteObjectVBOs() {
     _torusVBO.clear();
 }
 
+inline void CSCI441_INTERNAL::setInstances( const GLsizei instanceCount, const GLuint instanceBuffer ) {
+    _instanceCount = instanceCount;
+    _instanceBuffer = instanceBuffer;
+}
+
+inline void CSCI441_INTERNAL::bindInstances() {
+    if( _instanceCount > 0 ) {
+        bindInstanceAttributes( _instanceBuffer, _instanceModelMatrixLocation, _instanceColorLocation, _instanceStorageBlockBinding );
+    }
+}
+
+inline void CSCI441_INTERNAL::releaseInstances() {
+    if( _instanceCount > 0 ) {
+        releaseInstanceAttributes( _instanceModelMatrixLocation, _instanceColorLocation );
+    }
+}
+
+inline void CSCI441_INTERNAL::drawArrays( const GLenum mode, const GLint first, const GLsizei count ) {
+    if( _instanceCount > 0 ) {
+        glDrawArraysInstanced( mode, first, count, _instanceCount );
+    } else {
+        glDrawArrays( mode, first, count );
+    }
+}
+
+inline void CSCI441_INTERNAL::drawElements( const GLenum mode, const GLsizei count, const GLenum type, const void* indices ) {
+    if( _instanceCount > 0 ) {
+        glDrawElementsInstanced( mode, count, type, indices, _instanceCount );
+    } else {
+        glDrawElements( mode, count, type, indices );
+    }
+}
+
 inline void CSCI441_INTERNAL::drawCube( const GLfloat sideLength, const GLenum renderMode ) {
     drawCubeIndexed(sideLength, renderMode);
 }
@@ -412,9 +496,11 @@ inline void CSCI441_INTERNAL::drawCubeFlat( const GLfloat sideLength, const GLen
         glEnableVertexAttribArray( _tangentAttributeLocation );
         glVertexAttribPointer( _tangentAttributeLocation, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(sizeof(glm::vec3) * NUM_VERTICES * 2 + sizeof(glm::vec2) * NUM_VERTICES) );
     }
+    bindInstances();
 
-    glDrawArrays( GL_TRIANGLES, 0, 36 );
+    drawArrays( GL_TRIANGLES, 0, 36 );
 
+    releaseInstances();
     glPolygonMode( GL_FRONT_AND_BACK, currentPolygonMode[0] );
 }
 
@@ -447,9 +533,11 @@ inline void CSCI441_INTERNAL::drawCubeIndexed( const GLfloat sideLength, const G
         glEnableVertexAttribArray( _tangentAttributeLocation );
         glVertexAttribPointer( _tangentAttributeLocation, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(sizeof(glm::vec3) * NUM_VERTICES * 2 + sizeof(glm::vec2) * NUM_VERTICES) );
     }
+    bindInstances();
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_SHORT, nullptr);
+    drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_SHORT, nullptr);
 
+    releaseInstances();
     glPolygonMode( GL_FRONT_AND_BACK, currentPolygonMode[0] );
 }
 
@@ -483,11 +571,13 @@ inline void CSCI441_INTERNAL::drawCylinder( const GLfloat base, const GLfloat to
         glEnableVertexAttribArray( _tangentAttributeLocation );
         glVertexAttribPointer( _tangentAttributeLocation, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(sizeof(glm::vec3) * NUM_VERTICES * 2 + sizeof(glm::vec2) * NUM_VERTICES) );
     }
+    bindInstances();
 
     for(GLuint stackNum = 0; stackNum < stacks; stackNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+1)*2*stackNum), static_cast<GLint>((slices+1)*2) );
+        drawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+1)*2*stackNum), static_cast<GLint>((slices+1)*2) );
     }
 
+    releaseInstances();
     glPolygonMode( GL_FRONT_AND_BACK, currentPolygonMode[0] );
 }
 
@@ -521,11 +611,13 @@ inline void CSCI441_INTERNAL::drawPartialDisk(const GLfloat innerRadius, const G
         glEnableVertexAttribArray( _tangentAttributeLocation );
         glVertexAttribPointer( _tangentAttributeLocation, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(sizeof(glm::vec3) * NUM_VERTICES * 2 + sizeof(glm::vec2) * NUM_VERTICES) );
     }
+    bindInstances();
 
     for(GLuint ringNum = 0; ringNum < rings; ringNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+1)*2*ringNum), static_cast<GLint>((slices+1)*2) );
+        drawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+1)*2*ringNum), static_cast<GLint>((slices+1)*2) );
     }
 
+    releaseInstances();
     glPolygonMode( GL_FRONT_AND_BACK, currentPolygonMode[0] );
 }
 
@@ -559,15 +651,17 @@ inline void CSCI441_INTERNAL::drawSphere( const GLfloat radius, const GLuint sta
         glEnableVertexAttribArray( _tangentAttributeLocation );
         glVertexAttribPointer( _tangentAttributeLocation, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(sizeof(glm::vec3) * NUM_VERTICES * 2 + sizeof(glm::vec2) * NUM_VERTICES) );
     }
+    bindInstances();
 
-    glDrawArrays( GL_TRIANGLE_FAN, 0, static_cast<GLint>(slices+2) );
+    drawArrays( GL_TRIANGLE_FAN, 0, static_cast<GLint>(slices+2) );
 
     for(GLuint stackNum = 1; stackNum < stacks-1; stackNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>((slices+1)*2) );
+        drawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>((slices+1)*2) );
     }
 
-    glDrawArrays( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2) + (stacks-2)*(slices+1)*2), static_cast<GLint>(slices+2) );
+    drawArrays( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2) + (stacks-2)*(slices+1)*2), static_cast<GLint>(slices+2) );
 
+    releaseInstances();
     glPolygonMode( GL_FRONT_AND_BACK, currentPolygonMode[0] );
 }
 
@@ -601,15 +695,17 @@ inline void CSCI441_INTERNAL::drawHalfSphere( const GLfloat radius, const GLuint
         glEnableVertexAttribArray( _tangentAttributeLocation );
         glVertexAttribPointer( _tangentAttributeLocation, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(sizeof(glm::vec3) * NUM_VERTICES * 2 + sizeof(glm::vec2) * NUM_VERTICES) );
     }
+    bindInstances();
 
-    glDrawArrays( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2)/2), static_cast<GLint>((slices+2)/2) );
+    drawArrays( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2)/2), static_cast<GLint>((slices+2)/2) );
 
     for(GLuint stackNum = 1; stackNum < stacks-1; stackNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>(slices+2) );
+        drawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>(slices+2) );
     }
 
-    glDrawArrays( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2) + (stacks-2)*(slices+1)*2), static_cast<GLint>((slices+2)/2) );
+    drawArrays( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2) + (stacks-2)*(slices+1)*2), static_cast<GLint>((slices+2)/2) );
 
+    releaseInstances();
     glPolygonMode( GL_FRONT_AND_BACK, currentPolygonMode[0] );
 
     drawPartialDisk(0.0f, radius, slices, stacks, 0.0f, glm::two_pi<GLfloat>(), renderMode);
@@ -645,13 +741,15 @@ inline void CSCI441_INTERNAL::drawDome( const GLfloat radius, const GLuint stack
         glEnableVertexAttribArray( _tangentAttributeLocation );
         glVertexAttribPointer( _tangentAttributeLocation, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(sizeof(glm::vec3) * NUM_VERTICES * 2 + sizeof(glm::vec2) * NUM_VERTICES) );
     }
+    bindInstances();
 
-    glDrawArrays( GL_TRIANGLE_FAN, 0, static_cast<GLint>(slices+2) );
+    drawArrays( GL_TRIANGLE_FAN, 0, static_cast<GLint>(slices+2) );
 
     for(GLuint stackNum = (stacks-1)/2; stackNum < stacks-1; stackNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>((slices+1)*2) );
+        drawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>((slices+1)*2) );
     }
 
+    releaseInstances();
     glPolygonMode( GL_FRONT_AND_BACK, currentPolygonMode[0] );
 }
 
@@ -685,11 +783,13 @@ inline void CSCI441_INTERNAL::drawTorus( const GLfloat innerRadius, const GLfloa
         glEnableVertexAttribArray( _tangentAttributeLocation );
         glVertexAttribPointer( _tangentAttributeLocation, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void *>(sizeof(glm::vec3) * NUM_VERTICES * 2 + sizeof(glm::vec2) * NUM_VERTICES) );
     }
+    bindInstances();
 
     for(GLuint ringNum = 0; ringNum < rings; ringNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>(ringNum*sides*4), static_cast<GLint>(sides*4) );
+        drawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>(ringNum*sides*4), static_cast<GLint>(sides*4) );
     }
 
+    releaseInstances();
     glPolygonMode( GL_FRONT_AND_BACK, currentPolygonMode[0] );
 }
 
@@ -698,7 +798,11 @@ inline void CSCI441_INTERNAL::drawTeapot( const GLenum renderMode ) {
     glGetIntegerv(GL_POLYGON_MODE, currentPolygonMode);
 
     glPolygonMode( GL_FRONT_AND_BACK, renderMode );
-    teapot();
+    if( _instanceCount > 0 ) {
+        teapotInstanced( _instanceCount, _instanceBuffer, _instanceModelMatrixLocation, _instanceColorLocation, _instanceStorageBlockBinding );
+    } else {
+        teapot();
+    }
     glPolygonMode( GL_FRONT_AND_BACK, currentPolygonMode[0] );
 }
 
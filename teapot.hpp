@@ -18,6 +18,7 @@
 #define CSCI441_TEAPOT_HPP
 
 #include "constants.h"
+#include "OpenGLUtils.hpp"
 
 #ifdef CSCI441_USE_GLEW
     #include <GL/glew.h>
@@ -51,6 +52,15 @@ namespace CSCI441_INTERNAL {
     // setTeapotAttributeLocations() must be called first
     void teapot();
 
+    // Draws instanceCount copies of the Utah teapot in a single draw call
+    // GLsizei number of instances to draw
+    // GLuint buffer of CSCI441::InstanceData with at least instanceCount entries
+    // GLint first of four consecutive model matrix attribute locations within shader program (-1 to read from a storage block)
+    // GLint instance color attribute location within shader program (-1 if unused)
+    // GLuint shader storage block binding used when both attribute locations are -1
+    // setTeapotAttributeLocations() must be called first
+    void teapotInstanced(GLsizei instanceCount, GLuint instanceBuffer, GLint modelMatrixLocation, GLint colorLocation, GLuint storageBlockBinding);
+
     //************************************************************************************************
     //************************************************************************************************
 
@@ -684,6 +694,14 @@ namespace CSCI441_INTERNAL {
         glBindBuffer(GL_ARRAY_BUFFER, teapot_vbo);
         glDrawElements(GL_TRIANGLES, sizeof(teapot_elements)/sizeof(teapot_elements[0]), GL_UNSIGNED_SHORT, nullptr);
     }
+
+    inline void teapotInstanced(const GLsizei instanceCount, const GLuint instanceBuffer, const GLint modelMatrixLocation, const GLint colorLocation, const GLuint storageBlockBinding) {
+        glBindVertexArray(teapot_vao );
+        bindInstanceAttributes(instanceBuffer, modelMatrixLocation, colorLocation, storageBlockBinding);
+        glBindBuffer(GL_ARRAY_BUFFER, teapot_vbo);
+        glDrawElementsInstanced(GL_TRIANGLES, sizeof(teapot_elements)/sizeof(teapot_elements[0]), GL_UNSIGNED_SHORT, nullptr, instanceCount);
+        releaseInstanceAttributes(modelMatrixLocation, colorLocation);
+    }
 }
 
 
@@ -0,0 +1,179 @@
+// Draws an OBJ model whose materials use two different diffuse textures and
+// one material without a texture with drawBatched(), then reads back the
+// framebuffer.  Each third of the screen must show the texture of its own
+// material, and the untextured third the texture the caller bound, each
+// tinted by the diffuse color of its own material record.  Without
+// ARB_shader_draw_parameters (e.g. MESA_EXTENSION_OVERRIDE=-GL_ARB_shader_draw_parameters)
+// the shader reads materials[0] and the per range fallback is tested.
+
+#define CSCI441_TEXTURE_UTILS_IMPLEMENTATION
+#include "../TextureUtils.hpp"
+#include "../ModelLoader.hpp"
+#include "headless_context.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+static constexpr GLsizei FRAMEBUFFER_WIDTH = 96;
+static constexpr GLsizei FRAMEBUFFER_HEIGHT = 32;
+
+static const char* VERTEX_SHADER = R"(
+#version 410 core
+#extension GL_ARB_shader_draw_parameters : enable
+layout(location = 0) in vec3 vPos;
+layout(location = 2) in vec2 vTexCoord;
+out vec2 texCoord;
+flat out int drawID;
+void main() {
+    gl_Position = vec4(vPos, 1.0);
+    texCoord = vTexCoord;
+#ifdef GL_ARB_shader_draw_parameters
+    drawID = gl_DrawIDARB;
+#else
+    drawID = 0;
+#endif
+}
+)";
+
+static const char* FRAGMENT_SHADER = R"(
+#version 410 core
+struct Material { vec4 ambient; vec4 diffuse; vec4 specular; float shininess; };
+layout(std140) uniform Materials { Material materials[3]; };
+uniform sampler2D diffuseMap;
+in vec2 texCoord;
+flat in int drawID;
+out vec4 fragColorOut;
+void main() {
+    fragColorOut = texture(diffuseMap, texCoord) * materials[drawID].diffuse;
+}
+)";
+
+static bool writeSolidPPM( const char* filename, const unsigned char red, const unsigned char green, const unsigned char blue ) {
+    FILE* file = fopen( filename, "wb" );
+    if( file == nullptr ) return false;
+    fprintf( file, "P6\n4 4\n255\n" );
+    for( int i = 0; i < 16; i++ ) {
+        const unsigned char pixel[3] = { red, green, blue };
+        fwrite( pixel, 1, sizeof(pixel), file );
+    }
+    return fclose( file ) == 0;
+}
+
+static bool writeModel() {
+    FILE* mtl = fopen( "draw_batched_textures_test.mtl", "w" );
+    if( mtl == nullptr ) return false;
+    fprintf( mtl, "newmtl a_untextured\nKd 0 0 1\n\n" );
+    fprintf( mtl, "newmtl b_yellow\nKd 1 0.5 1\nmap_Kd draw_batched_textures_test_yellow.ppm\n\n" );
+    fprintf( mtl, "newmtl c_cyan\nKd 1 1 0.5\nmap_Kd draw_batched_textures_test_cyan.ppm\n" );
+    if( fclose( mtl ) != 0 ) return false;
+
+    FILE* obj = fopen( "draw_batched_textures_test.obj", "w" );
+    if( obj == nullptr ) return false;
+    fprintf( obj, "mtllib draw_batched_textures_test.mtl\nvt 0.25 0.25\nvt 0.75 0.25\nvt 0.75 0.75\nvt 0.25 0.75\n" );
+    const char* materialNames[3] = { "a_untextured", "b_yellow", "c_cyan" };
+    for( int quad = 0; quad < 3; quad++ ) {
+        const float left = -1.0f + 2.0f * static_cast<float>(quad) / 3.0f, right = left + 2.0f / 3.0f;
+        fprintf( obj, "v %f -1 0\nv %f -1 0\nv %f 1 0\nv %f 1 0\n", left, right, right, left );
+        fprintf( obj, "usemtl %s\nf %d/1 %d/2 %d/3 %d/4\n", materialNames[quad], quad * 4 + 1, quad * 4 + 2, quad * 4 + 3, quad * 4 + 4 );
+    }
+    return fclose( obj ) == 0;
+}
+
+static GLuint compileProgram() {
+    const auto compile = []( const GLenum type, const char* source ) {
+        const GLuint shader = glCreateShader( type );
+        glShaderSource( shader, 1, &source, nullptr );
+        glCompileShader( shader );
+        return shader;
+    };
+    const GLuint vertexShader = compile( GL_VERTEX_SHADER, VERTEX_SHADER );
+    const GLuint fragmentShader = compile( GL_FRAGMENT_SHADER, FRAGMENT_SHADER );
+    const GLuint program = glCreateProgram();
+    glAttachShader( program, vertexShader );
+    glAttachShader( program, fragmentShader );
+    glLinkProgram( program );
+    glDeleteShader( vertexShader );
+    glDeleteShader( fragmentShader );
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv( program, GL_LINK_STATUS, &linked );
+    return linked == GL_TRUE ? program : 0;
+}
+
+static void removeFiles() {
+    remove( "draw_batched_textures_test.obj" );
+    remove( "draw_batched_textures_test.mtl" );
+    remove( "draw_batched_textures_test_yellow.ppm" );
+    remove( "draw_batched_textures_test_cyan.ppm" );
+}
+
+int main() {
+    if( !CSCI441_TESTS::createHeadlessContext() ) return 2;
+
+    if( !writeModel()
+        || !writeSolidPPM( "draw_batched_textures_test_yellow.ppm", 255, 255, 0 )
+        || !writeSolidPPM( "draw_batched_textures_test_cyan.ppm", 0, 255, 255 ) ) {
+        fprintf( stderr, "[ERROR]: Could not write the test model\n" );
+        removeFiles();
+        return 2;
+    }
+
+    GLuint framebuffer, renderbuffer;
+    glGenFramebuffers( 1, &framebuffer );
+    glGenRenderbuffers( 1, &renderbuffer );
+    glBindRenderbuffer( GL_RENDERBUFFER, renderbuffer );
+    glRenderbufferStorage( GL_RENDERBUFFER, GL_RGBA8, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT );
+    glBindFramebuffer( GL_FRAMEBUFFER, framebuffer );
+    glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffer );
+    glViewport( 0, 0, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT );
+
+    const GLuint program = compileProgram();
+    CSCI441::ModelLoader model;
+    const bool loaded = model.loadModelFile( "draw_batched_textures_test.obj", false, true );
+    removeFiles();
+    if( program == 0 || !loaded ) {
+        fprintf( stderr, "[ERROR]: Could not set up the test\n" );
+        return 2;
+    }
+    model.setAttributeLocations( 0, -1, 2 );
+
+    // the caller's texture, which the untextured material must leave bound
+    const unsigned char white[4] = { 255, 255, 255, 255 };
+    GLuint callerTexture;
+    glGenTextures( 1, &callerTexture );
+    glActiveTexture( GL_TEXTURE0 );
+    glBindTexture( GL_TEXTURE_2D, callerTexture );
+    glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+
+    glUseProgram( program );
+    glUniform1i( glGetUniformLocation( program, "diffuseMap" ), 0 );
+    glUniformBlockBinding( program, glGetUniformBlockIndex( program, "Materials" ), 0 );
+    glClearColor( 0.0f, 0.0f, 0.0f, 1.0f );
+    glClear( GL_COLOR_BUFFER_BIT );
+    model.drawBatched( 0, GL_TEXTURE0 );
+
+    unsigned char pixels[FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT * 4];
+    glReadPixels( 0, 0, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, pixels );
+
+    int failures = 0;
+    const auto checkPixel = [&]( const int x, const char* what, const int red, const int green, const int blue ) {
+        const unsigned char* pixel = pixels + ((FRAMEBUFFER_HEIGHT / 2) * FRAMEBUFFER_WIDTH + x) * 4;
+        const bool passed = abs( pixel[0] - red ) <= 2 && abs( pixel[1] - green ) <= 2 && abs( pixel[2] - blue ) <= 2;
+        printf( "[%s] %s (read %d,%d,%d)\n", passed ? " OK " : "FAIL", what, pixel[0], pixel[1], pixel[2] );
+        if( !passed ) failures++;
+    };
+    checkPixel( FRAMEBUFFER_WIDTH / 6, "untextured material keeps the caller's texture", 0, 0, 255 );
+    checkPixel( FRAMEBUFFER_WIDTH / 2, "first textured material draws with its own texture and record", 255, 128, 0 );
+    checkPixel( FRAMEBUFFER_WIDTH * 5 / 6, "second textured material draws with its own texture and record", 0, 255, 128 );
+
+    const GLenum error = glGetError();
+    printf( "[%s] no OpenGL errors (0x%04x)\n", error == GL_NO_ERROR ? " OK " : "FAIL", error );
+    if( error != GL_NO_ERROR ) failures++;
+
+    glDeleteTextures( 1, &callerTexture );
+    glDeleteProgram( program );
+    glDeleteFramebuffers( 1, &framebuffer );
+    glDeleteRenderbuffers( 1, &renderbuffer );
+    return failures == 0 ? 0 : 1;
+}
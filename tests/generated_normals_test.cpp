@@ -0,0 +1,95 @@
+// Generates normals for a cube, which must keep a hard edge between every pair
+// of faces, and for a flat 60000-gon, whose center vertex is shared by 59998
+// triangles that must all be smoothed into one normal.  The 60000-gon took
+// seconds while every corner compared itself against the whole fan.
+
+#define CSCI441_TEXTURE_UTILS_IMPLEMENTATION
+#include "../TextureUtils.hpp"
+#include "../ModelLoader.hpp"
+#include "headless_context.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+static constexpr int POLYGON_SIDES = 60000;
+
+static bool writeCubeOFF( const char* filename ) {
+    FILE* file = fopen( filename, "w" );
+    if( file == nullptr ) return false;
+    fprintf( file, "OFF\n8 6 0\n" );
+    for( int v = 0; v < 8; v++ ) {
+        fprintf( file, "%d %d %d\n", v & 1, (v >> 1) & 1, (v >> 2) & 1 );
+    }
+    fprintf( file, "4 0 2 3 1\n4 4 5 7 6\n4 0 1 5 4\n4 2 6 7 3\n4 0 4 6 2\n4 1 3 7 5\n" );
+    return fclose( file ) == 0;
+}
+
+static bool writePolygonOFF( const char* filename ) {
+    FILE* file = fopen( filename, "w" );
+    if( file == nullptr ) return false;
+    fprintf( file, "OFF\n%d 1 0\n", POLYGON_SIDES );
+    for( int v = 0; v < POLYGON_SIDES; v++ ) {
+        const double angle = 2.0 * M_PI * v / POLYGON_SIDES;
+        fprintf( file, "%.9f %.9f 0\n", cos( angle ), sin( angle ) );
+    }
+    fprintf( file, "%d", POLYGON_SIDES );
+    for( int v = 0; v < POLYGON_SIDES; v++ ) {
+        fprintf( file, " %d", v );
+    }
+    fprintf( file, "\n" );
+    return fclose( file ) == 0;
+}
+
+// true if every corner's normal is unit length and within the given cosine of its face
+static bool normalsFollowFaces( const CSCI441::ModelLoader& model, const float minCosine ) {
+    const auto* positions = reinterpret_cast<const glm::vec3*>( model.getVertices() );
+    const auto* normals = reinterpret_cast<const glm::vec3*>( model.getNormals() );
+    const GLuint* indices = model.getIndices();
+    if( positions == nullptr || normals == nullptr || indices == nullptr ) return false;
+    for( GLuint i = 0; i + 2 < model.getNumberOfIndices(); i += 3 ) {
+        const glm::vec3 face = glm::cross( positions[indices[i + 1]] - positions[indices[i]], positions[indices[i + 2]] - positions[indices[i]] );
+        if( glm::length( face ) == 0.0f ) continue;
+        for( GLuint c = 0; c < 3; c++ ) {
+            const glm::vec3& normal = normals[ indices[i + c] ];
+            if( std::fabs( glm::length( normal ) - 1.0f ) > 1e-4f || glm::dot( glm::normalize( face ), normal ) < minCosine ) return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    if( !CSCI441_TESTS::createHeadlessContext() ) return 2;
+
+    if( !writeCubeOFF( "generated_normals_test_cube.off" ) || !writePolygonOFF( "generated_normals_test_polygon.off" ) ) {
+        fprintf( stderr, "[ERROR]: Could not write the test models\n" );
+        remove( "generated_normals_test_cube.off" );
+        remove( "generated_normals_test_polygon.off" );
+        return 2;
+    }
+
+    int failures = 0;
+    const auto check = [&failures]( const bool passed, const char* what ) {
+        printf( "[%s] %s\n", passed ? " OK " : "FAIL", what );
+        if( !passed ) failures++;
+    };
+
+    CSCI441::ModelLoader::enableAutoGenerateNormals( 60.0f );
+
+    CSCI441::ModelLoader cube;
+    check( cube.loadModelFile( "generated_normals_test_cube.off", false, true ), "cube loads" );
+    check( cube.getNumberOfVertices() == 24, "every cube corner is split three ways by its hard edges" );
+    check( normalsFollowFaces( cube, 0.9999f ), "every cube face keeps its own normal" );
+
+    CSCI441::ModelLoader polygon;
+    const auto start = std::chrono::steady_clock::now();
+    check( polygon.loadModelFile( "generated_normals_test_polygon.off", false, true ), "60000-gon loads" );
+    printf( "[INFO]: 60000-gon loaded in %.1f ms\n", CSCI441_INTERNAL::millisecondsSince( start ) );
+    check( normalsFollowFaces( polygon, 0.9999f ), "every 60000-gon corner takes the normal of the plane" );
+
+    CSCI441::ModelLoader::disableAutoGenerateNormals();
+    remove( "generated_normals_test_cube.off" );
+    remove( "generated_normals_test_polygon.off" );
+
+    return failures == 0 ? 0 : 1;
+}
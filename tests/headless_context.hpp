@@ -0,0 +1,68 @@
+/** @file headless_context.hpp
+ * @brief Creates an OpenGL context without a window for tests and benchmarks
+ * @author Dr. Jeffrey Paone
+ *
+ * @copyright MIT License Copyright (c) 2026 Dr. Jeffrey Paone
+ *
+ *	Uses EGL on the surfaceless Mesa platform, so it runs without a display
+ *	server on any machine with Mesa installed (llvmpipe provides OpenGL 4.5).
+ *	Rendering goes to a framebuffer object created by the caller.
+ *
+ *	@warning NOTE: This header file depends upon GLAD and EGL (link with -lEGL)
+ */
+
+#ifndef CSCI441_TESTS_HEADLESS_CONTEXT_HPP
+#define CSCI441_TESTS_HEADLESS_CONTEXT_HPP
+
+#include <glad/gl.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <cstdio>
+
+namespace CSCI441_TESTS {
+
+    /**
+     * @brief creates and makes current a core profile context on the surfaceless EGL platform
+     * @param majorVersion requested OpenGL major version
+     * @param minorVersion requested OpenGL minor version
+     * @return true if the context is current and GLAD loaded its functions
+     */
+    inline bool createHeadlessContext( const EGLint majorVersion = 4, const EGLint minorVersion = 5 ) {
+        const auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>( eglGetProcAddress("eglGetPlatformDisplayEXT") );
+        if( getPlatformDisplay == nullptr ) {
+            fprintf( stderr, "[ERROR]: EGL does not provide eglGetPlatformDisplayEXT\n" );
+            return false;
+        }
+
+        const EGLDisplay display = getPlatformDisplay( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr );
+        EGLint eglMajor = 0, eglMinor = 0;
+        if( display == EGL_NO_DISPLAY || !eglInitialize( display, &eglMajor, &eglMinor ) || !eglBindAPI( EGL_OPENGL_API ) ) {
+            fprintf( stderr, "[ERROR]: Could not initialize the surfaceless EGL platform\n" );
+            return false;
+        }
+
+        const EGLint contextAttributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, majorVersion,
+            EGL_CONTEXT_MINOR_VERSION, minorVersion,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        // surfaceless contexts need no config
+        const EGLContext context = eglCreateContext( display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttributes );
+        if( context == EGL_NO_CONTEXT || !eglMakeCurrent( display, EGL_NO_SURFACE, EGL_NO_SURFACE, context ) ) {
+            fprintf( stderr, "[ERROR]: Could not create an OpenGL %d.%d core context\n", majorVersion, minorVersion );
+            return false;
+        }
+
+        if( gladLoadGL( reinterpret_cast<GLADloadfunc>( eglGetProcAddress ) ) == 0 ) {
+            fprintf( stderr, "[ERROR]: Could not load OpenGL functions\n" );
+            return false;
+        }
+        return true;
+    }
+
+}
+
+#endif // CSCI441_TESTS_HEADLESS_CONTEXT_HPP
@@ -0,0 +1,109 @@
+// Loads OBJ models whose diffuse textures are a 2x2 RGB image, whose rows are
+// not a multiple of 4 bytes, and a 3x1 grey image, then reads each texture back
+// from the GPU.  Every texel must match the file, with grey expanded to RGB.
+
+#define CSCI441_TEXTURE_UTILS_IMPLEMENTATION
+#include "../TextureUtils.hpp"
+#include "../ModelLoader.hpp"
+#include "headless_context.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static bool writeModel( const std::string& name, const std::string& textureFilename ) {
+    FILE* mtl = fopen( (name + ".mtl").c_str(), "w" );
+    if( mtl == nullptr ) return false;
+    fprintf( mtl, "newmtl textured\nKd 1 1 1\nmap_Kd %s\n", textureFilename.c_str() );
+    if( fclose( mtl ) != 0 ) return false;
+
+    FILE* obj = fopen( (name + ".obj").c_str(), "w" );
+    if( obj == nullptr ) return false;
+    fprintf( obj, "mtllib %s.mtl\nv -1 -1 0\nv 1 -1 0\nv 1 1 0\nvt 0 0\nvt 1 0\nvt 1 1\nusemtl textured\nf 1/1 2/2 3/3\n", name.c_str() );
+    return fclose( obj ) == 0;
+}
+
+static bool writePNM( const char* filename, const char* magic, const int width, const int height, const std::vector<unsigned char>& pixels ) {
+    FILE* file = fopen( filename, "wb" );
+    if( file == nullptr ) return false;
+    fprintf( file, "%s\n%d %d\n255\n", magic, width, height );
+    fwrite( pixels.data(), 1, pixels.size(), file );
+    return fclose( file ) == 0;
+}
+
+static void removeFiles() {
+    for( const char* name : { "material_texture_format_test_rgb", "material_texture_format_test_grey" } ) {
+        remove( (std::string(name) + ".obj").c_str() );
+        remove( (std::string(name) + ".mtl").c_str() );
+    }
+    remove( "material_texture_format_test_rgb.ppm" );
+    remove( "material_texture_format_test_grey.pgm" );
+}
+
+// loads the model, which uploads its diffuse texture, then draws it so it binds that texture and
+// reads the texture back as tightly packed RGB
+static bool readMaterialTexture( const char* name, std::vector<unsigned char>& texels, GLint& width, GLint& height, GLenum& uploadError ) {
+    CSCI441::ModelLoader model;
+    if( !model.loadModelFile( std::string(name) + ".obj", false, true ) ) return false;
+    uploadError = glGetError();
+    model.draw( 0, -1, -1, -1, -1, GL_TEXTURE0 );
+    // without a shader program the material uniforms cannot be set, only the texture binding matters here
+    while( glGetError() != GL_NO_ERROR ) { }
+
+    GLint handle = 0;
+    glGetIntegerv( GL_TEXTURE_BINDING_2D, &handle );
+    if( handle == 0 ) return false;
+    glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width );
+    glGetTexLevelParameteriv( GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height );
+    texels.assign( static_cast<size_t>(width) * height * 3, 0 );
+    glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+    glGetTexImage( GL_TEXTURE_2D, 0, GL_RGB, GL_UNSIGNED_BYTE, texels.data() );
+    return true;
+}
+
+int main() {
+    if( !CSCI441_TESTS::createHeadlessContext() ) return 2;
+
+    // rows are listed top to bottom in the files and the loader stores them bottom to top
+    const std::vector<unsigned char> rgbPixels = { 255, 0, 0,   0, 255, 0,
+                                                   0, 0, 255,   255, 255, 0 };
+    const std::vector<unsigned char> rgbExpected = { 0, 0, 255,   255, 255, 0,
+                                                     255, 0, 0,   0, 255, 0 };
+    const std::vector<unsigned char> greyPixels = { 10, 128, 250 };
+    const std::vector<unsigned char> greyExpected = { 10, 10, 10,   128, 128, 128,   250, 250, 250 };
+
+    if( !writeModel( "material_texture_format_test_rgb", "material_texture_format_test_rgb.ppm" )
+        || !writeModel( "material_texture_format_test_grey", "material_texture_format_test_grey.pgm" )
+        || !writePNM( "material_texture_format_test_rgb.ppm", "P6", 2, 2, rgbPixels )
+        || !writePNM( "material_texture_format_test_grey.pgm", "P5", 3, 1, greyPixels ) ) {
+        fprintf( stderr, "[ERROR]: Could not write the test models\n" );
+        removeFiles();
+        return 2;
+    }
+
+    int failures = 0;
+    const auto check = [&failures]( const bool passed, const char* what ) {
+        printf( "[%s] %s\n", passed ? " OK " : "FAIL", what );
+        if( !passed ) failures++;
+    };
+
+    std::vector<unsigned char> texels;
+    GLint width = 0, height = 0;
+    GLint unpackAlignment = 0;
+    GLenum uploadError = GL_NO_ERROR;
+
+    const bool rgbRead = readMaterialTexture( "material_texture_format_test_rgb", texels, width, height, uploadError );
+    check( rgbRead && width == 2 && height == 2, "2x2 RGB texture is created" );
+    check( rgbRead && texels == rgbExpected, "2x2 RGB texels match the file" );
+    check( rgbRead && uploadError == GL_NO_ERROR, "2x2 RGB texture uploads without OpenGL errors" );
+    glGetIntegerv( GL_UNPACK_ALIGNMENT, &unpackAlignment );
+    check( unpackAlignment == 4, "the unpack alignment is restored" );
+
+    const bool greyRead = readMaterialTexture( "material_texture_format_test_grey", texels, width, height, uploadError );
+    check( greyRead && width == 3 && height == 1, "3x1 grey texture is created" );
+    check( greyRead && texels == greyExpected, "3x1 grey texels are expanded to RGB" );
+    check( greyRead && uploadError == GL_NO_ERROR, "3x1 grey texture uploads without OpenGL errors" );
+
+    removeFiles();
+    return failures == 0 ? 0 : 1;
+}
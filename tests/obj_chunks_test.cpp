@@ -0,0 +1,91 @@
+// Loads an OBJ file with one thread and with several threads and checks that
+// every parse produces the same model.  The file is built so chunk boundaries
+// fall inside long runs of "f -3/-3/-3 -2/-2/-2 -1/-1/-1" faces, so chunks
+// begin with relative indices into attributes read by an earlier chunk.  Five
+// blocks keep the boundaries for 2, 3 and 4 threads away from the block starts.
+
+#define CSCI441_TEXTURE_UTILS_IMPLEMENTATION
+#include "../TextureUtils.hpp"
+#include "../ModelLoader.hpp"
+#include "headless_context.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+static constexpr int NUM_BLOCKS = 5;
+static constexpr int FACES_PER_BLOCK = 40000;
+
+static bool writeRelativeIndexOBJ( const char* filename ) {
+    FILE* file = fopen( filename, "w" );
+    if( file == nullptr ) return false;
+    for( int block = 0; block < NUM_BLOCKS; block++ ) {
+        const auto offset = static_cast<float>(block);
+        fprintf( file, "v %f 0 0\nv %f 1 0\nv %f 0 1\n", offset, offset, offset );
+        fprintf( file, "vt %f 0.25\nvt %f 0.5\nvt %f 0.75\n", 0.1f * (offset + 1), 0.1f * (offset + 1), 0.1f * (offset + 1) );
+        fprintf( file, "vn 1 0 0\nvn 0 1 0\nvn 0 0 %f\n", offset + 1 );
+        for( int face = 0; face < FACES_PER_BLOCK; face++ ) {
+            fprintf( file, "f -3/-3/-3 -2/-2/-2 -1/-1/-1\n" );
+        }
+    }
+    return fclose( file ) == 0;
+}
+
+template<typename T>
+static bool sameArray( const T* a, const T* b, const size_t count ) {
+    if( a == nullptr || b == nullptr ) return a == b;
+    return memcmp( a, b, sizeof(T) * count ) == 0;
+}
+
+int main() {
+    if( !CSCI441_TESTS::createHeadlessContext() ) return 2;
+
+    const std::string filename = "obj_chunks_test.obj";
+    if( !writeRelativeIndexOBJ( filename.c_str() ) ) {
+        fprintf( stderr, "[ERROR]: Could not write %s\n", filename.c_str() );
+        return 2;
+    }
+
+    CSCI441::ModelLoader serial;
+    const bool serialLoaded = serial.loadModelFile( filename, false, true, 1 );
+    const size_t fileSize = serial.getLoadStats().bytesRead;
+
+    int failures = 0;
+    const auto check = [&failures]( const bool passed, const char* what, const GLuint numThreads ) {
+        printf( "[%s] %s (%u threads)\n", passed ? " OK " : "FAIL", what, numThreads );
+        if( !passed ) failures++;
+    };
+
+    check( serialLoaded, "model loads", 1 );
+    // the loader gives every thread at least 1MB of the file
+    check( fileSize >= 4 << 20, "the file is large enough to split across 4 threads", 1 );
+    check( serial.getNumberOfVertices() == NUM_BLOCKS * 3, "every block adds three unique vertices", 1 );
+
+    for( GLuint numThreads = 2; numThreads <= 4; numThreads++ ) {
+        CSCI441::ModelLoader parallel;
+        check( parallel.loadModelFile( filename, false, true, numThreads ), "model loads", numThreads );
+        check( serial.getNumberOfVertices() == parallel.getNumberOfVertices(), "vertex counts match", numThreads );
+        check( serial.getNumberOfIndices() == parallel.getNumberOfIndices(), "index counts match", numThreads );
+
+        const GLuint numVertices = std::min( serial.getNumberOfVertices(), parallel.getNumberOfVertices() );
+        check( sameArray( serial.getVertices(), parallel.getVertices(), numVertices * 3 ), "positions match", numThreads );
+        check( sameArray( serial.getTexCoords(), parallel.getTexCoords(), numVertices * 2 ), "texture coordinates match", numThreads );
+        check( sameArray( serial.getNormals(), parallel.getNormals(), numVertices * 3 ), "normals match", numThreads );
+        check( sameArray( serial.getIndices(), parallel.getIndices(), std::min( serial.getNumberOfIndices(), parallel.getNumberOfIndices() ) ), "indices match", numThreads );
+
+        // every vertex keeps the texture coordinate and normal of its own block, none are dropped to zero
+        bool attributesPresent = parallel.getTexCoords() != nullptr && parallel.getNormals() != nullptr;
+        for( GLuint v = 0; attributesPresent && v < parallel.getNumberOfVertices(); v++ ) {
+            const GLfloat block = std::round( parallel.getVertices()[v*3] );
+            attributesPresent = std::fabs( parallel.getTexCoords()[v*2] - 0.1f * (block + 1) ) < 1e-5f
+                             && parallel.getTexCoords()[v*2 + 1] > 0.0f
+                             && std::fabs( parallel.getNormals()[v*3] ) + std::fabs( parallel.getNormals()[v*3 + 1] ) + std::fabs( parallel.getNormals()[v*3 + 2] ) > 0.0f;
+        }
+        check( attributesPresent, "relative texture coordinate and normal indices resolve across chunks", numThreads );
+    }
+    remove( filename.c_str() );
+
+    return failures == 0 ? 0 : 1;
+}